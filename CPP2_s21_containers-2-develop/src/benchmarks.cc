@@ -0,0 +1,642 @@
+// Микробенчмарки контейнеров: `make bench`. Для каждого прогона печатается
+// время и число выделений памяти. Считаются malloc/realloc (сборка с
+// -Wl,--wrap), operator new перенаправлен на malloc: s21::vector для
+// тривиальных типов растёт через realloc, минуя operator new.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace {
+// malloc зовут и потоки-производители, и пул.
+std::atomic<std::size_t> g_allocations{0};
+
+struct Measurement {
+  double milliseconds;
+  std::size_t allocations;
+};
+
+template <typename Fn>
+Measurement measure(Fn fn) {
+  std::size_t allocations = g_allocations;
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  return {std::chrono::duration<double, std::milli>(stop - start).count(),
+          g_allocations - allocations};
+}
+
+void report(const char *name, const Measurement &m, std::size_t ops) {
+  std::printf("  %-28s %10.2f ms %12zu allocs %8.2f allocs/op\n", name,
+              m.milliseconds, m.allocations,
+              static_cast<double>(m.allocations) / ops);
+}
+
+// Результат складывается в sink, чтобы компилятор не выбросил работу.
+volatile long g_sink = 0;
+
+// Много коротких последовательностей: длины 0..7, как в профиле.
+template <typename Vector>
+void short_vectors(std::size_t count) {
+  long sum = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    Vector v;
+    std::size_t length = (i * 7919U) % 8U;
+    for (std::size_t j = 0; j < length; ++j) v.push_back(static_cast<int>(j));
+    for (std::size_t j = 0; j < length; ++j) sum += v[j];
+  }
+  g_sink = g_sink + sum;
+}
+
+void bench_short_vectors() {
+  const std::size_t count = 1000000;
+  std::printf("short vectors (%zu sequences of 0..7 ints)\n", count);
+  report("std::vector<int>",
+         measure([&] { short_vectors<std::vector<int>>(count); }), count);
+  report("s21::vector<int>",
+         measure([&] { short_vectors<s21::vector<int>>(count); }), count);
+  report("s21::small_vector<int, 8>",
+         measure([&] { short_vectors<s21::small_vector<int, 8>>(count); }),
+         count);
+}
+
+// Удаление каждого третьего элемента из 10M: erase(remove_if) за один
+// проход против поэлементного erase, который сдвигает хвост каждый раз.
+template <typename Vector>
+void compact(std::size_t count) {
+  Vector v;
+  for (std::size_t i = 0; i < count; ++i) v.push_back(static_cast<int>(i));
+  v.erase(std::remove_if(v.begin(), v.end(), [](int x) { return x % 3 == 0; }),
+          v.end());
+  g_sink = g_sink + static_cast<long>(v.size());
+}
+
+template <typename Vector>
+void compact_one_by_one(std::size_t count) {
+  Vector v;
+  for (std::size_t i = 0; i < count; ++i) v.push_back(static_cast<int>(i));
+  for (auto it = v.begin(); it != v.end();) {
+    if (*it % 3 == 0) {
+      std::size_t index = it - v.begin();
+      v.erase(it);
+      it = v.begin() + index;
+    } else {
+      ++it;
+    }
+  }
+  g_sink = g_sink + static_cast<long>(v.size());
+}
+
+void bench_compaction() {
+  const std::size_t count = 10000000;
+  const std::size_t slow_count = 100000;
+  std::printf("compaction (every third of %zu ints)\n", count);
+  report("std::vector<int>", measure([&] { compact<std::vector<int>>(count); }),
+         count);
+  report("s21::vector<int>", measure([&] { compact<s21::vector<int>>(count); }),
+         count);
+  std::printf("compaction by single erase (%zu ints)\n", slow_count);
+  report("s21::vector<int>",
+         measure([&] { compact_one_by_one<s21::vector<int>>(slow_count); }),
+         slow_count);
+}
+
+// Линейные сканы: std-алгоритмы против s21::simd. Малый буфер живёт в
+// кэше и показывает скорость ядер, большой упирается в пропускную
+// способность памяти.
+template <typename T>
+void bench_scans(const char *type, std::size_t count, int repeats) {
+  s21::vector<T> samples(count);
+  for (std::size_t i = 0; i < count; ++i)
+    samples[i] = static_cast<T>((i * 7919U) % 1000U);
+  s21::vector<T> copy = samples;
+  const T *first = samples.data();
+  const T *last = first + count;
+  const T missing = static_cast<T>(-1);
+
+  std::printf("scans over %zu x %s (x%d)\n", count, type, repeats);
+  auto run = [&](const char *name, auto fn) {
+    report(name, measure([&] {
+             for (int r = 0; r < repeats; ++r) g_sink = g_sink + fn();
+           }),
+           count * repeats);
+  };
+  run("std::find", [&] { return std::find(first, last, missing) - first; });
+  run("s21::simd::find",
+      [&] { return s21::simd::find(first, last, missing) - first; });
+  run("std::count", [&] { return std::count(first, last, T(7)); });
+  run("s21::simd::count",
+      [&] { return static_cast<long>(s21::simd::count(first, last, T(7))); });
+  run("std::max_element",
+      [&] { return std::max_element(first, last) - first; });
+  run("s21::simd::max_element",
+      [&] { return s21::simd::max_element(first, last) - first; });
+  run("std::equal",
+      [&] { return static_cast<long>(std::equal(first, last, copy.data())); });
+  run("s21::simd::equal", [&] {
+    return static_cast<long>(s21::simd::equal(first, last, copy.data()));
+  });
+}
+
+// Масштабирование s21::parallel по числу потоков: от одного до всех ядер.
+// Сортировка на 1 потоке сравнима с std::sort, дальше время должно падать
+// почти пропорционально, пока хватает пропускной способности памяти.
+void bench_parallel(std::size_t count) {
+  std::vector<int> source(count);
+  for (std::size_t i = 0; i < count; ++i)
+    source[i] = static_cast<int>((i * 2654435761U) % 1000003U);
+  s21::vector<int> ids(count);
+  s21::vector<double> scaled(count);
+
+  std::printf("parallel algorithms over %zu ints\n", count);
+  std::copy(source.begin(), source.end(), ids.begin());
+  report("std::sort", measure([&] { std::sort(ids.begin(), ids.end()); }),
+         count);
+  const std::size_t hardware = s21::parallel::thread_pool::hardware_threads();
+  for (std::size_t threads = 1;; threads = std::min(threads * 2, hardware)) {
+    s21::parallel::thread_pool pool(threads);
+    char name[64];
+    std::copy(source.begin(), source.end(), ids.begin());
+    std::snprintf(name, sizeof(name), "sort, %zu threads", threads);
+    report(name, measure([&] {
+             s21::parallel::sort(pool, ids.begin(), ids.end());
+           }),
+           count);
+    std::snprintf(name, sizeof(name), "transform, %zu threads", threads);
+    report(name, measure([&] {
+             s21::parallel::transform(pool, ids.begin(), ids.end(),
+                                      scaled.begin(),
+                                      [](int x) { return x * 0.001; });
+           }),
+           count);
+    std::snprintf(name, sizeof(name), "reduce, %zu threads", threads);
+    report(name, measure([&] {
+             g_sink = g_sink + static_cast<long>(s21::parallel::reduce(
+                                   pool, scaled.begin(), scaled.end(), 0.0));
+           }),
+           count);
+    if (threads == hardware) break;
+  }
+}
+
+// Перезапуск с готовым набором данных: чтение файла в s21::vector против
+// открытия s21::mmap_vector, которое только отображает файл.
+void bench_mmap_reload(std::size_t count) {
+  struct Record {
+    long id;
+    double values[3];
+  };
+  const char *path = "s21_bench_records.bin";
+  {
+    s21::mmap_vector<Record> records(
+        path, s21::mmap_vector<Record>::open_mode::create);
+    records.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+      records.push_back({static_cast<long>(i), {0.5, 1.5, 2.5}});
+  }
+  const std::size_t bytes = count * sizeof(Record);
+  std::printf("reload of %zu records (%zu MB)\n", count, bytes >> 20);
+  report("read into s21::vector", measure([&] {
+           s21::vector<Record> records(count);
+           std::FILE *file = std::fopen(path, "rb");
+           std::fseek(file, s21::mmap_vector<Record>::header_size, SEEK_SET);
+           std::size_t got = std::fread(records.data(), sizeof(Record),
+                                        count, file);
+           std::fclose(file);
+           g_sink = g_sink + static_cast<long>(got) + records[count / 2].id;
+         }),
+         1);
+  report("open s21::mmap_vector", measure([&] {
+           s21::mmap_vector<Record> records(path);
+           g_sink = g_sink + static_cast<long>(records.size()) +
+                    records[count / 2].id;
+         }),
+         1);
+  std::remove(path);
+}
+
+// Проход по одному-двум полям: s21::vector структур против столбцов
+// s21::soa_vector. В первом случае читается вся строка кэша, во втором
+// только нужные байты, и цикл векторизуется.
+void bench_soa(std::size_t count, int repeats) {
+  struct Particle {
+    float x, y, z, vx, vy, vz, mass;
+    int id;
+  };
+  s21::vector<Particle> aos(count);
+  s21::soa_vector<float, float, float, float, float, float, float, int> soa;
+  soa.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    float f = static_cast<float>(i % 100);
+    aos[i] = {f, f, f, 1.0f, 1.0f, 1.0f, f, static_cast<int>(i)};
+    soa.push_back(f, f, f, 1.0f, 1.0f, 1.0f, f, static_cast<int>(i));
+  }
+  const float dt = 0.01f;
+  std::printf("particles: x += vx * dt over %zu rows (x%d)\n", count,
+              repeats);
+  report("s21::vector<Particle>", measure([&] {
+           for (int r = 0; r < repeats; ++r)
+             for (std::size_t i = 0; i < count; ++i)
+               aos[i].x += aos[i].vx * dt;
+         }),
+         count * repeats);
+  report("s21::soa_vector columns", measure([&] {
+           for (int r = 0; r < repeats; ++r) {
+             float *x = soa.data<0>();
+             const float *vx = soa.data<3>();
+             for (std::size_t i = 0; i < count; ++i) x[i] += vx[i] * dt;
+           }
+         }),
+         count * repeats);
+  std::printf("particles: count of id above threshold (x%d)\n", repeats);
+  report("s21::vector<Particle>", measure([&] {
+           for (int r = 0; r < repeats; ++r) {
+             long heavy = 0;
+             for (std::size_t i = 0; i < count; ++i)
+               heavy += aos[i].id > 1000;
+             g_sink = g_sink + heavy;
+           }
+         }),
+         count * repeats);
+  report("s21::soa_vector columns", measure([&] {
+           for (int r = 0; r < repeats; ++r) {
+             long heavy = 0;
+             for (int id : soa.column<7>()) heavy += id > 1000;
+             g_sink = g_sink + heavy;
+           }
+         }),
+         count * repeats);
+  g_sink = g_sink + static_cast<long>(aos[count / 2].x + soa.data<0>()[1]);
+}
+
+// Флаги посещения: байт на флаг (s21::vector<unsigned char>, прежнее
+// представление vector<bool>) против упакованного s21::vector<bool>.
+void bench_flags(std::size_t count) {
+  s21::vector<unsigned char> bytes_a(count), bytes_b(count);
+  s21::vector<bool> bits_a(count), bits_b(count);
+  for (std::size_t i = 0; i < count; i += 3) bytes_a[i] = bits_a[i] = true;
+  for (std::size_t i = 0; i < count; i += 5) bytes_b[i] = bits_b[i] = true;
+
+  std::printf("visited flags: %zu entries, %zu MB as bytes, %zu MB packed\n",
+              count, count >> 20, (bits_a.word_count() * 8) >> 20);
+  report("bytes: count", measure([&] {
+           g_sink = g_sink + std::count(bytes_a.begin(), bytes_a.end(), 1);
+         }),
+         count);
+  report("packed: count", measure([&] {
+           g_sink = g_sink + static_cast<long>(bits_a.count());
+         }),
+         count);
+  report("bytes: a &= b", measure([&] {
+           for (std::size_t i = 0; i < count; ++i) bytes_a[i] &= bytes_b[i];
+         }),
+         count);
+  report("packed: a &= b", measure([&] { bits_a &= bits_b; }), count);
+  g_sink = g_sink + bytes_a[15] + bits_a[15];
+}
+
+// Задержка push_back: время пачек по 256 вставок, перцентили по пачкам.
+// У s21::vector хвост — это переносы всего буфера при росте, у
+// segmented_vector рост только выделяет новый сегмент.
+template <typename Vector, typename Make>
+void push_latency(const char *name, std::size_t count, Make make) {
+  constexpr std::size_t kBatch = 256;
+  std::vector<double> batches;
+  batches.reserve(count / kBatch);
+  Measurement total = measure([&] {
+    Vector values;
+    for (std::size_t i = 0; i < count; i += kBatch) {
+      auto start = std::chrono::steady_clock::now();
+      for (std::size_t j = i; j < i + kBatch; ++j) values.push_back(make(j));
+      auto stop = std::chrono::steady_clock::now();
+      batches.push_back(
+          std::chrono::duration<double, std::micro>(stop - start).count());
+    }
+    g_sink = g_sink + static_cast<long>(values.size());
+  });
+  std::sort(batches.begin(), batches.end());
+  auto at = [&](double q) {
+    return batches[static_cast<std::size_t>(q * (batches.size() - 1))];
+  };
+  std::printf("  %-28s %10.2f ms   batch of %zu: p50 %.1f us, p99.9 %.1f us,"
+              " max %.1f us\n",
+              name, total.milliseconds, kBatch, at(0.5), at(0.999),
+              batches.back());
+}
+
+struct Order {
+  long id;
+  double price;
+  long quantity;
+  Order(long i) : id(i), price(1.5), quantity(i % 100) {}
+  Order(const Order &other)
+      : id(other.id), price(other.price), quantity(other.quantity) {}
+  Order &operator=(const Order &) = default;
+};
+
+void bench_segmented(std::size_t long_count, std::size_t order_count) {
+  std::printf("push_back latency, %zu longs\n", long_count);
+  auto make_long = [](std::size_t i) { return static_cast<long>(i); };
+  push_latency<s21::vector<long>>("s21::vector<long>", long_count, make_long);
+  push_latency<s21::segmented_vector<long>>("s21::segmented_vector<long>",
+                                            long_count, make_long);
+  std::printf("push_back latency, %zu orders (non-trivial copy)\n",
+              order_count);
+  auto make_order = [](std::size_t i) { return Order(static_cast<long>(i)); };
+  push_latency<s21::vector<Order>>("s21::vector<Order>", order_count,
+                                   make_order);
+  push_latency<s21::segmented_vector<Order>>("s21::segmented_vector<Order>",
+                                             order_count, make_order);
+}
+
+// Общий вектор результатов от 1..64 потоков-производителей: s21::vector
+// под mutex против s21::concurrent_vector. Всего total вставок, поровну
+// на поток.
+void bench_concurrent(std::size_t total) {
+  std::printf("concurrent append of %zu longs\n", total);
+  for (std::size_t producers = 1; producers <= 64; producers *= 2) {
+    const std::size_t each = total / producers;
+    char name[64];
+    auto run = [&](auto push) {
+      std::vector<std::thread> threads;
+      for (std::size_t p = 0; p < producers; ++p)
+        threads.emplace_back([&, p] {
+          for (std::size_t i = 0; i < each; ++i)
+            push(static_cast<long>(p * each + i));
+        });
+      for (auto &thread : threads) thread.join();
+    };
+    s21::vector<long> locked;
+    std::mutex mutex;
+    std::snprintf(name, sizeof(name), "mutex + vector, %zu thr", producers);
+    report(name, measure([&] {
+             run([&](long value) {
+               std::lock_guard<std::mutex> lock(mutex);
+               locked.push_back(value);
+             });
+           }),
+           total);
+    s21::concurrent_vector<long> shared;
+    std::snprintf(name, sizeof(name), "concurrent_vector, %zu thr",
+                  producers);
+    report(name, measure([&] {
+             run([&](long value) { shared.push_back(value); });
+           }),
+           total);
+    g_sink = g_sink + static_cast<long>(locked.size() + shared.size());
+  }
+}
+
+// Набор текста в середину большого буфера: каждые 50 нажатий курсор
+// прыгает в новое место, одно нажатие из пяти — backspace.
+template <typename Buffer>
+void keystrokes(Buffer &text, std::size_t strokes) {
+  std::size_t cursor = text.size() / 2;
+  for (std::size_t i = 0; i < strokes; ++i) {
+    if (i % 50 == 0) cursor = (i * 2654435761U) % text.size();
+    if (i % 5 == 4 && cursor > 0) {
+      --cursor;
+      text.erase(text.begin() + cursor);
+    } else {
+      text.insert(text.begin() + cursor, static_cast<char32_t>('a' + i % 26));
+      ++cursor;
+    }
+  }
+  g_sink = g_sink + static_cast<long>(text.size());
+}
+
+void bench_gap_buffer(std::size_t length, std::size_t strokes) {
+  std::printf("%zu keystrokes in %zu chars of text\n", strokes, length);
+  s21::vector<char32_t> vector_text(length);
+  report("s21::vector<char32_t>",
+         measure([&] { keystrokes(vector_text, strokes); }), strokes);
+  s21::gap_buffer<char32_t> gap_text(length);
+  report("s21::gap_buffer<char32_t>",
+         measure([&] { keystrokes(gap_text, strokes); }), strokes);
+}
+
+// Журнал из фрагментов по 100 байт, затем вставки кусков в середину
+// и вырезание подстрок.
+template <typename Sequence>
+void build_and_splice(Sequence &log, std::size_t bytes, std::size_t splices) {
+  char fragment[100];
+  for (std::size_t i = 0; i < sizeof(fragment); ++i)
+    fragment[i] = static_cast<char>('a' + i % 26);
+  for (std::size_t done = 0; done < bytes; done += sizeof(fragment))
+    log.insert(log.end(), fragment, fragment + sizeof(fragment));
+  for (std::size_t i = 0; i < splices; ++i) {
+    std::size_t pos = (i * 2654435761U) % log.size();
+    log.insert(log.begin() + pos, fragment, fragment + sizeof(fragment));
+    log.erase(log.begin() + pos / 2, log.begin() + pos / 2 + 50);
+  }
+  g_sink = g_sink + static_cast<long>(log.size());
+}
+
+void bench_rope(std::size_t bytes, std::size_t splices) {
+  std::printf("log of %zu bytes from 100-byte fragments, %zu splices\n",
+              bytes, splices);
+  s21::vector<char> flat;
+  report("s21::vector<char>",
+         measure([&] { build_and_splice(flat, bytes, splices); }), splices);
+  s21::rope<char> chunked;
+  report("s21::rope<char>",
+         measure([&] { build_and_splice(chunked, bytes, splices); }),
+         splices);
+  long sum = 0;
+  report("rope for_each_segment", measure([&] {
+           chunked.for_each_segment([&sum](const char *b, const char *e) {
+             for (; b != e; ++b) sum += *b;
+           });
+         }),
+         chunked.size());
+  report("rope iterator", measure([&] {
+           for (char c : chunked) sum += c;
+         }),
+         chunked.size());
+  g_sink = g_sink + sum;
+}
+
+// Отсортированный список документов с шагами 1..64: память и скорость
+// суммирования для несжатого вектора и каждого кодека.
+template <typename Codec>
+void packed_scan(const char *name, const s21::vector<std::uint64_t> &ids,
+                 int repeats) {
+  s21::packed_vector<Codec> packed;
+  for (std::size_t i = 0; i < ids.size(); ++i) packed.push_back(ids[i]);
+  packed.shrink_to_fit();
+  std::uint64_t sum = 0;
+  Measurement m = measure([&] {
+    for (int r = 0; r < repeats; ++r)
+      packed.for_each_segment(
+          [&sum](const std::uint64_t *b, const std::uint64_t *e) {
+            for (; b != e; ++b) sum += *b;
+          });
+  });
+  std::printf("  %-28s %10.2f ms %9.2f bytes/value\n", name, m.milliseconds,
+              static_cast<double>(packed.memory_usage()) / ids.size());
+  g_sink = g_sink + static_cast<long>(sum);
+}
+
+void bench_packed(std::size_t count, int repeats) {
+  std::printf("%d scans of %zu sorted uint64 ids\n", repeats, count);
+  s21::vector<std::uint64_t> ids;
+  ids.reserve(count);
+  std::uint64_t id = 1000000007;
+  for (std::size_t i = 0; i < count; ++i) {
+    id += 1 + (i * 2654435761U >> 7) % 64;
+    ids.push_back(id);
+  }
+  std::uint64_t sum = 0;
+  Measurement m = measure([&] {
+    for (int r = 0; r < repeats; ++r)
+      for (std::size_t i = 0; i < ids.size(); ++i) sum += ids[i];
+  });
+  std::printf("  %-28s %10.2f ms %9.2f bytes/value\n",
+              "s21::vector<uint64_t>", m.milliseconds,
+              static_cast<double>(sizeof(std::uint64_t)));
+  g_sink = g_sink + static_cast<long>(sum);
+  packed_scan<s21::codec::bitpack>("packed_vector<bitpack>", ids, repeats);
+  packed_scan<s21::codec::delta>("packed_vector<delta>", ids, repeats);
+  packed_scan<s21::codec::varint>("packed_vector<varint>", ids, repeats);
+}
+
+// Случайное чтение по большому вектору: индексы — биекция i -> i * odd
+// по модулю 2^k, так что каждое чтение попадает на случайную страницу.
+template <typename Vector>
+void random_reads(const char *name, std::size_t count, std::size_t reads) {
+  Vector table;
+  table.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) table.push_back(i);
+  std::uint64_t sum = 0;
+  const std::size_t mask = count - 1;
+  report(name, measure([&] {
+           for (std::size_t i = 0; i < reads; ++i)
+             sum += table[(i * 0x9E3779B97F4A7C15ULL) & mask];
+         }),
+         reads);
+  g_sink = g_sink + static_cast<long>(sum);
+}
+
+void bench_huge_pages(std::size_t count, std::size_t reads) {
+  std::printf("%zu random reads over %zu MiB\n", reads,
+              count * sizeof(std::uint64_t) >> 20);
+  random_reads<s21::vector<std::uint64_t>>("s21::vector<uint64_t>", count,
+                                           reads);
+  random_reads<s21::aligned_vector<std::uint64_t>>("aligned_vector<uint64_t>",
+                                                   count, reads);
+  random_reads<s21::huge_page_vector<std::uint64_t>>(
+      "huge_page_vector<uint64_t>", count, reads);
+}
+
+template <typename Window>
+std::int64_t window_total(Window &&window) {
+  std::int64_t total = 0;
+  for (int x : window) total += x;
+  return total;
+}
+
+// Скользящее окно: копия каждого отрезка в s21::vector против span на
+// тот же буфер.
+void bench_span(std::size_t length, std::size_t window) {
+  std::printf("sums of %zu windows of %zu ints\n", length - window, window);
+  s21::vector<int> samples(length);
+  for (std::size_t i = 0; i < length; ++i) samples[i] = int(i % 1000);
+  const std::size_t windows = length - window;
+  report("copy to s21::vector", measure([&] {
+           for (std::size_t i = 0; i < windows; ++i) {
+             s21::vector<int> part;
+             part.insert(part.cend(), samples.data() + i,
+                         samples.data() + i + window);
+             g_sink = g_sink + window_total(part);
+           }
+         }),
+         windows);
+  report("s21::span::subspan", measure([&] {
+           s21::span<const int> all(samples);
+           for (std::size_t i = 0; i < windows; ++i)
+             g_sink = g_sink + window_total(all.subspan(i, window));
+         }),
+         windows);
+}
+
+template <typename Config>
+void fan_out(const Config &config, std::size_t workers, std::size_t rounds) {
+  std::vector<Config> copies;
+  copies.reserve(workers);
+  for (std::size_t r = 0; r < rounds; ++r) {
+    for (std::size_t w = 0; w < workers; ++w) copies.push_back(config);
+    g_sink = g_sink + static_cast<long>(copies.back().size());
+    copies.clear();
+  }
+}
+
+// Раздача одной конфигурации рабочим: у s21::vector каждая копия — новый
+// буфер, у shared_vector — увеличение счётчика.
+void bench_shared_vector(std::size_t length, std::size_t workers,
+                         std::size_t rounds) {
+  std::printf("%zu rounds of %zu copies of %zu ints\n", rounds, workers,
+              length);
+  s21::vector<int> config(length);
+  report("s21::vector<int>",
+         measure([&] { fan_out(config, workers, rounds); }),
+         workers * rounds);
+  s21::shared_vector<int> shared(std::move(config));
+  report("s21::shared_vector<int>",
+         measure([&] { fan_out(shared, workers, rounds); }),
+         workers * rounds);
+}
+}  // namespace
+
+extern "C" {
+void *__real_malloc(std::size_t size);
+void *__real_realloc(void *p, std::size_t size);
+
+void *__wrap_malloc(std::size_t size) {
+  ++g_allocations;
+  return __real_malloc(size);
+}
+
+void *__wrap_realloc(void *p, std::size_t size) {
+  ++g_allocations;
+  return __real_realloc(p, size);
+}
+}
+
+void *operator new(std::size_t size) {
+  if (void *p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+int main() {
+  bench_short_vectors();
+  bench_compaction();
+  bench_scans<int>("int", 1 << 14, 4000);
+  bench_scans<float>("float", 1 << 14, 4000);
+  bench_scans<float>("float", 1 << 24, 4);
+  bench_parallel(10000000);
+  bench_mmap_reload(1 << 23);
+  bench_soa(1 << 22, 20);
+  bench_flags(std::size_t{1} << 28);
+  bench_segmented(std::size_t{1} << 27, std::size_t{1} << 25);
+  bench_concurrent(std::size_t{1} << 24);
+  bench_gap_buffer(std::size_t{1} << 22, 4000);
+  bench_rope(std::size_t{1} << 26, 500);
+  bench_packed(std::size_t{1} << 25, 10);
+  bench_huge_pages(std::size_t{1} << 28, std::size_t{1} << 25);
+  bench_span(1 << 20, 256);
+  bench_shared_vector(1 << 20, 64, 10);
+  return 0;
+}
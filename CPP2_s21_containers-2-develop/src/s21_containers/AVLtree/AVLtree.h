@@ -1,11 +1,17 @@
 #ifndef _S21_TREE_H_
 #define _S21_TREE_H_
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace s21 {
-template <typename K, typename V>
+template <typename K, typename V,
+          typename Allocator = std::allocator<std::pair<const K, V>>>
 class AVLTree {
  public:
   class IteratorTree;
@@ -14,6 +20,11 @@ class AVLTree {
   using iterator = IteratorTree;
   using const_iterator = ConstIteratorTree;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  // Доля удаляемых узлов, начиная с которой erase_if пересобирает дерево
+  // целиком вместо поштучного удаления.
+  static constexpr double kEraseRebuildRatio = 0.25;
 
  protected:
   struct Node {
@@ -24,32 +35,43 @@ class AVLTree {
     Node *right_;
     Node *left_;
 
+    int height_;
+    size_type weight_;  // число узлов в поддереве
+
     explicit Node(const K &key, const V &value)
         : key_(key),
           value_(value),
           parent_(nullptr),
           right_(nullptr),
-          left_(nullptr){};
+          left_(nullptr),
+          height_(1),
+          weight_(1){};
 
     explicit Node(const K &key, const V &value, Node *parent)
         : key_(key),
           value_(value),
           parent_(parent),
           right_(nullptr),
-          left_(nullptr){};
+          left_(nullptr),
+          height_(1),
+          weight_(1){};
   };
 
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator node_alloc_;
   Node *root_ = nullptr;
   size_type size_ = 0;
-  size_type cnt_duplicate_ = 0;
 
  public:
   class ConstIteratorTree {
-    friend class AVLTree<K, V>;
+    friend class AVLTree<K, V, Allocator>;
 
    public:
     ConstIteratorTree() : current_(nullptr), tree_(nullptr) {}
-    ConstIteratorTree(Node *node, AVLTree<K, V> *tree)
+    ConstIteratorTree(Node *node, AVLTree<K, V, Allocator> *tree)
         : current_(node), tree_(tree) {}
 
     bool operator==(const ConstIteratorTree &other) const {
@@ -104,13 +126,13 @@ class AVLTree {
 
    protected:
     Node *current_ = nullptr;
-    s21::AVLTree<K, V> *tree_ = nullptr;
+    s21::AVLTree<K, V, Allocator> *tree_ = nullptr;
   };
 
   class IteratorTree : public ConstIteratorTree {
    public:
     IteratorTree() : ConstIteratorTree() {}
-    IteratorTree(Node *node, AVLTree<K, V> *tree)
+    IteratorTree(Node *node, AVLTree<K, V, Allocator> *tree)
         : ConstIteratorTree(node, tree) {}
 
     IteratorTree &operator++() {
@@ -146,35 +168,48 @@ class AVLTree {
 
   AVLTree() { root_ = nullptr; }
 
+  explicit AVLTree(const Allocator &alloc) : node_alloc_(alloc) {}
+
   AVLTree(std::initializer_list<std::pair<K, V>> const &items) {
     for (const auto &item : items) {
       insert(item.first, item.second);
     }
   }
 
-  AVLTree(const AVLTree &t) {
+  AVLTree(const AVLTree &t)
+      : node_alloc_(
+            node_traits::select_on_container_copy_construction(t.node_alloc_)) {
     size_ = t.size_;
-    cnt_duplicate_ = t.cnt_duplicate_;
     root_ = copy_tree(t.root_, nullptr);
   }
 
-  AVLTree(AVLTree &&t) { *this = std::move(t); }
+  AVLTree(AVLTree &&t) : node_alloc_(t.node_alloc_) { *this = std::move(t); }
 
+  // Узлы чужого аллокатора не забираются, а копируются в свою память.
   AVLTree &operator=(AVLTree &&t) {
     if (this != &t) {
       clear(&this->root_);
-      root_ = t.root_;
-      size_ = t.size_;
-      cnt_duplicate_ = t.cnt_duplicate_;
-      t.root_ = nullptr;
-      t.size_ = 0;
-      t.cnt_duplicate_ = 0;
+      constexpr bool propagate =
+          node_traits::propagate_on_container_move_assignment::value;
+      if (propagate || node_alloc_ == t.node_alloc_) {
+        if constexpr (propagate) node_alloc_ = std::move(t.node_alloc_);
+        root_ = t.root_;
+        size_ = t.size_;
+        t.root_ = nullptr;
+        t.size_ = 0;
+      } else {
+        root_ = copy_tree(t.root_, nullptr);
+        size_ = t.size_;
+        t.clear();
+      }
     }
     return *this;
   }
 
   ~AVLTree() { clear(); }
 
+  allocator_type get_allocator() const { return allocator_type(node_alloc_); }
+
   iterator begin() {
     Node *current = root_;
     if (current == nullptr) {
@@ -191,79 +226,24 @@ class AVLTree {
     if (find_bool(key))  // Проверка ключа, а не значения
       return;
 
-    Node *cell = new Node(key, value);
+    Node *parent = nullptr;
     Node *current = root_;
-    if (root_ == nullptr) {
-      root_ = cell;
-      current = cell;
-    } else {
-      while (true) {
-        if (cell->key_ > current->key_) {
-          if (current->right_ != nullptr) {
-            current = current->right_;
-          } else {
-            break;
-          }
-        } else if (cell->key_ < current->key_) {
-          if (current->left_ != nullptr) {
-            current = current->left_;
-          } else {
-            break;
-          }
-        }
-      }
-      if (cell->key_ > current->key_) {
-        current->right_ = cell;
-        cell->parent_ = current;
-        current = cell;
-      } else if (cell->key_ < current->key_) {
-        current->left_ = cell;
-        cell->parent_ = current;
-        current = cell;
-      }
+    while (current != nullptr) {
+      parent = current;
+      current = key < current->key_ ? current->left_ : current->right_;
     }
-    size_++;
+    link_node(create_node(key, value, parent), parent);
   }
 
   void remove(V value) {
     Node *current = find_value(value);
     if (current == nullptr) return;
-    Node *tmp = current;
-    int flag = 0;
-    if (current->left_ != nullptr && current->right_ != nullptr) {
-      tmp = current->right_;
-      if (tmp->left_ == nullptr) {
-        change_link(current, tmp, flag);
-      } else {
-        tmp = min(tmp);
-        current->value_ = tmp->value_;
-        tmp->parent_->left_ = nullptr;
-      }
-    } else if (current->left_ != nullptr && current->right_ == nullptr) {
-      flag = 1;
-      tmp = current->left_;
-      change_link(current, tmp, flag);
-    } else if (current->left_ == nullptr && current->right_ != nullptr) {
-      tmp = current->right_;
-      change_link(current, tmp, flag);
-    } else if (current->left_ == nullptr && current->right_ == nullptr) {
-      if (tmp->parent_->left_ == nullptr)
-        tmp->parent_->right_ = nullptr;
-      else if (tmp->parent_->right_ == nullptr)
-        tmp->parent_->left_ = nullptr;
-      else if (tmp == tmp->parent_->left_)
-        tmp->parent_->left_ = nullptr;
-      else if (tmp == tmp->parent_->right_)
-        tmp->parent_->right_ = nullptr;
-    }
-    delete tmp;
-    size_--;
+    remove_node(current);
   }
 
   void clear() {
     if (root_ != nullptr) clear(&root_);
     size_ = 0;
-    cnt_duplicate_ = 0;
     root_ = nullptr;
   }
 
@@ -275,12 +255,17 @@ class AVLTree {
 
   bool empty() { return root_ == nullptr ? true : false; }
 
-  void erase(iterator pos) { remove(*pos); }
+  void erase(iterator pos) {
+    if (pos.current_ != nullptr) remove_node(pos.current_);
+  }
 
+  // Аллокаторы обмениваются при propagate_on_container_swap; иначе они
+  // должны быть равны.
   void swap(AVLTree &other) {
     std::swap(root_, other.root_);
     std::swap(size_, other.size_);
-    std::swap(cnt_duplicate_, other.cnt_duplicate_);
+    if constexpr (node_traits::propagate_on_container_swap::value)
+      std::swap(node_alloc_, other.node_alloc_);
   }
 
   void merge(AVLTree &other) {
@@ -338,10 +323,10 @@ class AVLTree {
   }
 
   size_type count(const K &key) {
-    if (find_bool(key))
-      return (cnt_duplicate_);
-    else
-      return 0;
+    size_type result = 0;
+    for (auto it = lower_bound(key), last = upper_bound(key); it != last; ++it)
+      ++result;
+    return result;
   }
 
   iterator lower_bound(const K &key) {
@@ -408,43 +393,108 @@ class AVLTree {
   }
 
   void add_mst(K key, V value) {
-    Node *current = root_;
     Node *parent = nullptr;
-
+    Node *current = root_;
     while (current != nullptr) {
       parent = current;
-      if (key > current->key_) {
-        current = current->right_;
-      } else if (key < current->key_) {
-        current = current->left_;
-      } else {
-        Node *cell = new Node(key, value);
-        while (current->right_ != nullptr) {
-          current = current->right_;
-        }
-        current->right_ = cell;
-        cell->parent_ = current;
-        size_++;
-        cnt_duplicate_++;
-        return;
+      current = key < current->key_ ? current->left_ : current->right_;
+    }
+    link_node(create_node(key, value, parent), parent);
+  }
+
+  // pred вызывается как pred(key, value) ровно один раз для каждого узла.
+  template <typename Pred>
+  size_type erase_nodes_if(Pred pred, double rebuild_ratio) {
+    std::vector<Node *> victims;
+    for (iterator it = begin(); it != end(); ++it) {
+      const Node *node = it.current_;
+      if (pred(node->key_, node->value_)) victims.push_back(it.current_);
+    }
+    if (victims.empty()) return 0;
+
+    if (victims.size() > rebuild_ratio * size_) {
+      std::vector<Node *> survivors;
+      survivors.reserve(size_ - victims.size());
+      size_type next_victim = 0;
+      for (iterator it = begin(); it != end(); ++it) {
+        if (next_victim < victims.size() && victims[next_victim] == it.current_)
+          ++next_victim;
+        else
+          survivors.push_back(it.current_);
       }
+      for (Node *victim : victims) destroy_node(victim);
+      root_ = build(survivors, 0, survivors.size(), nullptr);
+      size_ = survivors.size();
+    } else {
+      for (Node *victim : victims) remove_node(victim);
     }
+    return victims.size();
+  }
 
-    Node *cell = new Node(key, value, parent);
-    if (parent == nullptr) {
-      root_ = cell;
-    } else if (key < parent->key_) {
-      parent->left_ = cell;
+  // Оставляет ключи < key в left, остальные в right. Узлы не копируются,
+  // *this становится пустым.
+  void split_tree(const K &key, AVLTree &left, AVLTree &right) {
+    if (!(left.node_alloc_ == node_alloc_ && right.node_alloc_ == node_alloc_))
+      throw std::invalid_argument("SplitError: allocators differ");
+    std::pair<Node *, Node *> parts = split(root_, key);
+    root_ = nullptr;
+    size_ = 0;
+    left.clear();
+    right.clear();
+    left.root_ = parts.first;
+    left.size_ = weight(parts.first);
+    right.root_ = parts.second;
+    right.size_ = weight(parts.second);
+  }
+
+  // Склеивает left и right, если все ключи left меньше ключей right
+  // (или не больше при allow_equal). Оба дерева становятся пустыми.
+  void join_tree(AVLTree &left, AVLTree &right, bool allow_equal) {
+    if (!(left.node_alloc_ == node_alloc_ && right.node_alloc_ == node_alloc_))
+      throw std::invalid_argument("JoinError: allocators differ");
+    if (left.root_ != nullptr && right.root_ != nullptr) {
+      const K &left_max = max(left.root_)->key_;
+      const K &right_min = min(right.root_)->key_;
+      if (allow_equal ? right_min < left_max : !(left_max < right_min))
+        throw std::invalid_argument("JoinError: key ranges overlap");
+    }
+    clear();
+    if (left.root_ == nullptr || right.root_ == nullptr) {
+      AVLTree &source = left.root_ == nullptr ? right : left;
+      std::swap(root_, source.root_);
+      std::swap(size_, source.size_);
     } else {
-      parent->right_ = cell;
+      Node *middle = max(left.root_);
+      left.unlink_node(middle);
+      root_ = join(left.root_, middle, right.root_);
+      size_ = weight(root_);
+      left.root_ = right.root_ = nullptr;
     }
-    size_++;
+    left.size_ = right.size_ = 0;
   }
 
  private:
+  Node *create_node(const K &key, const V &value, Node *parent) {
+    Node *node = node_traits::allocate(node_alloc_, 1);
+    try {
+      node_traits::construct(node_alloc_, node, key, value, parent);
+    } catch (...) {
+      node_traits::deallocate(node_alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroy_node(Node *node) noexcept {
+    node_traits::destroy(node_alloc_, node);
+    node_traits::deallocate(node_alloc_, node, 1);
+  }
+
   Node *copy_tree(Node *node, Node *parent) {
     if (node == nullptr) return nullptr;
-    Node *new_node = new Node(node->key_, node->value_, parent);
+    Node *new_node = create_node(node->key_, node->value_, parent);
+    new_node->height_ = node->height_;
+    new_node->weight_ = node->weight_;
     new_node->left_ = copy_tree(node->left_, new_node);
     new_node->right_ = copy_tree(node->right_, new_node);
     return new_node;
@@ -452,15 +502,191 @@ class AVLTree {
 
   AVLTree create_tmp_tree() { return AVLTree(*this); }
 
-  void change_link(Node *current, Node *tmp, int flag) {
-    current->value_ = tmp->value_;
-    current->key_ = tmp->key_;
-    if (flag) {
-      current->left_ = tmp->left_;
+  static int height(const Node *node) { return node ? node->height_ : 0; }
+
+  static size_type weight(const Node *node) {
+    return node ? node->weight_ : 0;
+  }
+
+  static void update(Node *node) {
+    node->height_ = std::max(height(node->left_), height(node->right_)) + 1;
+    node->weight_ = weight(node->left_) + weight(node->right_) + 1;
+  }
+
+  static void replace_in_parent(Node *node, Node *replacement) {
+    Node *parent = node->parent_;
+    if (parent != nullptr) {
+      if (parent->left_ == node)
+        parent->left_ = replacement;
+      else
+        parent->right_ = replacement;
+    }
+  }
+
+  static Node *rotate_left(Node *node) {
+    Node *pivot = node->right_;
+    node->right_ = pivot->left_;
+    if (pivot->left_) pivot->left_->parent_ = node;
+    pivot->parent_ = node->parent_;
+    replace_in_parent(node, pivot);
+    pivot->left_ = node;
+    node->parent_ = pivot;
+    update(node);
+    update(pivot);
+    return pivot;
+  }
+
+  static Node *rotate_right(Node *node) {
+    Node *pivot = node->left_;
+    node->left_ = pivot->right_;
+    if (pivot->right_) pivot->right_->parent_ = node;
+    pivot->parent_ = node->parent_;
+    replace_in_parent(node, pivot);
+    pivot->right_ = node;
+    node->parent_ = pivot;
+    update(node);
+    update(pivot);
+    return pivot;
+  }
+
+  // Возвращает корень поддерева после поворота.
+  static Node *balance(Node *node) {
+    update(node);
+    int factor = height(node->left_) - height(node->right_);
+    if (factor > 1) {
+      if (height(node->left_->left_) < height(node->left_->right_))
+        rotate_left(node->left_);
+      return rotate_right(node);
+    }
+    if (factor < -1) {
+      if (height(node->right_->right_) < height(node->right_->left_))
+        rotate_right(node->right_);
+      return rotate_left(node);
+    }
+    return node;
+  }
+
+  // Балансирует путь до корня и возвращает новый корень.
+  static Node *rebalance_up(Node *node) {
+    Node *top = node;
+    while (node != nullptr) {
+      top = balance(node);
+      node = top->parent_;
+    }
+    return top;
+  }
+
+  void link_node(Node *cell, Node *parent) {
+    if (parent == nullptr) {
+      root_ = cell;
     } else {
-      current->right_ = tmp->right_;
+      if (cell->key_ < parent->key_)
+        parent->left_ = cell;
+      else
+        parent->right_ = cell;
+      root_ = rebalance_up(parent);
     }
-    tmp->parent_ = current;
+    size_++;
+  }
+
+  // Выводит узел из дерева, не удаляя его.
+  void unlink_node(Node *node) {
+    Node *from = node->parent_;
+    Node *replacement = nullptr;
+    if (node->left_ == nullptr || node->right_ == nullptr) {
+      replacement = node->left_ ? node->left_ : node->right_;
+      if (replacement) replacement->parent_ = node->parent_;
+    } else {
+      replacement = min(node->right_);
+      if (replacement->parent_ != node) {
+        from = replacement->parent_;
+        from->left_ = replacement->right_;
+        if (replacement->right_) replacement->right_->parent_ = from;
+        replacement->right_ = node->right_;
+        replacement->right_->parent_ = replacement;
+      } else {
+        from = replacement;
+      }
+      replacement->left_ = node->left_;
+      replacement->left_->parent_ = replacement;
+      replacement->parent_ = node->parent_;
+    }
+    replace_in_parent(node, replacement);
+    if (node == root_) root_ = replacement;
+    if (from != nullptr) root_ = rebalance_up(from);
+    node->parent_ = node->left_ = node->right_ = nullptr;
+    size_--;
+  }
+
+  void remove_node(Node *node) {
+    unlink_node(node);
+    destroy_node(node);
+  }
+
+  // Все ключи left меньше ключа middle, а он меньше ключей right.
+  static Node *join(Node *left, Node *middle, Node *right) {
+    if (height(left) > height(right) + 1) {
+      Node *parent = nullptr;
+      Node *spine = left;
+      while (height(spine) > height(right) + 1) {
+        parent = spine;
+        spine = spine->right_;
+      }
+      attach(middle, spine, right);
+      middle->parent_ = parent;
+      parent->right_ = middle;
+      return rebalance_up(parent);
+    }
+    if (height(right) > height(left) + 1) {
+      Node *parent = nullptr;
+      Node *spine = right;
+      while (height(spine) > height(left) + 1) {
+        parent = spine;
+        spine = spine->left_;
+      }
+      attach(middle, left, spine);
+      middle->parent_ = parent;
+      parent->left_ = middle;
+      return rebalance_up(parent);
+    }
+    attach(middle, left, right);
+    middle->parent_ = nullptr;
+    return middle;
+  }
+
+  static void attach(Node *node, Node *left, Node *right) {
+    node->left_ = left;
+    node->right_ = right;
+    if (left) left->parent_ = node;
+    if (right) right->parent_ = node;
+    update(node);
+  }
+
+  // Строит идеально сбалансированное дерево из узлов, упорядоченных по ключу.
+  static Node *build(std::vector<Node *> &nodes, size_type first,
+                     size_type last, Node *parent) {
+    if (first >= last) return nullptr;
+    size_type middle = first + (last - first) / 2;
+    Node *node = nodes[middle];
+    node->parent_ = parent;
+    node->left_ = build(nodes, first, middle, node);
+    node->right_ = build(nodes, middle + 1, last, node);
+    update(node);
+    return node;
+  }
+
+  static std::pair<Node *, Node *> split(Node *node, const K &key) {
+    if (node == nullptr) return {nullptr, nullptr};
+    Node *left = node->left_;
+    Node *right = node->right_;
+    if (left) left->parent_ = nullptr;
+    if (right) right->parent_ = nullptr;
+    if (node->key_ < key) {
+      std::pair<Node *, Node *> parts = split(right, key);
+      return {join(left, node, parts.first), parts.second};
+    }
+    std::pair<Node *, Node *> parts = split(left, key);
+    return {parts.first, join(parts.second, node, right)};
   }
 
   bool find_bool(K key) {
@@ -509,7 +735,7 @@ class AVLTree {
     if (*node != nullptr) {
       clear(&((*node)->left_));
       clear(&(*node)->right_);
-      delete *node;
+      destroy_node(*node);
       *node = nullptr;
     }
   }
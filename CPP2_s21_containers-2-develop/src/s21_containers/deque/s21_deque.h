@@ -2,26 +2,33 @@
 #define CPP2_S21_CONTAINERS_S21_CONTAINERS_DEQUE_DEQUE_H_
 
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <utility>
 
 namespace s21 {
 
-template <class T>
+template <class T, class Allocator = std::allocator<T>>
 class deque {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using size_type = std::size_t;
 
   deque();
+  explicit deque(const allocator_type &alloc);
   ~deque();
-  deque(std::initializer_list<value_type> const &items);
+  deque(std::initializer_list<value_type> const &items,
+        const allocator_type &alloc = allocator_type());
   deque(const deque &other);
   deque(deque &&other);
 
   void push_front(const_reference data);
   void pop_front();
   void push_back(const_reference data);
+  void push_back(value_type &&data);
   void pop_back();
 
   const_reference front() const;
@@ -30,29 +37,54 @@ class deque {
   bool empty() const;
   size_type size() const;
 
+  // Аллокаторы обмениваются при propagate_on_container_swap; иначе они
+  // должны быть равны.
   void swap(deque &other);
 
   void clear();
 
   deque &operator=(const deque &other);
-  deque &operator=(deque &&other) noexcept;
+  deque &operator=(deque &&other) noexcept(
+      std::allocator_traits<Allocator>::is_always_equal::value ||
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value);
+
+  allocator_type get_allocator() const;
 
   template <typename... Args>
   void insert_many_back(Args &&...args);
 
+  template <typename Pred>
+  size_type erase_if(Pred pred);
+
  protected:
   struct Node {
     T value;
     Node *next = nullptr;
     Node *prev = nullptr;
 
-    Node(T val = T(), Node *next_node = nullptr, Node *prev_node = nullptr)
-        : value(val), next(next_node), prev(prev_node) {}
+    template <typename U>
+    Node(U &&val, Node *next_node, Node *prev_node)
+        : value(std::forward<U>(val)), next(next_node), prev(prev_node) {}
   };
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  template <typename U>
+  Node *create_node(U &&data, Node *next_node, Node *prev_node);
+  void destroy_node(Node *node) noexcept;
+
+  node_allocator node_alloc_;
   size_t size_ = 0;
   Node *head = nullptr;
   Node *tail = nullptr;
 };
+
+namespace pmr {
+template <class T>
+using deque = s21::deque<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #include "s21_deque.tpp"
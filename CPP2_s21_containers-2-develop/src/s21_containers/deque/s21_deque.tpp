@@ -1,20 +1,28 @@
 namespace s21 {
-template <class T>
-deque<T>::deque() {
+template <class T, class Allocator>
+deque<T, Allocator>::deque() {
   size_ = 0;
   head = nullptr;
   tail = nullptr;
 }
 
-template <class T>
-deque<T>::deque(std::initializer_list<T> const &items) : deque() {
+template <class T, class Allocator>
+deque<T, Allocator>::deque(const allocator_type &alloc) : node_alloc_(alloc) {}
+
+template <class T, class Allocator>
+deque<T, Allocator>::deque(std::initializer_list<T> const &items,
+                           const allocator_type &alloc)
+    : deque(alloc) {
   for (const auto &item : items) {
     push_back(item);
   }
 }
 
-template <class T>
-deque<T>::deque(const deque &other) : deque() {
+template <class T, class Allocator>
+deque<T, Allocator>::deque(const deque &other)
+    : deque(allocator_type(
+          node_traits::select_on_container_copy_construction(
+              other.node_alloc_))) {
   Node *current = other.head;  // Start from the head of the other deque
   while (current) {
     push_back(current->value);  // Copy each element
@@ -22,22 +30,37 @@ deque<T>::deque(const deque &other) : deque() {
   }
 }
 
-template <class T>
-deque<T>::deque(deque &&other)
-    : size_(other.size_), head(other.head), tail(other.tail) {
+template <class T, class Allocator>
+deque<T, Allocator>::deque(deque &&other)
+    : node_alloc_(std::move(other.node_alloc_)),
+      size_(other.size_),
+      head(other.head),
+      tail(other.tail) {
   other.size_ = 0;
   other.head = nullptr;
   other.tail = nullptr;
 }
 
-template <class T>
-deque<T>::~deque() {
+template <class T, class Allocator>
+deque<T, Allocator>::~deque() {
   while (head) pop_front();
 }
 
-template <class T>
-void deque<T>::push_back(const_reference data) {
-  Node *newNode = new Node(data, nullptr, tail);
+template <class T, class Allocator>
+void deque<T, Allocator>::push_back(const_reference data) {
+  Node *newNode = create_node(data, nullptr, tail);
+
+  if (tail != nullptr)
+    tail->next = newNode;
+  else
+    head = newNode;
+  tail = newNode;
+  size_++;
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::push_back(value_type &&data) {
+  Node *newNode = create_node(std::move(data), nullptr, tail);
 
   if (tail != nullptr)
     tail->next = newNode;
@@ -47,9 +70,9 @@ void deque<T>::push_back(const_reference data) {
   size_++;
 }
 
-template <class T>
-void deque<T>::push_front(const_reference data) {
-  Node *newNode = new Node(data, head, nullptr);
+template <class T, class Allocator>
+void deque<T, Allocator>::push_front(const_reference data) {
+  Node *newNode = create_node(data, head, nullptr);
 
   if (head != nullptr)
     head->prev = newNode;
@@ -59,8 +82,8 @@ void deque<T>::push_front(const_reference data) {
   size_++;
 }
 
-template <class T>
-void deque<T>::pop_front() {
+template <class T, class Allocator>
+void deque<T, Allocator>::pop_front() {
   if (!head) throw std::out_of_range("Deque is empty. Cannot pop front.");
   Node *temp = head;
   head = head->next;
@@ -68,12 +91,12 @@ void deque<T>::pop_front() {
     head->prev = nullptr;  // Убираем некорректное обращение к head->prev->prev
   else
     tail = nullptr;
-  delete temp;
+  destroy_node(temp);
   size_--;
 }
 
-template <class T>
-void deque<T>::pop_back() {
+template <class T, class Allocator>
+void deque<T, Allocator>::pop_back() {
   if (!tail) throw std::out_of_range("Deque is empty. Cannot pop back.");
   Node *temp = tail;
   tail = tail->prev;
@@ -81,40 +104,47 @@ void deque<T>::pop_back() {
     tail->next = nullptr;
   else
     head = nullptr;
-  delete temp;
+  destroy_node(temp);
   size_--;
 }
 
-template <class T>
-void deque<T>::swap(deque &other) {
+template <class T, class Allocator>
+void deque<T, Allocator>::swap(deque &other) {
   std::swap(size_, other.size_);
   std::swap(head, other.head);
   std::swap(tail, other.tail);
+  if constexpr (node_traits::propagate_on_container_swap::value)
+    std::swap(node_alloc_, other.node_alloc_);
 }
 
-template <class T>
-const T &deque<T>::front() const {
+template <class T, class Allocator>
+const T &deque<T, Allocator>::front() const {
   if (empty()) throw std::out_of_range("conteiner is empty");
   return head->value;
 }
-template <class T>
-const T &deque<T>::back() const {
+template <class T, class Allocator>
+const T &deque<T, Allocator>::back() const {
   if (empty()) throw std::out_of_range("conteiner is empty");
   return tail->value;
 }
 
-template <class T>
-typename deque<T>::size_type deque<T>::size() const {
+template <class T, class Allocator>
+typename deque<T, Allocator>::size_type deque<T, Allocator>::size() const {
   return size_;
 }
 
-template <class T>
-bool deque<T>::empty() const {
+template <class T, class Allocator>
+bool deque<T, Allocator>::empty() const {
   return head == nullptr;
 }
 
-template <class T>
-deque<T> &deque<T>::operator=(const deque &other) {
+template <class T, class Allocator>
+void deque<T, Allocator>::clear() {
+  while (head) pop_front();
+}
+
+template <class T, class Allocator>
+deque<T, Allocator> &deque<T, Allocator>::operator=(const deque &other) {
   if (this != &other) {
     while (!empty()) {
       pop_front();
@@ -128,26 +158,100 @@ deque<T> &deque<T>::operator=(const deque &other) {
   return *this;
 }
 
-template <class T>
-deque<T> &deque<T>::operator=(deque &&other) noexcept {
+// Узлы забираются, только если аллокаторы совместимы; иначе элементы
+// перемещаются поштучно в память своего аллокатора.
+template <class T, class Allocator>
+deque<T, Allocator> &deque<T, Allocator>::operator=(deque &&other) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value) {
   if (this != &other) {
     while (!empty()) {
       pop_front();
     }
-    size_ = other.size_;
-    head = other.head;
-    tail = other.tail;
-    other.size_ = 0;
-    other.head = nullptr;
-    other.tail = nullptr;
+    if (node_traits::propagate_on_container_move_assignment::value ||
+        node_alloc_ == other.node_alloc_) {
+      if constexpr (node_traits::propagate_on_container_move_assignment::value)
+        node_alloc_ = std::move(other.node_alloc_);
+      size_ = other.size_;
+      head = other.head;
+      tail = other.tail;
+      other.size_ = 0;
+      other.head = nullptr;
+      other.tail = nullptr;
+    } else {
+      while (!other.empty()) {
+        push_back(std::move(other.head->value));
+        other.pop_front();
+      }
+    }
   }
   return *this;
 }
 
-template <class T>
+template <class T, class Allocator>
+typename deque<T, Allocator>::allocator_type
+deque<T, Allocator>::get_allocator() const {
+  return allocator_type(node_alloc_);
+}
+
+template <class T, class Allocator>
 template <typename... Args>
-void deque<T>::insert_many_back(Args &&...args) {
+void deque<T, Allocator>::insert_many_back(Args &&...args) {
   (push_back(std::forward<Args>(args)), ...);
 }
 
+template <class T, class Allocator>
+template <typename Pred>
+typename deque<T, Allocator>::size_type
+deque<T, Allocator>::erase_if(Pred pred) {
+  size_type removed = 0;
+  Node *current = head;
+  while (current) {
+    Node *next = current->next;
+    if (pred(static_cast<const_reference>(current->value))) {
+      if (current->prev)
+        current->prev->next = next;
+      else
+        head = next;
+      if (next)
+        next->prev = current->prev;
+      else
+        tail = current->prev;
+      destroy_node(current);
+      --size_;
+      ++removed;
+    }
+    current = next;
+  }
+  return removed;
+}
+
+template <class T, class Allocator>
+template <typename U>
+typename deque<T, Allocator>::Node *deque<T, Allocator>::create_node(
+    U &&data, Node *next_node, Node *prev_node) {
+  Node *node = node_traits::allocate(node_alloc_, 1);
+  try {
+    node_traits::construct(node_alloc_, node, std::forward<U>(data),
+                           next_node, prev_node);
+  } catch (...) {
+    node_traits::deallocate(node_alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <class T, class Allocator>
+void deque<T, Allocator>::destroy_node(Node *node) noexcept {
+  node_traits::destroy(node_alloc_, node);
+  node_traits::deallocate(node_alloc_, node, 1);
+}
+
+template <class T, class Allocator, typename Pred>
+typename deque<T, Allocator>::size_type erase_if(deque<T, Allocator> &d,
+                                                 Pred pred) {
+  return d.erase_if(pred);
+}
+
 }  // namespace s21
\ No newline at end of file
@@ -4,14 +4,19 @@
 #include <cstddef>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <utility>
 
+#include "../s21_checked.h"
+
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using size_type = std::size_t;
@@ -21,7 +26,7 @@ class list {
     Node *next;
     value_type data_;
     Node(value_type data = value_type())
-        : prev(nullptr), next(nullptr), data_(data) {}
+        : prev(nullptr), next(nullptr), data_(std::move(data)) {}
   };
 
   template <bool Const>
@@ -36,33 +41,57 @@ class list {
 
     listIterator() : node_(nullptr) {}
     explicit listIterator(node_pointer node) : node_(node) {}
+    // sentinel нужен только проверочной сборке: разыменовать end() или
+    // шагнуть вперёд с него нельзя.
+    listIterator(node_pointer node, [[maybe_unused]] node_pointer sentinel)
+        : node_(node)
+#ifdef S21_CHECKED
+          ,
+          sentinel_(sentinel)
+#endif
+    {
+    }
 
     template <bool OtherConst>
     constexpr listIterator(const listIterator<OtherConst> &other) noexcept
-        : node_(const_cast<node_pointer>(other.node_)) {}
+        : node_(const_cast<node_pointer>(other.node_))
+#ifdef S21_CHECKED
+          ,
+          sentinel_(const_cast<node_pointer>(other.sentinel_))
+#endif
+    {
+    }
 
-    reference operator*() const { return node_->data_; }
-    pointer operator->() const { return &(node_->data_); }
+    reference operator*() const {
+      check_dereferenceable();
+      return node_->data_;
+    }
+    pointer operator->() const {
+      check_dereferenceable();
+      return &(node_->data_);
+    }
 
     listIterator &operator++() {
+      check_dereferenceable();
       node_ = node_->next;
       return *this;
     }
 
     listIterator operator++(int) {
       listIterator temp = *this;
-      node_ = node_->next;
+      ++*this;
       return temp;
     }
 
     listIterator &operator--() {
+      S21_CHECK(node_ != nullptr, "listIterator: singular iterator");
       node_ = node_->prev;
       return *this;
     }
 
     listIterator operator--(int) {
       listIterator temp = *this;
-      node_ = node_->prev;
+      --*this;
       return temp;
     }
 
@@ -75,23 +104,46 @@ class list {
 
     node_pointer get_node() const { return node_; }
 
+#ifdef S21_CHECKED
+    node_pointer get_sentinel() const { return sentinel_; }
+#endif
+
    private:
     template <bool OtherConst>
     friend class listIterator;
 
+    void check_dereferenceable() const {
+      S21_CHECK(node_ != nullptr, "listIterator: singular iterator");
+#ifdef S21_CHECKED
+      S21_CHECK(node_ != sentinel_,
+                "listIterator: end() is not dereferenceable");
+#endif
+    }
+
     node_pointer node_;
+#ifdef S21_CHECKED
+    node_pointer sentinel_ = nullptr;
+#endif
   };
 
   using iterator = listIterator<false>;
   using const_iterator = listIterator<true>;
 
   list();
-  list(size_type n);
-  list(std::initializer_list<value_type> const &items);
+  explicit list(const allocator_type &alloc);
+  list(size_type n, const allocator_type &alloc = allocator_type());
+  list(std::initializer_list<value_type> const &items,
+       const allocator_type &alloc = allocator_type());
   list(const list &l);
-  list(list &&l) noexcept;
+  // Не noexcept: исходному списку выделяется новый узел-страж.
+  list(list &&l);
   ~list();
-  list &operator=(list &&l) noexcept;
+  list &operator=(list &&l) noexcept(
+      std::allocator_traits<Allocator>::is_always_equal::value ||
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value);
+
+  allocator_type get_allocator() const;
 
   const_reference front() const;
   const_reference back() const;
@@ -112,6 +164,8 @@ class list {
   void pop_back();
   void push_front(const_reference value);
   void pop_front();
+  // Аллокаторы обмениваются при propagate_on_container_swap; иначе они
+  // должны быть равны.
   void swap(list &other) noexcept;
   void merge(list &other);
   void splice(const_iterator pos, list &other);
@@ -126,44 +180,65 @@ class list {
   template <class... Args>
   void insert_many_front(Args &&...args);
 
+  template <typename Pred>
+  size_type erase_if(Pred pred);
+
  protected:
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator node_alloc_;
   Node *head_;
   size_type size_;
 
+  template <class... Args>
+  Node *create_node(Args &&...args);
+  void destroy_node(Node *node) noexcept;
+
   Node *merge_sort(Node *head);
   Node *merge_sorted(Node *left, Node *right);
+  void check_owner(const_iterator pos) const;
 };
 
-template <class value_type>
-list<value_type>::list() : size_(0U) {
-  Node *ptr = new Node(value_type());
+template <class value_type, typename Allocator>
+list<value_type, Allocator>::list() : list(allocator_type()) {}
+
+template <class value_type, typename Allocator>
+list<value_type, Allocator>::list(const allocator_type &alloc)
+    : node_alloc_(alloc), size_(0U) {
+  Node *ptr = create_node(value_type());
   head_ = ptr;
   head_->next = ptr;
   head_->prev = ptr;
 }
 
-template <typename value_type>
-list<value_type>::list(size_type n) : list() {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(size_type n, const allocator_type &alloc)
+    : list(alloc) {
   for (size_type i = 0; i < n; ++i) {
     push_back(value_type());
   }
 }
 
-template <typename value_type>
-list<value_type>::list(std::initializer_list<value_type> const &items)
-    : list() {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(
+    std::initializer_list<value_type> const &items, const allocator_type &alloc)
+    : list(alloc) {
   for (const auto &it : items) {
     push_back(it);
   }
 }
 
-template <typename value_type>
-list<value_type>::list(const list &l) : list() {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(const list &l)
+    : list(allocator_type(
+          node_traits::select_on_container_copy_construction(l.node_alloc_))) {
   if (l.head_ != nullptr) {
     Node *current = l.head_->next;
     Node *last = head_;
     while (current != l.head_) {
-      Node *new_node = new Node(current->data_);
+      Node *new_node = create_node(current->data_);
       last->next = new_node;
       new_node->prev = last;
       last = new_node;
@@ -175,147 +250,184 @@ list<value_type>::list(const list &l) : list() {
   }
 }
 
-template <typename value_type>
-list<value_type>::list(list &&l) noexcept : head_(l.head_), size_(l.size_) {
-  l.head_ = new Node();
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(list &&l)
+    : node_alloc_(l.node_alloc_), head_(l.create_node()), size_(0U) {
+  std::swap(head_, l.head_);
+  std::swap(size_, l.size_);
   l.head_->next = l.head_;
   l.head_->prev = l.head_;
-  l.size_ = 0;
 }
 
-template <typename value_type>
-list<value_type>::~list() {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::~list() {
   clear();
-  delete head_;
-}
-
-template <typename value_type>
-list<value_type> &list<value_type>::operator=(list &&v) noexcept {
+  destroy_node(head_);
+}
+
+// Узлы забираются, только если память общая; иначе элементы перемещаются
+// поштучно. Исходный список остаётся пустым, но пригодным. При
+// propagate_on_container_move_assignment аллокаторы обмениваются вместе
+// со стражами, чтобы каждый страж освободил выделивший его аллокатор.
+template <typename value_type, typename Allocator>
+list<value_type, Allocator> &
+list<value_type, Allocator>::operator=(list &&v) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value) {
   if (this != &v) {
     clear();
-    head_ = v.head_;
-    size_ = v.size_;
-    v.head_ = nullptr;
-    v.size_ = 0;
+    if (node_traits::propagate_on_container_move_assignment::value ||
+        node_alloc_ == v.node_alloc_) {
+      if constexpr (node_traits::propagate_on_container_move_assignment::value)
+        std::swap(node_alloc_, v.node_alloc_);
+      std::swap(head_, v.head_);
+      std::swap(size_, v.size_);
+    } else {
+      for (auto &item : v) {
+        Node *node = create_node(std::move(item));
+        node->prev = head_->prev;
+        node->next = head_;
+        head_->prev->next = node;
+        head_->prev = node;
+        ++size_;
+      }
+      v.clear();
+    }
   }
   return *this;
 }
 
-template <typename value_type>
-typename list<value_type>::const_reference list<value_type>::front() const {
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::allocator_type
+list<value_type, Allocator>::get_allocator() const {
+  return allocator_type(node_alloc_);
+}
+
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::const_reference
+list<value_type, Allocator>::front() const {
   if (empty()) {
     throw std::out_of_range("list is empty");
   }
   return head_->next->data_;
 }
 
-template <typename value_type>
-typename list<value_type>::const_reference list<value_type>::back() const {
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::const_reference
+list<value_type, Allocator>::back() const {
   if (empty()) {
     throw std::out_of_range("list is empty");
   }
   return head_->prev->data_;
 }
 
-template <typename value_type>
-typename list<value_type>::iterator list<value_type>::begin() noexcept {
-  return iterator(head_->next);
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::begin() noexcept {
+  return iterator(head_->next, head_);
 }
 
-template <typename value_type>
-typename list<value_type>::iterator list<value_type>::end() noexcept {
-  return iterator(head_);
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::end() noexcept {
+  return iterator(head_, head_);
 }
 
-template <typename value_type>
-typename list<value_type>::const_iterator list<value_type>::cbegin()
-    const noexcept {
-  return const_iterator(head_->next);
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::const_iterator
+list<value_type, Allocator>::cbegin() const noexcept {
+  return const_iterator(head_->next, head_);
 }
 
-template <typename value_type>
-typename list<value_type>::const_iterator list<value_type>::cend()
-    const noexcept {
-  return const_iterator(head_);
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::const_iterator
+list<value_type, Allocator>::cend() const noexcept {
+  return const_iterator(head_, head_);
 }
 
-template <typename value_type>
-bool list<value_type>::empty() const noexcept {
+template <typename value_type, typename Allocator>
+bool list<value_type, Allocator>::empty() const noexcept {
   return size_ == 0;
 }
 
-template <typename value_type>
-typename list<value_type>::size_type list<value_type>::size() const noexcept {
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::size_type
+list<value_type, Allocator>::size() const noexcept {
   return size_;
 }
 
-template <typename value_type>
-typename list<value_type>::size_type list<value_type>::max_size()
-    const noexcept {
-  return std::allocator<Node>().max_size();
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::size_type
+list<value_type, Allocator>::max_size() const noexcept {
+  return node_traits::max_size(node_alloc_);
 }
 
-template <typename value_type>
-void list<value_type>::clear() noexcept {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::clear() noexcept {
   while (size_ > 0) {
     pop_front();
   }
 }
 
-template <typename value_type>
-typename list<value_type>::iterator list<value_type>::insert(
-    iterator pos, const_reference value) {
-  Node *new_node = new Node(value);
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::insert(iterator pos, const_reference value) {
+  check_owner(pos);
+  Node *new_node = create_node(value);
   Node *next_node = pos.get_node();
   new_node->prev = next_node->prev;
   new_node->next = next_node;
   next_node->prev->next = new_node;
   next_node->prev = new_node;
   ++size_;
-  return iterator(new_node);
+  return iterator(new_node, head_);
 }
 
-template <typename value_type>
-void list<value_type>::erase(iterator pos) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::erase(iterator pos) {
   if (pos == end()) {
     throw std::invalid_argument("Cannot erase end iterator.");
   }
+  check_owner(pos);
 
   Node *to_erase = pos.get_node();
   to_erase->prev->next = to_erase->next;
   to_erase->next->prev = to_erase->prev;
-  delete to_erase;
+  destroy_node(to_erase);
   --size_;
 }
 
-template <typename value_type>
-void list<value_type>::push_back(const_reference value) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::push_back(const_reference value) {
   insert(end(), value);
 }
 
-template <typename value_type>
-void list<value_type>::pop_back() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::pop_back() {
   erase(--end());
 }
 
-template <typename value_type>
-void list<value_type>::push_front(const_reference value) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::push_front(const_reference value) {
   insert(begin(), value);
 }
 
-template <typename value_type>
-void list<value_type>::pop_front() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::pop_front() {
   erase(begin());
 }
 
-template <typename value_type>
-void list<value_type>::swap(list &other) noexcept {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::swap(list &other) noexcept {
   std::swap(head_, other.head_);
   std::swap(size_, other.size_);
+  if constexpr (node_traits::propagate_on_container_swap::value)
+    std::swap(node_alloc_, other.node_alloc_);
 }
 
-template <typename value_type>
-void list<value_type>::merge(list &other) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::merge(list &other) {
   if (this != &other) {
     iterator this_iter = begin();
     iterator other_iter = other.begin();
@@ -330,8 +442,9 @@ void list<value_type>::merge(list &other) {
   }
 }
 
-template <typename value_type>
-void list<value_type>::splice(const_iterator pos, list &other) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::splice(const_iterator pos, list &other) {
+  check_owner(pos);
   if (other.empty()) return;
 
   Node *previous = pos.get_node()->prev;
@@ -350,8 +463,8 @@ void list<value_type>::splice(const_iterator pos, list &other) {
   other.size_ = 0;
 }
 
-template <typename value_type>
-void list<value_type>::reverse() noexcept {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::reverse() noexcept {
   Node *current = head_;
   do {
     std::swap(current->next, current->prev);
@@ -359,8 +472,8 @@ void list<value_type>::reverse() noexcept {
   } while (current != head_);
 }
 
-template <typename value_type>
-void list<value_type>::unique() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::unique() {
   if (size_ > 1) {
     iterator current = begin();
     iterator next = current;
@@ -378,10 +491,10 @@ void list<value_type>::unique() {
   }
 }
 
-template <class value_type>
+template <class value_type, typename Allocator>
 template <class... Args>
-typename list<value_type>::iterator list<value_type>::insert_many(
-    const_iterator pos, Args &&...args) {
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::insert_many(const_iterator pos, Args &&...args) {
   iterator index = pos;
   iterator first_inserted = index;
   bool is_first = true;
@@ -393,24 +506,53 @@ typename list<value_type>::iterator list<value_type>::insert_many(
   return first_inserted;
 }
 
-template <class value_type>
+template <class value_type, typename Allocator>
 template <class... Args>
-void list<value_type>::insert_many_back(Args &&...args) {
+void list<value_type, Allocator>::insert_many_back(Args &&...args) {
   (push_back(std::forward<Args>(args)), ...);
 }
 
-template <class value_type>
+template <class value_type, typename Allocator>
 template <class... Args>
-void list<value_type>::insert_many_front(Args &&...args) {
-  list<value_type> tmp{std::forward<Args>(args)...};
+void list<value_type, Allocator>::insert_many_front(Args &&...args) {
+  list tmp({std::forward<Args>(args)...}, get_allocator());
   tmp.reverse();
   for (const auto &item : tmp) {
     push_front(item);
   }
 }
 
-template <typename value_type>
-void list<value_type>::sort() {
+template <typename value_type, typename Allocator>
+template <typename Pred>
+typename list<value_type, Allocator>::size_type
+list<value_type, Allocator>::erase_if(Pred pred) {
+  size_type removed = 0U;
+  Node *current = head_->next;
+  while (current != head_) {
+    Node *next = current->next;
+    if (pred(static_cast<const_reference>(current->data_))) {
+      current->prev->next = next;
+      next->prev = current->prev;
+      destroy_node(current);
+      --size_;
+      ++removed;
+    }
+    current = next;
+  }
+  return removed;
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::check_owner(
+    [[maybe_unused]] const_iterator pos) const {
+#ifdef S21_CHECKED
+  S21_CHECK(pos.get_sentinel() == nullptr || pos.get_sentinel() == head_,
+            "list: iterator belongs to another list");
+#endif
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::sort() {
   if (size_ > 1) {
     Node *first_node = head_->next;
     Node *last_node = (--end()).get_node();
@@ -432,8 +574,9 @@ void list<value_type>::sort() {
   }
 }
 
-template <typename value_type>
-typename list<value_type>::Node *list<value_type>::merge_sort(Node *head) {
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::Node *
+list<value_type, Allocator>::merge_sort(Node *head) {
   if (head == nullptr || head->next == nullptr) {
     return head;
   }
@@ -450,9 +593,9 @@ typename list<value_type>::Node *list<value_type>::merge_sort(Node *head) {
   return merge_sorted(left, right);
 }
 
-template <typename value_type>
-typename list<value_type>::Node *list<value_type>::merge_sorted(Node *left,
-                                                                Node *right) {
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::Node *
+list<value_type, Allocator>::merge_sorted(Node *left, Node *right) {
   if (left == nullptr) {
     return right;
   }
@@ -476,6 +619,38 @@ typename list<value_type>::Node *list<value_type>::merge_sorted(Node *left,
   return result;
 }
 
+template <typename value_type, typename Allocator>
+template <class... Args>
+typename list<value_type, Allocator>::Node *
+list<value_type, Allocator>::create_node(Args &&...args) {
+  Node *node = node_traits::allocate(node_alloc_, 1);
+  try {
+    node_traits::construct(node_alloc_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(node_alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::destroy_node(Node *node) noexcept {
+  if (node == nullptr) return;
+  node_traits::destroy(node_alloc_, node);
+  node_traits::deallocate(node_alloc_, node, 1);
+}
+
+template <typename T, typename Allocator, typename Pred>
+typename list<T, Allocator>::size_type erase_if(list<T, Allocator> &l,
+                                                Pred pred) {
+  return l.erase_if(pred);
+}
+
+namespace pmr {
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // CPP2_S21_CONTAINERS_LIST_H
@@ -1,11 +1,16 @@
 #ifndef _S21_MAP_H_
 #define _S21_MAP_H_
 
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+
 #include "../AVLtree/AVLtree.h"
 
 namespace s21 {
-template <typename K, typename V>
-class map : public AVLTree<K, V> {
+template <typename K, typename V,
+          typename Allocator = std::allocator<std::pair<const K, V>>>
+class map : public AVLTree<K, V, Allocator> {
  public:
   class IteratorMap;
   class ConstIteratorMap;
@@ -13,34 +18,38 @@ class map : public AVLTree<K, V> {
   using key_type = K;
   using mapped_type = V;
   using value_type = std::pair<const key_type, mapped_type>;
+  using allocator_type = Allocator;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename AVLTree<K, V>::iterator;
-  using const_iterator = typename AVLTree<K, V>::const_iterator;
+  using iterator = typename AVLTree<K, V, Allocator>::iterator;
+  using const_iterator = typename AVLTree<K, V, Allocator>::const_iterator;
   using size_type = size_t;
 
   map();
-  map(std::initializer_list<value_type> const &items);
+  explicit map(const allocator_type &alloc);
+  map(std::initializer_list<value_type> const &items,
+      const allocator_type &alloc = allocator_type());
   map(const map &m_);
   map(map &&m_);
   ~map() = default;
 
   map &operator=(map &&m_);
 
-  class ConstIteratorMap : public AVLTree<K, V>::ConstIteratorTree {
+  class ConstIteratorMap : public AVLTree<K, V, Allocator>::ConstIteratorTree {
    public:
     friend class map;
-    ConstIteratorMap() : AVLTree<K, V>::ConstIteratorTree() {}
-    ConstIteratorMap(typename AVLTree<K, V>::Node *node)
-        : AVLTree<K, V>::ConstIteratorTree(node) {}
+    ConstIteratorMap() : AVLTree<K, V, Allocator>::ConstIteratorTree() {}
+    ConstIteratorMap(typename AVLTree<K, V, Allocator>::Node *node)
+        : AVLTree<K, V, Allocator>::ConstIteratorTree(node) {}
 
     std::pair<const K, V> operator*() {
-      return std::make_pair(AVLTree<K, V>::ConstIteratorTree::current_->key_,
-                            AVLTree<K, V>::ConstIteratorTree::current_->value_);
+      return std::make_pair(
+          AVLTree<K, V, Allocator>::ConstIteratorTree::current_->key_,
+          AVLTree<K, V, Allocator>::ConstIteratorTree::current_->value_);
     }
-    typename AVLTree<K, V>::ConstIteratorTree &operator=(
-        const typename AVLTree<K, V>::ConstIteratorTree &other) {
-      AVLTree<K, V>::ConstIteratorTree::operator=(other);
+    typename AVLTree<K, V, Allocator>::ConstIteratorTree &operator=(
+        const typename AVLTree<K, V, Allocator>::ConstIteratorTree &other) {
+      AVLTree<K, V, Allocator>::ConstIteratorTree::operator=(other);
       return *this;
     }
   };
@@ -48,10 +57,11 @@ class map : public AVLTree<K, V> {
   class IteratorMap : public ConstIteratorMap {
    public:
     IteratorMap() : ConstIteratorMap() {}
-    IteratorMap(typename AVLTree<K, V>::Node *node) : ConstIteratorMap(node) {}
+    IteratorMap(typename AVLTree<K, V, Allocator>::Node *node)
+        : ConstIteratorMap(node) {}
     std::pair<const K, V> operator*() { return ConstIteratorMap::operator*(); }
-    typename AVLTree<K, V>::ConstIteratorTree &operator=(
-        const typename AVLTree<K, V>::ConstIteratorTree &other) {
+    typename AVLTree<K, V, Allocator>::ConstIteratorTree &operator=(
+        const typename AVLTree<K, V, Allocator>::ConstIteratorTree &other) {
       ConstIteratorMap::operator=(other);
       return *this;
     }
@@ -59,7 +69,28 @@ class map : public AVLTree<K, V> {
 
   template <class... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  std::pair<map, map> split(const K &key);
+  static map join(map &&left, map &&right);
+
+  template <typename Pred>
+  size_type erase_if(
+      Pred pred,
+      double rebuild_ratio = AVLTree<K, V, Allocator>::kEraseRebuildRatio);
 };
+
+template <typename K, typename V, typename Allocator, typename Pred>
+typename map<K, V, Allocator>::size_type erase_if(
+    map<K, V, Allocator> &m, Pred pred,
+    double rebuild_ratio = AVLTree<K, V, Allocator>::kEraseRebuildRatio) {
+  return m.erase_if(pred, rebuild_ratio);
+}
+
+namespace pmr {
+template <typename K, typename V>
+using map =
+    s21::map<K, V, std::pmr::polymorphic_allocator<std::pair<const K, V>>>;
+}  // namespace pmr
 }  // namespace s21
 
 #include "s21_map.tpp"
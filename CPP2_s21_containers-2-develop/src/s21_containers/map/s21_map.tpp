@@ -1,35 +1,73 @@
 namespace s21 {
-template <typename K, typename V>
-map<K, V>::map() : AVLTree<K, V>() {}
+template <typename K, typename V, typename Allocator>
+map<K, V, Allocator>::map() : AVLTree<K, V, Allocator>() {}
 
-template <typename K, typename V>
-map<K, V>::map(std::initializer_list<value_type> const &items) {
+template <typename K, typename V, typename Allocator>
+map<K, V, Allocator>::map(const allocator_type &alloc)
+    : AVLTree<K, V, Allocator>(alloc) {}
+
+template <typename K, typename V, typename Allocator>
+map<K, V, Allocator>::map(std::initializer_list<value_type> const &items,
+                          const allocator_type &alloc)
+    : AVLTree<K, V, Allocator>(alloc) {
   for (const auto &item : items) {
-    AVLTree<K, V>::insert(item.first, item.second);
+    AVLTree<K, V, Allocator>::insert(item.first, item.second);
   }
 }
 
-template <typename K, typename V>
-map<K, V>::map(const map &m_) : AVLTree<K, V>(m_) {}
+template <typename K, typename V, typename Allocator>
+map<K, V, Allocator>::map(const map &m_) : AVLTree<K, V, Allocator>(m_) {}
 
-template <typename K, typename V>
-map<K, V>::map(map &&m_) : AVLTree<K, V>(std::move(m_)) {}
+template <typename K, typename V, typename Allocator>
+map<K, V, Allocator>::map(map &&m_) : AVLTree<K, V, Allocator>(std::move(m_)) {}
 
-template <typename K, typename V>
-map<K, V> &map<K, V>::operator=(map &&m_) {
+template <typename K, typename V, typename Allocator>
+map<K, V, Allocator> &map<K, V, Allocator>::operator=(map &&m_) {
   if (this != &m_) {
-    AVLTree<K, V>::operator=(std::move(m_));
+    AVLTree<K, V, Allocator>::operator=(std::move(m_));
   }
   return *this;
 }
 
-template <typename K, typename V>
+template <typename K, typename V, typename Allocator>
 template <class... Args>
-std::vector<std::pair<typename map<K, V>::iterator, bool>>
-map<K, V>::insert_many(Args &&...args) {
-  std::vector<std::pair<typename map<K, V>::iterator, bool>> v;
-  (v.push_back(AVLTree<K, V>::insert(args.first, args.second)), ...);
+std::vector<std::pair<typename map<K, V, Allocator>::iterator, bool>>
+map<K, V, Allocator>::insert_many(Args &&...args) {
+  std::vector<std::pair<typename map<K, V, Allocator>::iterator, bool>> v;
+  (v.push_back(AVLTree<K, V, Allocator>::insert(args.first, args.second)), ...);
   return v;
 }
 
+template <typename K, typename V, typename Allocator>
+std::pair<map<K, V, Allocator>, map<K, V, Allocator>>
+map<K, V, Allocator>::split(const K &key) {
+  std::pair<map, map> parts(map(this->get_allocator()),
+                            map(this->get_allocator()));
+  AVLTree<K, V, Allocator>::split_tree(key, parts.first, parts.second);
+  return parts;
+}
+
+// pred принимает либо (key, value), либо value_type.
+template <typename K, typename V, typename Allocator>
+template <typename Pred>
+typename map<K, V, Allocator>::size_type
+map<K, V, Allocator>::erase_if(Pred pred, double rebuild_ratio) {
+  return AVLTree<K, V, Allocator>::erase_nodes_if(
+      [&pred](const K &key, const V &value) {
+        if constexpr (std::is_invocable_v<Pred &, const K &, const V &>) {
+          return static_cast<bool>(pred(key, value));
+        } else {
+          return static_cast<bool>(pred(value_type(key, value)));
+        }
+      },
+      rebuild_ratio);
+}
+
+template <typename K, typename V, typename Allocator>
+map<K, V, Allocator> map<K, V, Allocator>::join(map &&left, map &&right) {
+  map result(left.get_allocator());
+  result.join_tree(left, right, false);
+  return result;
+}
+
 }  // namespace s21
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define CPP_S21_QUEUE_H
 
 #include <iostream>
+#include <memory>
+#include <type_traits>
 
 #include "../deque/s21_deque.h"
 
@@ -16,6 +18,13 @@ class queue {
 
   queue();
   queue(std::initializer_list<T> const &items);
+  // Конструкторы с аллокатором передают его нижележащему контейнеру.
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator<Container, Alloc>::value>>
+  explicit queue(const Alloc &alloc);
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator<Container, Alloc>::value>>
+  queue(std::initializer_list<T> const &items, const Alloc &alloc);
   queue(const queue &other);
   queue(queue &&other) noexcept;
   ~queue();
@@ -39,6 +48,11 @@ class queue {
  private:
   Container deque_;
 };
+
+namespace pmr {
+template <class T>
+using queue = s21::queue<T, s21::pmr::deque<T>>;
+}  // namespace pmr
 }  // namespace s21
 #include "s21_queue.tpp"
 #endif
@@ -10,6 +10,18 @@ queue<value_type, Container>::queue(
   for (const auto &item : items) push(item);
 }
 
+template <class value_type, class Container>
+template <class Alloc, class>
+queue<value_type, Container>::queue(const Alloc &alloc) : deque_(alloc) {}
+
+template <class value_type, class Container>
+template <class Alloc, class>
+queue<value_type, Container>::queue(
+    std::initializer_list<value_type> const &items, const Alloc &alloc)
+    : deque_(alloc) {
+  for (const auto &item : items) push(item);
+}
+
 template <class value_type, class Container>
 queue<value_type, Container>::queue(const queue &other)
     : deque_(other.deque_) {}
@@ -0,0 +1,32 @@
+#ifndef CPP2_S21_CONTAINERS_BITS_H
+#define CPP2_S21_CONTAINERS_BITS_H
+
+#include <cstdint>
+
+namespace s21 {
+namespace detail {
+// Счёт и поиск битов в 64-битном слове для битовых контейнеров. У GCC и
+// Clang это одна инструкция; у прочих компиляторов — переносимая замена.
+inline int popcount(std::uint64_t word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll(word);
+#else
+  word = word - ((word >> 1) & 0x5555555555555555ULL);
+  word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+  word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<int>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// Номер младшего установленного бита; word не должен быть нулём.
+inline int trailing_zeros(std::uint64_t word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  return popcount((word & (0 - word)) - 1);
+#endif
+}
+}  // namespace detail
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_BITS_H
@@ -0,0 +1,19 @@
+#ifndef CPP2_S21_CONTAINERS_CHECKED_H
+#define CPP2_S21_CONTAINERS_CHECKED_H
+
+#include <stdexcept>
+
+// Проверочная сборка: -DS21_CHECKED. operator[] у vector и array, а также
+// итераторы vector и list проверяют границы и бросают std::out_of_range.
+// По умолчанию проверок нет и доступ стоит столько же, сколько у std;
+// at() проверяет индекс всегда.
+#ifdef S21_CHECKED
+#define S21_CHECK(condition, message)                   \
+  do {                                                  \
+    if (!(condition)) throw std::out_of_range(message); \
+  } while (false)
+#else
+#define S21_CHECK(condition, message) static_cast<void>(0)
+#endif
+
+#endif  // CPP2_S21_CONTAINERS_CHECKED_H
@@ -1,22 +1,28 @@
 #ifndef _S21_SET_H_
 #define _S21_SET_H_
 
+#include <memory>
+#include <memory_resource>
+
 #include "../AVLtree/AVLtree.h"
 
 namespace s21 {
-template <typename K>
-class set : public AVLTree<K, K> {
+template <typename K, typename Allocator = std::allocator<K>>
+class set : public AVLTree<K, K, Allocator> {
  public:
   using key_type = K;
   using value_type = K;
+  using allocator_type = Allocator;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename AVLTree<K, K>::iterator;
-  using const_iterator = typename AVLTree<K, K>::const_iterator;
+  using iterator = typename AVLTree<K, K, Allocator>::iterator;
+  using const_iterator = typename AVLTree<K, K, Allocator>::const_iterator;
   using size_type = size_t;
 
   set();
-  set(std::initializer_list<value_type> const &items);
+  explicit set(const allocator_type &alloc);
+  set(std::initializer_list<value_type> const &items,
+      const allocator_type &alloc = allocator_type());
   set(const set &st_);
   set(set &&st_);
   ~set() = default;
@@ -24,7 +30,27 @@ class set : public AVLTree<K, K> {
   set &operator=(set &&st_);
   template <class... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  std::pair<set, set> split(const K &key);
+  static set join(set &&left, set &&right);
+
+  template <typename Pred>
+  size_type erase_if(
+      Pred pred,
+      double rebuild_ratio = AVLTree<K, K, Allocator>::kEraseRebuildRatio);
 };
+
+template <typename K, typename Allocator, typename Pred>
+typename set<K, Allocator>::size_type erase_if(
+    set<K, Allocator> &s, Pred pred,
+    double rebuild_ratio = AVLTree<K, K, Allocator>::kEraseRebuildRatio) {
+  return s.erase_if(pred, rebuild_ratio);
+}
+
+namespace pmr {
+template <typename K>
+using set = s21::set<K, std::pmr::polymorphic_allocator<K>>;
+}  // namespace pmr
 }  // namespace s21
 
 #include "s21_set.tpp"
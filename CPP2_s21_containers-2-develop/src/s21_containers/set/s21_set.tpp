@@ -1,37 +1,70 @@
 namespace s21 {
-template <typename K>
-set<K>::set() : AVLTree<K, K>() {}
+template <typename K, typename Allocator>
+set<K, Allocator>::set() : AVLTree<K, K, Allocator>() {}
 
-template <typename K>
-set<K>::set(std::initializer_list<value_type> const &items) {
+template <typename K, typename Allocator>
+set<K, Allocator>::set(const allocator_type &alloc)
+    : AVLTree<K, K, Allocator>(alloc) {}
+
+template <typename K, typename Allocator>
+set<K, Allocator>::set(std::initializer_list<value_type> const &items,
+                       const allocator_type &alloc)
+    : AVLTree<K, K, Allocator>(alloc) {
   for (auto i = items.begin(); i != items.end(); ++i) {
-    AVLTree<K, K>::add_node(*i, *i);
+    AVLTree<K, K, Allocator>::add_node(*i, *i);
   }
 }
 
-template <typename K>
-set<K>::set(const set &st_) : AVLTree<K, K>(st_) {}
+template <typename K, typename Allocator>
+set<K, Allocator>::set(const set &st_) : AVLTree<K, K, Allocator>(st_) {}
 
-template <typename K>
-set<K>::set(set &&st_) : AVLTree<K, K>(std::move(st_)) {}
+template <typename K, typename Allocator>
+set<K, Allocator>::set(set &&st_) : AVLTree<K, K, Allocator>(std::move(st_)) {}
 
-template <typename K>
-set<K> &set<K>::operator=(set &&st_) {
+template <typename K, typename Allocator>
+set<K, Allocator> &set<K, Allocator>::operator=(set &&st_) {
   if (this != &st_) {
-    AVLTree<K, K>::operator=(std::move(st_));
+    AVLTree<K, K, Allocator>::operator=(std::move(st_));
   }
   return *this;
 }
 
-template <typename Key>
+template <typename Key, typename Allocator>
 template <class... Args>
-std::vector<std::pair<typename set<Key>::iterator, bool>> set<Key>::insert_many(
-    Args &&...args) {
-  std::vector<std::pair<typename set<Key>::iterator, bool>> v;
+std::vector<std::pair<typename set<Key, Allocator>::iterator, bool>>
+set<Key, Allocator>::insert_many(Args &&...args) {
+  std::vector<std::pair<typename set<Key, Allocator>::iterator, bool>> v;
   for (const auto &arg : {args...}) {
-    v.push_back(AVLTree<Key, Key>::insert(arg));
+    v.push_back(AVLTree<Key, Key, Allocator>::insert(arg));
   }
   return v;
 }
 
+template <typename K, typename Allocator>
+std::pair<set<K, Allocator>, set<K, Allocator>>
+set<K, Allocator>::split(const K &key) {
+  std::pair<set, set> parts(set(this->get_allocator()),
+                            set(this->get_allocator()));
+  AVLTree<K, K, Allocator>::split_tree(key, parts.first, parts.second);
+  return parts;
+}
+
+template <typename K, typename Allocator>
+template <typename Pred>
+typename set<K, Allocator>::size_type
+set<K, Allocator>::erase_if(Pred pred, double rebuild_ratio) {
+  return AVLTree<K, K, Allocator>::erase_nodes_if(
+      [&pred](const K &key, const K &) {
+        return static_cast<bool>(pred(key));
+      },
+      rebuild_ratio);
+}
+
+template <typename K, typename Allocator>
+set<K, Allocator> set<K, Allocator>::join(set &&left, set &&right) {
+  set result(left.get_allocator());
+  result.join_tree(left, right, false);
+  return result;
+}
+
 }  // namespace s21
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "../deque/s21_deque.h"
@@ -18,6 +20,13 @@ class stack {
 
   stack();
   stack(std::initializer_list<T> const &items);
+  // Конструкторы с аллокатором передают его нижележащему контейнеру.
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator<Container, Alloc>::value>>
+  explicit stack(const Alloc &alloc);
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator<Container, Alloc>::value>>
+  stack(std::initializer_list<T> const &items, const Alloc &alloc);
   stack(const stack &other);
   stack(stack &&other) noexcept;
   ~stack();
@@ -40,6 +49,11 @@ class stack {
   Container deque_;
 };
 
+namespace pmr {
+template <class T>
+using stack = s21::stack<T, s21::pmr::deque<T>>;
+}  // namespace pmr
+
 }  // namespace s21
 
 #include "s21_stack.tpp"
@@ -9,6 +9,18 @@ stack<value_type, Container>::stack(
   for (const auto &item : items) push(item);
 }
 
+template <class value_type, class Container>
+template <class Alloc, class>
+stack<value_type, Container>::stack(const Alloc &alloc) : deque_(alloc) {}
+
+template <class value_type, class Container>
+template <class Alloc, class>
+stack<value_type, Container>::stack(
+    std::initializer_list<value_type> const &items, const Alloc &alloc)
+    : deque_(alloc) {
+  for (const auto &item : items) push(item);
+}
+
 template <class value_type, class Container>
 stack<value_type, Container>::stack(const stack &other)
     : deque_(other.deque_) {}
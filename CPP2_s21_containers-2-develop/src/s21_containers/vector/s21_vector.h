@@ -1,14 +1,175 @@
 #ifndef CPP2_S21_CONTAINERS_VECTOR_H
 #define CPP2_S21_CONTAINERS_VECTOR_H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_checked.h"
 #include "s21_vector_iterations.h"
 
 namespace s21 {
 
+// Объект такого типа можно перенести побайтно: копия байтов становится
+// полноценным объектом, а для исходника деструктор не вызывается.
+// Специализируйте для своих типов (например, владеющих указателей).
 template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Отсекает перегрузки с парой итераторов, когда аргументы — числа:
+// insert(pos, 3, 5) должен выбрать вариант с количеством.
+template <typename It>
+using require_input_iterator = std::enable_if_t<std::is_convertible_v<
+    typename std::iterator_traits<It>::iterator_category,
+    std::input_iterator_tag>>;
+
+namespace detail {
+// Операции над буфером непрерывного контейнера, общие для vector и
+// small_vector: построение и перенос объектов в неинициализированной
+// памяти и сдвиг хвоста при вставке. Память выделяет и освобождает сам
+// контейнер; здесь через alloc только строятся и уничтожаются объекты.
+template <typename T, typename Allocator>
+struct vector_ops {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using size_type = std::size_t;
+
+  static void destroy(Allocator &alloc, T *first, T *last) noexcept {
+    for (; first != last; ++first) alloc_traits::destroy(alloc, first);
+  }
+
+  // Строит n объектов из [first, first + n) в неинициализированной памяти;
+  // при исключении уже построенные объекты уничтожаются.
+  template <typename InputIt>
+  static void construct_range(Allocator &alloc, InputIt first, size_type n,
+                              T *dest) {
+    size_type built = 0U;
+    try {
+      for (; built < n; ++built, ++first)
+        alloc_traits::construct(alloc, dest + built, *first);
+    } catch (...) {
+      destroy(alloc, dest, dest + built);
+      throw;
+    }
+  }
+
+  // Переносит n объектов в неинициализированную память dest. Копирование
+  // используется, только если перемещение может бросить исключение (как
+  // std::move_if_noexcept), поэтому при ошибке исходные объекты целы.
+  // Исходники затем освобождает destroy_relocated().
+  static void relocate(Allocator &alloc, T *first, size_type n, T *dest) {
+    if (n == 0U) return;
+    if constexpr (is_trivially_relocatable<T>::value) {
+      std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first),
+                  n * sizeof(T));
+    } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                         !std::is_copy_constructible_v<T>) {
+      construct_range(alloc, std::make_move_iterator(first), n, dest);
+    } else {
+      construct_range(alloc, first, n, dest);
+    }
+  }
+
+  static void destroy_relocated(Allocator &alloc, T *first, T *last) noexcept {
+    if constexpr (!is_trivially_relocatable<T>::value)
+      destroy(alloc, first, last);
+  }
+
+  // Переносит size объектов в новый буфер dest, оставляя на месте index
+  // разрыв из gap ячеек. При исключении dest снова пуст.
+  static void relocate_around(Allocator &alloc, T *first, size_type size,
+                              size_type index, size_type gap, T *dest) {
+    relocate(alloc, first, index, dest);
+    try {
+      relocate(alloc, first + index, size - index, dest + index + gap);
+    } catch (...) {
+      destroy(alloc, dest, dest + index);
+      throw;
+    }
+  }
+
+  // Геометрический рост под ещё count элементов.
+  static size_type grown_capacity(size_type size, size_type capacity,
+                                  size_type max_size, size_type count,
+                                  const char *error) {
+    if (max_size - size < count) throw std::length_error(error);
+    return std::max(size + count, capacity * 2);
+  }
+
+  // Сдвигает [index, size) на count позиций вправо внутри буфера, где
+  // хватает места. Возвращает, сколько первых ячеек разрыва содержат живые
+  // (перемещённые) объекты: им нужно присваивание, остальным —
+  // конструирование. Если бросает присваивание, построенные за size
+  // объекты уничтожаются и size остаётся прежним.
+  static size_type shift_tail(Allocator &alloc, T *data, size_type size,
+                              size_type index, size_type count) {
+    const size_type tail = size - index;
+    if (tail == 0U) return 0U;
+    if constexpr (is_trivially_relocatable<T>::value) {
+      std::memmove(static_cast<void *>(data + index + count),
+                   static_cast<const void *>(data + index), tail * sizeof(T));
+      return 0U;
+    }
+    if (count >= tail) {
+      construct_range(alloc, std::make_move_iterator(data + index), tail,
+                      data + index + count);
+      return tail;
+    }
+    construct_range(alloc, std::make_move_iterator(data + size - count), count,
+                    data + size);
+    try {
+      std::move_backward(data + index, data + size - count, data + size);
+    } catch (...) {
+      destroy(alloc, data + size, data + size + count);
+      throw;
+    }
+    return count;
+  }
+
+  // Заполняет разрыв [index, index + count), открытый shift_tail() или
+  // relocate_around(): fill(put) вызывает put(value) count раз. Если
+  // конструктор или присваивание бросает исключение, контейнер обрезается
+  // до index без утечек: базовая гарантия, как у std::vector::insert в
+  // середину. size — размер до вставки, после неё он растёт на count.
+  template <typename Fill>
+  static void fill_gap(Allocator &alloc, T *data, size_type &size,
+                       size_type index, size_type count, size_type assigned,
+                       Fill fill) {
+    size_type i = 0U;
+    auto put = [&](auto &&value) {
+      if (i < assigned)
+        data[index + i] = std::forward<decltype(value)>(value);
+      else
+        alloc_traits::construct(alloc, data + index + i,
+                                std::forward<decltype(value)>(value));
+      ++i;
+    };
+    try {
+      fill(put);
+    } catch (...) {
+      destroy(alloc, data + index, data + index + std::max(i, assigned));
+      destroy(alloc, data + index + count, data + size + count);
+      size = index;
+      throw;
+    }
+    size += count;
+  }
+};
+}  // namespace detail
+
+template <typename T, typename Allocator = std::allocator<T>>
 class vector {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using size_type = size_t;
   using reference = T &;
   using const_reference = const T &;
@@ -17,12 +178,19 @@ class vector {
   using iterator_pointer = T *;
 
   vector();
-  explicit vector(size_type n);
-  vector(std::initializer_list<T> const &items);
+  explicit vector(const allocator_type &alloc);
+  explicit vector(size_type n, const allocator_type &alloc = allocator_type());
+  vector(std::initializer_list<T> const &items,
+         const allocator_type &alloc = allocator_type());
   vector(const vector &v);
   vector(vector &&v) noexcept;
   ~vector();
-  vector &operator=(vector &&v) noexcept;
+  vector &operator=(vector &&v) noexcept(
+      std::allocator_traits<Allocator>::is_always_equal::value ||
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value);
+
+  allocator_type get_allocator() const;
 
   reference at(size_type pos);
   reference operator[](size_type pos);
@@ -30,6 +198,7 @@ class vector {
   const_reference front() const;
   const_reference back() const;
   iterator_pointer data() noexcept;
+  const value_type *data() const noexcept;
 
   iterator begin();
   iterator end();
@@ -45,8 +214,16 @@ class vector {
 
   void clear() noexcept;
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
   void erase(iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  void assign(InputIt first, InputIt last);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
   void pop_back();
   void swap(vector &other);
 
@@ -54,175 +231,253 @@ class vector {
   iterator insert_many(const_iterator pos, Args &&...args);
   template <class... Args>
   void insert_many_back(Args &&...args);
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+
+  template <typename Pred>
+  size_type erase_if(Pred pred);
 
   void removing();
   void zeroing();
 
  private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using ops = detail::vector_ops<T, Allocator>;
+
+  // Буфер таких типов живёт в malloc и растёт через realloc: большие блоки
+  // glibc переносит через mremap, без копирования страниц. Только для
+  // std::allocator: чужой аллокатор сам решает, откуда брать память.
+  static constexpr bool kReallocatable =
+      std::is_same_v<Allocator, std::allocator<T>> &&
+      is_trivially_relocatable<T>::value &&
+      alignof(T) <= alignof(std::max_align_t);
+
+  iterator_pointer allocate(size_type n);
+  void deallocate(iterator_pointer p, size_type n) noexcept;
+  template <class... Args>
+  void construct(iterator_pointer p, Args &&...args);
+  void reallocate(size_type new_capacity);
+  template <class... Args>
+  void emplace_reallocate(size_type index, Args &&...args);
+  size_type grown_capacity(size_type count) const;
+  size_type open_gap(size_type index, size_type count);
+
   iterator_pointer data_;
   size_type size_;
   size_type capacity_;
+  allocator_type alloc_;
 };
 
-template <typename value_type>
-vector<value_type>::vector() : data_(nullptr), size_(0U), capacity_(0U) {}
+template <typename value_type, typename Allocator>
+vector<value_type, Allocator>::vector()
+    : data_(nullptr), size_(0U), capacity_(0U), alloc_() {}
+
+template <typename value_type, typename Allocator>
+vector<value_type, Allocator>::vector(const allocator_type &alloc)
+    : data_(nullptr), size_(0U), capacity_(0U), alloc_(alloc) {}
 
-template <typename value_type>
-vector<value_type>::vector(size_type n)
-    : data_(nullptr), size_(0U), capacity_(0U) {
+template <typename value_type, typename Allocator>
+vector<value_type, Allocator>::vector(size_type n, const allocator_type &alloc)
+    : data_(nullptr), size_(0U), capacity_(0U), alloc_(alloc) {
   if (n == 0U) return;
   if (max_size() < n) {
     throw std::out_of_range("cannot create s21::vector larger than max_size()");
   }
 
-  data_ = new value_type[n];
-  size_ = n;
+  data_ = allocate(n);
   capacity_ = n;
-
   try {
-    std::uninitialized_fill_n(data_, n, value_type());
+    for (; size_ < n; ++size_) construct(data_ + size_);
   } catch (...) {
     removing();
     throw;
   }
 }
 
-template <typename value_type>
-vector<value_type>::vector(std::initializer_list<value_type> const &items)
-    : data_(nullptr), size_(0U), capacity_(0U) {
+template <typename value_type, typename Allocator>
+vector<value_type, Allocator>::vector(
+    std::initializer_list<value_type> const &items, const allocator_type &alloc)
+    : data_(nullptr), size_(0U), capacity_(0U), alloc_(alloc) {
   if (items.size() == 0U) return;
 
+  data_ = allocate(items.size());
   try {
-    size_ = items.size();
-    capacity_ = size_;
-    data_ = new value_type[capacity_];
-    std::uninitialized_copy(items.begin(), items.end(), data_);
+    ops::construct_range(alloc_, items.begin(), items.size(), data_);
   } catch (...) {
-    removing();
+    deallocate(data_, items.size());
+    data_ = nullptr;
     throw;
   }
+  size_ = items.size();
+  capacity_ = size_;
 }
 
-template <typename value_type>
-vector<value_type>::vector(const vector &v)
-    : data_(nullptr), size_(0U), capacity_(0U) {
+template <typename value_type, typename Allocator>
+vector<value_type, Allocator>::vector(const vector &v)
+    : data_(nullptr),
+      size_(0U),
+      capacity_(0U),
+      alloc_(alloc_traits::select_on_container_copy_construction(v.alloc_)) {
   if (v.size_ == 0U) return;
 
-  data_ = new value_type[v.capacity_];
+  data_ = allocate(v.size_);
+  try {
+    ops::construct_range(alloc_, v.data_, v.size_, data_);
+  } catch (...) {
+    deallocate(data_, v.size_);
+    data_ = nullptr;
+    throw;
+  }
   size_ = v.size_;
-  capacity_ = v.capacity_;
-  std::uninitialized_copy(v.data_, v.data_ + size_, data_);
+  capacity_ = v.size_;
 }
 
-template <typename value_type>
-vector<value_type>::vector(vector &&v) noexcept
-    : data_(v.data_), size_(v.size_), capacity_(v.capacity_) {
+template <typename value_type, typename Allocator>
+vector<value_type, Allocator>::vector(vector &&v) noexcept
+    : data_(v.data_),
+      size_(v.size_),
+      capacity_(v.capacity_),
+      alloc_(std::move(v.alloc_)) {
   v.zeroing();
 }
 
-template <typename T>
-vector<T>::~vector() {
+template <typename T, typename Allocator>
+vector<T, Allocator>::~vector() {
   removing();
 }
 
-template <class value_type>
-typename s21::vector<value_type> &vector<value_type>::operator=(
-    vector &&v) noexcept {
-  if (this != &v) {
+// Буфер забирается целиком, только если аллокаторы совместимы; иначе
+// элементы перемещаются поштучно в память своего аллокатора.
+template <class value_type, typename Allocator>
+typename s21::vector<value_type, Allocator> &
+vector<value_type, Allocator>::operator=(vector &&v) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value) {
+  if (this == &v) return *this;
+  if (alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_ == v.alloc_) {
     removing();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+      alloc_ = std::move(v.alloc_);
     size_ = v.size_;
     capacity_ = v.capacity_;
     data_ = v.data_;
     v.zeroing();
+  } else {
+    clear();
+    reserve(v.size_);
+    ops::construct_range(alloc_, std::make_move_iterator(v.data_), v.size_,
+                         data_);
+    size_ = v.size_;
+    v.removing();
   }
   return *this;
 }
 
-template <typename value_type>
-typename vector<value_type>::reference vector<value_type>::at(size_type pos) {
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::allocator_type
+vector<value_type, Allocator>::get_allocator() const {
+  return alloc_;
+}
+
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::reference
+vector<value_type, Allocator>::at(size_type pos) {
   if (pos >= size_) {
     throw std::out_of_range("AtError: Index out of range");
   }
   return data_[pos];
 }
 
-template <typename value_type>
-typename vector<value_type>::reference vector<value_type>::operator[](
-    size_type pos) {
-  if (pos >= size_) {
-    throw std::out_of_range("Index out of range");
-  }
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::reference
+vector<value_type, Allocator>::operator[](size_type pos) {
+  S21_CHECK(pos < size_, "Index out of range");
   return data_[pos];
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::operator[](
-    size_type pos) const {
-  if (pos >= size_) {
-    throw std::out_of_range("Index out of range");
-  }
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::const_reference
+vector<value_type, Allocator>::operator[](size_type pos) const {
+  S21_CHECK(pos < size_, "Index out of range");
   return data_[pos];
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::front() const {
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::const_reference
+vector<value_type, Allocator>::front() const {
   if (empty()) {
     throw std::out_of_range("FrontError: vector is empty");
   }
   return data_[0U];
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::back() const {
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::const_reference
+vector<value_type, Allocator>::back() const {
   if (empty()) {
     throw std::out_of_range("BackError: vector is empty");
   }
   return data_[size_ - 1];
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator_pointer
-vector<value_type>::data() noexcept {
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::iterator_pointer
+vector<value_type, Allocator>::data() noexcept {
+  return data_;
+}
+
+template <typename value_type, typename Allocator>
+const value_type *vector<value_type, Allocator>::data() const noexcept {
   return data_;
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::begin() {
-  return iterator(data_);
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::begin() {
+  return iterator(data_, data_, data_ + size_);
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::end() {
-  return iterator(data_ + size_);
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::end() {
+  return iterator(data_ + size_, data_, data_ + size_);
 }
 
-template <typename value_type>
-typename vector<value_type>::const_iterator vector<value_type>::cbegin() const {
-  return const_iterator(data_);
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::const_iterator
+vector<value_type, Allocator>::cbegin() const {
+  return const_iterator(data_, data_, data_ + size_);
 }
 
-template <typename value_type>
-typename vector<value_type>::const_iterator vector<value_type>::cend() const {
-  return const_iterator(data_ + size_);
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::const_iterator
+vector<value_type, Allocator>::cend() const {
+  return const_iterator(data_ + size_, data_, data_ + size_);
 }
 
-template <typename value_type>
-bool vector<value_type>::empty() const {
+template <typename value_type, typename Allocator>
+bool vector<value_type, Allocator>::empty() const {
   return size_ == 0U;
 }
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::size() const {
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::size_type
+vector<value_type, Allocator>::size() const {
   return size_;
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::max_size() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::max_size()
+    const {
   return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
 }
 
-template <typename T>
-void vector<T>::reserve(size_type new_capacity) {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::reserve(size_type new_capacity) {
   if (new_capacity <= capacity_) {
     return;
   }
@@ -230,142 +485,426 @@ void vector<T>::reserve(size_type new_capacity) {
     throw std::out_of_range("ReserveError: new capacity exceeds max_size");
   }
 
-  iterator_pointer new_data = static_cast<iterator_pointer>(
-      ::operator new(new_capacity * sizeof(value_type)));
-  try {
-    std::uninitialized_copy(data_, data_ + size_, new_data);
-  } catch (...) {
-    ::operator delete(new_data);
-    throw;
-  }
-
-  delete[] data_;
-  data_ = new_data;
-  capacity_ = new_capacity;
+  reallocate(new_capacity);
 }
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::capacity() const {
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::size_type
+vector<value_type, Allocator>::capacity() const {
   return capacity_;
 }
 
-template <typename value_type>
-void vector<value_type>::shrink_to_fit() {
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::shrink_to_fit() {
   if (size_ < capacity_) {
-    iterator_pointer new_data = new value_type[size_];
-    try {
-      std::uninitialized_copy(data_, data_ + size_, new_data);
-    } catch (...) {
-      delete[] new_data;
-      throw;
-    }
-    delete[] data_;
-    data_ = new_data;
-    capacity_ = size_;
+    reallocate(size_);
   }
 }
 
-template <typename value_type>
-void vector<value_type>::clear() noexcept {
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::clear() noexcept {
+  ops::destroy(alloc_, data_, data_ + size_);
   size_ = 0U;
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(iterator pos,
-                                               const_reference value) {
-  size_type index = pos - begin();
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
 
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::insert(const_iterator pos, size_type count,
+                                      const_reference value) {
+  size_type index = pos - cbegin();
   if (index > size_) {
-    throw std::out_of_range("Index out ot range");
+    throw std::out_of_range("InsertError: Index out of range");
   }
-  if (size_ == capacity_) {
-    reserve(capacity_ ? capacity_ * 2 : 1);
+  if (count == 0U) return begin() + index;
+
+  // value может ссылаться на элемент этого же вектора
+  value_type item(value);
+  size_type assigned = open_gap(index, count);
+  ops::fill_gap(alloc_, data_, size_, index, count, assigned,
+                [&item, count](auto &put) {
+                  for (size_type i = 0; i < count; ++i) put(item);
+                });
+  return begin() + index;
+}
+
+// Для forward-итераторов длина известна заранее: хвост сдвигается один раз.
+// Однопроходный диапазон дописывается в конец и поворачивается на место.
+template <typename value_type, typename Allocator>
+template <typename InputIt, typename>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::insert(const_iterator pos, InputIt first,
+                                      InputIt last) {
+  size_type index = pos - cbegin();
+  if (index > size_) {
+    throw std::out_of_range("InsertError: Index out of range");
   }
 
-  iterator new_pos = begin() + index;
-  std::copy_backward(new_pos, end(), end() + 1);
-  *new_pos = value;
-  ++size_;
-  return new_pos;
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_convertible_v<category, std::forward_iterator_tag>) {
+    size_type count = std::distance(first, last);
+    if (count == 0U) return begin() + index;
+    size_type assigned = open_gap(index, count);
+    ops::fill_gap(alloc_, data_, size_, index, count, assigned,
+                  [&first, count](auto &put) {
+                    for (size_type i = 0; i < count; ++i, ++first) put(*first);
+                  });
+  } else {
+    size_type old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(data_ + index, data_ + old_size, data_ + size_);
+  }
+  return begin() + index;
 }
 
-template <class value_type>
+template <class value_type, typename Allocator>
 template <class... Args>
-typename vector<value_type>::iterator vector<value_type>::insert_many(
-    const_iterator pos, Args &&...args) {
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::emplace(const_iterator pos, Args &&...args) {
   size_type index = pos - cbegin();
-  size_type count = sizeof...(args);
+  if (index > size_) {
+    throw std::out_of_range("Index out ot range");
+  }
 
-  if (size_ + count > capacity_) {
-    reserve(size_ + count);
+  if (size_ == capacity_) {
+    emplace_reallocate(index, std::forward<Args>(args)...);
+  } else if (index == size_) {
+    construct(data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  } else {
+    // аргументы могут ссылаться на сдвигаемые элементы
+    value_type item(std::forward<Args>(args)...);
+    if (open_gap(index, 1U) != 0U)
+      data_[index] = std::move(item);
+    else
+      construct(data_ + index, std::move(item));
+    ++size_;
   }
+  return begin() + index;
+}
 
-  iterator insert_pos = begin() + index;
-  std::move_backward(insert_pos, end(), end() + count);
+template <class value_type, typename Allocator>
+template <class... Args>
+typename vector<value_type, Allocator>::reference
+vector<value_type, Allocator>::emplace_back(Args &&...args) {
+  if (size_ == capacity_) {
+    emplace_reallocate(size_, std::forward<Args>(args)...);
+  } else {
+    construct(data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  }
+  return data_[size_ - 1];
+}
 
-  ((*(insert_pos++) = std::forward<Args>(args)), ...);
+template <class value_type, typename Allocator>
+template <class... Args>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::insert_many(const_iterator pos,
+                                           Args &&...args) {
+  size_type index = pos - cbegin();
+  size_type count = sizeof...(args);
+  if (count == 0U) return begin() + index;
 
-  size_ += count;
+  size_type assigned = open_gap(index, count);
+  ops::fill_gap(alloc_, data_, size_, index, count, assigned,
+                [&](auto &put) { (put(std::forward<Args>(args)), ...); });
   return begin() + index;
 }
 
-template <class value_type>
+template <class value_type, typename Allocator>
 template <class... Args>
-void vector<value_type>::insert_many_back(Args &&...args) {
-  (push_back(std::forward<Args>(args)), ...);
+void vector<value_type, Allocator>::insert_many_back(Args &&...args) {
+  (emplace_back(std::forward<Args>(args)), ...);
 }
 
-template <typename value_type>
-void vector<value_type>::erase(iterator pos) {
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::erase(iterator pos) {
   size_type index = pos - iterator(data_);
   if (index >= size_) {
     throw std::out_of_range("Index out ot range");
   }
 
-  for (size_type i = index + 1; i < size_; ++i) {
-    data_[i - 1] = data_[i];
+  erase(pos, pos + 1);
+}
+
+// Хвост сдвигается один раз, сколько бы элементов ни удалялось; для
+// побайтно переносимых типов — одним memmove.
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::erase(const_iterator first,
+                                     const_iterator last) {
+  size_type index = first - cbegin();
+  size_type stop = last - cbegin();
+  if (index > stop || stop > size_) {
+    throw std::out_of_range("EraseError: invalid range");
+  }
+  size_type count = stop - index;
+  if (count == 0U) return begin() + index;
+
+  if constexpr (is_trivially_relocatable<value_type>::value) {
+    ops::destroy(alloc_, data_ + index, data_ + stop);
+    std::memmove(static_cast<void *>(data_ + index),
+                 static_cast<const void *>(data_ + stop),
+                 (size_ - stop) * sizeof(value_type));
+  } else {
+    std::move(data_ + stop, data_ + size_, data_ + index);
+    ops::destroy(alloc_, data_ + size_ - count, data_ + size_);
   }
-  --size_;
+  size_ -= count;
+  return begin() + index;
 }
 
-template <typename value_type>
-void vector<value_type>::push_back(const_reference value) {
-  if (size_ == capacity_) {
-    reserve(capacity_ ? capacity_ * 2 : 1);
+template <typename value_type, typename Allocator>
+template <typename InputIt, typename>
+void vector<value_type, Allocator>::assign(InputIt first, InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_convertible_v<category, std::forward_iterator_tag>) {
+    size_type count = std::distance(first, last);
+    if (count > capacity_) {
+      if (count > max_size()) {
+        throw std::length_error("AssignError: range exceeds max_size");
+      }
+      iterator_pointer new_data = allocate(count);
+      try {
+        ops::construct_range(alloc_, first, count, new_data);
+      } catch (...) {
+        deallocate(new_data, count);
+        throw;
+      }
+      removing();
+      data_ = new_data;
+      size_ = count;
+      capacity_ = count;
+    } else if (count > size_) {
+      InputIt middle = std::next(first, size_);
+      std::copy(first, middle, data_);
+      ops::construct_range(alloc_, middle, count - size_, data_ + size_);
+      size_ = count;
+    } else {
+      std::copy(first, last, data_);
+      ops::destroy(alloc_, data_ + count, data_ + size_);
+      size_ = count;
+    }
+  } else {
+    clear();
+    for (; first != last; ++first) emplace_back(*first);
   }
-  data_[size_++] = std::move(value);
 }
 
-template <typename value_type>
-void vector<value_type>::pop_back() {
+template <typename value_type, typename Allocator>
+template <typename Pred>
+typename vector<value_type, Allocator>::size_type
+vector<value_type, Allocator>::erase_if(Pred pred) {
+  size_type kept = 0U;
+  for (size_type i = 0U; i < size_; ++i) {
+    if (!pred(static_cast<const_reference>(data_[i]))) {
+      if (kept != i) data_[kept] = std::move(data_[i]);
+      ++kept;
+    }
+  }
+  size_type removed = size_ - kept;
+  ops::destroy(alloc_, data_ + kept, data_ + size_);
+  size_ = kept;
+  return removed;
+}
+
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::pop_back() {
   if (size_ > 0U) {
     --size_;
-    data_[size_].~value_type();
+    ops::destroy(alloc_, data_ + size_, data_ + size_ + 1);
   }
 }
 
-template <typename value_type>
-void vector<value_type>::swap(vector<value_type> &other) {
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::swap(vector &other) {
   std::swap(data_, other.data_);
   std::swap(size_, other.size_);
   std::swap(capacity_, other.capacity_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value)
+    std::swap(alloc_, other.alloc_);
 }
 
-template <typename value_type>
-void vector<value_type>::removing() {
-  if (data_) delete[] data_;
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::removing() {
+  ops::destroy(alloc_, data_, data_ + size_);
+  deallocate(data_, capacity_);
   data_ = nullptr;
   size_ = 0U;
   capacity_ = 0U;
 }
 
-template <typename value_type>
-void vector<value_type>::zeroing() {
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::zeroing() {
   data_ = nullptr;
   size_ = 0U;
   capacity_ = 0U;
 }
 
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::iterator_pointer
+vector<value_type, Allocator>::allocate(size_type n) {
+  if constexpr (kReallocatable) {
+    void *p = std::malloc(n * sizeof(value_type));
+    if (p == nullptr) throw std::bad_alloc();
+    return static_cast<iterator_pointer>(p);
+  } else {
+    return alloc_traits::allocate(alloc_, n);
+  }
+}
+
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::deallocate(iterator_pointer p,
+                                               size_type n) noexcept {
+  if constexpr (kReallocatable)
+    std::free(p);
+  else if (p != nullptr)
+    alloc_traits::deallocate(alloc_, p, n);
+}
+
+template <typename value_type, typename Allocator>
+template <class... Args>
+void vector<value_type, Allocator>::construct(iterator_pointer p,
+                                              Args &&...args) {
+  alloc_traits::construct(alloc_, p, std::forward<Args>(args)...);
+}
+
+template <typename value_type, typename Allocator>
+void vector<value_type, Allocator>::reallocate(size_type new_capacity) {
+  if constexpr (kReallocatable) {
+    if (new_capacity == 0U) {
+      std::free(data_);
+      data_ = nullptr;
+    } else {
+      void *p = std::realloc(static_cast<void *>(data_),
+                             new_capacity * sizeof(value_type));
+      if (p == nullptr) throw std::bad_alloc();
+      data_ = static_cast<iterator_pointer>(p);
+    }
+  } else {
+    iterator_pointer new_data = new_capacity ? allocate(new_capacity) : nullptr;
+    try {
+      ops::relocate(alloc_, data_, size_, new_data);
+    } catch (...) {
+      deallocate(new_data, new_capacity);
+      throw;
+    }
+    ops::destroy_relocated(alloc_, data_, data_ + size_);
+    deallocate(data_, capacity_);
+    data_ = new_data;
+  }
+  capacity_ = new_capacity;
+}
+
+// Рост при вставке в заполненный буфер: новый элемент строится сразу на
+// своём месте в новом буфере (пока args ещё указывают на живые объекты),
+// затем вокруг него переносятся старые.
+template <typename value_type, typename Allocator>
+template <class... Args>
+void vector<value_type, Allocator>::emplace_reallocate(size_type index,
+                                                       Args &&...args) {
+  size_type new_capacity = grown_capacity(1U);
+  if constexpr (std::is_trivially_copyable_v<value_type> && kReallocatable) {
+    value_type item(std::forward<Args>(args)...);
+    reallocate(new_capacity);
+    std::memmove(static_cast<void *>(data_ + index + 1),
+                 static_cast<const void *>(data_ + index),
+                 (size_ - index) * sizeof(value_type));
+    construct(data_ + index, item);
+  } else {
+    iterator_pointer new_data = allocate(new_capacity);
+    try {
+      construct(new_data + index, std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(new_data, new_capacity);
+      throw;
+    }
+    try {
+      ops::relocate_around(alloc_, data_, size_, index, 1U, new_data);
+    } catch (...) {
+      ops::destroy(alloc_, new_data + index, new_data + index + 1);
+      deallocate(new_data, new_capacity);
+      throw;
+    }
+    ops::destroy_relocated(alloc_, data_, data_ + size_);
+    deallocate(data_, capacity_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+  ++size_;
+}
+
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::size_type
+vector<value_type, Allocator>::grown_capacity(size_type count) const {
+  return ops::grown_capacity(size_, capacity_, max_size(), count,
+                             "s21::vector exceeds max_size()");
+}
+
+// Сдвигает [index, size_) на count позиций вправо, при необходимости
+// расширяя буфер (геометрически). Возвращает, сколько первых ячеек разрыва
+// содержат живые (перемещённые) объекты: им нужно присваивание, остальным —
+// конструирование. size_ не меняется.
+template <typename value_type, typename Allocator>
+typename vector<value_type, Allocator>::size_type
+vector<value_type, Allocator>::open_gap(size_type index, size_type count) {
+  if (size_ + count > capacity_) {
+    size_type new_capacity = grown_capacity(count);
+    if constexpr (kReallocatable) {
+      reallocate(new_capacity);
+    } else {
+      // при переезде в новый буфер хвост сразу ложится за разрывом
+      iterator_pointer new_data = allocate(new_capacity);
+      try {
+        ops::relocate_around(alloc_, data_, size_, index, count, new_data);
+      } catch (...) {
+        deallocate(new_data, new_capacity);
+        throw;
+      }
+      ops::destroy_relocated(alloc_, data_, data_ + size_);
+      deallocate(data_, capacity_);
+      data_ = new_data;
+      capacity_ = new_capacity;
+      return 0U;
+    }
+  }
+  return ops::shift_tail(alloc_, data_, size_, index, count);
+}
+
+template <typename T, typename Allocator, typename Pred>
+typename vector<T, Allocator>::size_type erase_if(vector<T, Allocator> &v,
+                                                  Pred pred) {
+  return v.erase_if(pred);
+}
+
+namespace pmr {
+template <typename T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
 }  // namespace s21
 
+#include "s21_vector_bool.h"
+
 #endif  // CPP2_S21_CONTAINERS_VECTOR_H
@@ -0,0 +1,626 @@
+#ifndef CPP2_S21_CONTAINERS_VECTOR_BOOL_H
+#define CPP2_S21_CONTAINERS_VECTOR_BOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_bits.h"
+#include "../s21_checked.h"
+
+namespace s21 {
+
+// Упакованный вектор флагов: 64 значения в слове std::uint64_t, в 8 раз
+// меньше памяти, чем байт на флаг. Элемент доступен через прокси
+// reference. count, find_first/find_next, flip и &, |, ^ работают по
+// словам (popcount, ctz, простые циклы, которые компилятор векторизует).
+// Биты последнего слова за size() всегда нулевые.
+template <typename Allocator>
+class vector<bool, Allocator> {
+ public:
+  using value_type = bool;
+  using allocator_type = Allocator;
+  using size_type = size_t;
+  using word_type = std::uint64_t;
+  using const_reference = bool;
+
+  static constexpr size_type bits_per_word = 64;
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+  class reference {
+   public:
+    reference(word_type *word, word_type mask) noexcept
+        : word_(word), mask_(mask) {}
+    reference(const reference &) = default;
+
+    operator bool() const noexcept { return (*word_ & mask_) != 0U; }
+    bool operator~() const noexcept { return !bool(*this); }
+    reference &operator=(bool value) noexcept {
+      if (value)
+        *word_ |= mask_;
+      else
+        *word_ &= ~mask_;
+      return *this;
+    }
+    reference &operator=(const reference &other) noexcept {
+      return *this = bool(other);
+    }
+    void flip() noexcept { *word_ ^= mask_; }
+
+   private:
+    word_type *word_;
+    word_type mask_;
+  };
+
+  template <bool Const>
+  class bit_iterator {
+   public:
+    using value_type = bool;
+    using reference =
+        std::conditional_t<Const, bool, typename vector::reference>;
+    using pointer = void;
+    using iterator_category = std::random_access_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using word_pointer = std::conditional_t<Const, const word_type *,
+                                            word_type *>;
+
+    bit_iterator() = default;
+    bit_iterator(word_pointer words, size_type index)
+        : words_(words), index_(index) {}
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    bit_iterator(const bit_iterator<OtherConst> &other)
+        : words_(other.words_), index_(other.index_) {}
+
+    reference operator*() const { return (*this)[0]; }
+    reference operator[](difference_type n) const {
+      size_type i = index_ + n;
+      if constexpr (Const) {
+        return (words_[i / bits_per_word] >> (i % bits_per_word)) & 1U;
+      } else {
+        return reference(words_ + i / bits_per_word,
+                         word_type{1} << (i % bits_per_word));
+      }
+    }
+    size_type index() const noexcept { return index_; }
+
+    bit_iterator &operator+=(difference_type n) {
+      index_ += n;
+      return *this;
+    }
+    bit_iterator &operator-=(difference_type n) { return *this += -n; }
+    bit_iterator &operator++() { return *this += 1; }
+    bit_iterator &operator--() { return *this += -1; }
+    bit_iterator operator++(int) {
+      bit_iterator temp(*this);
+      ++*this;
+      return temp;
+    }
+    bit_iterator operator--(int) {
+      bit_iterator temp(*this);
+      --*this;
+      return temp;
+    }
+    bit_iterator operator+(difference_type n) const {
+      bit_iterator temp(*this);
+      return temp += n;
+    }
+    bit_iterator operator-(difference_type n) const {
+      bit_iterator temp(*this);
+      return temp -= n;
+    }
+    friend bit_iterator operator+(difference_type n, const bit_iterator &it) {
+      return it + n;
+    }
+    difference_type operator-(const bit_iterator &other) const {
+      return static_cast<difference_type>(index_) -
+             static_cast<difference_type>(other.index_);
+    }
+
+    bool operator==(const bit_iterator &other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const bit_iterator &other) const {
+      return index_ != other.index_;
+    }
+    bool operator<(const bit_iterator &other) const {
+      return index_ < other.index_;
+    }
+    bool operator>(const bit_iterator &other) const {
+      return index_ > other.index_;
+    }
+    bool operator<=(const bit_iterator &other) const {
+      return index_ <= other.index_;
+    }
+    bool operator>=(const bit_iterator &other) const {
+      return index_ >= other.index_;
+    }
+
+   private:
+    template <bool>
+    friend class bit_iterator;
+
+    word_pointer words_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  using iterator = bit_iterator<false>;
+  using const_iterator = bit_iterator<true>;
+
+  vector() noexcept(noexcept(Allocator())) : vector(Allocator()) {}
+  explicit vector(const allocator_type &alloc) noexcept : alloc_(alloc) {}
+  explicit vector(size_type n, const allocator_type &alloc = allocator_type());
+  vector(size_type n, bool value,
+         const allocator_type &alloc = allocator_type());
+  vector(std::initializer_list<bool> const &items,
+         const allocator_type &alloc = allocator_type());
+  vector(const vector &v);
+  vector(vector &&v) noexcept;
+  ~vector();
+  vector &operator=(const vector &v);
+  vector &operator=(vector &&v) noexcept(
+      std::allocator_traits<Allocator>::is_always_equal::value ||
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value);
+
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
+  reference at(size_type pos);
+  bool at(size_type pos) const;
+  reference operator[](size_type pos);
+  bool operator[](size_type pos) const;
+  bool front() const;
+  bool back() const;
+  // Слова с битами: бит i лежит в words()[i / 64] на позиции i % 64.
+  const word_type *words() const noexcept { return words_; }
+  size_type word_count() const noexcept { return words_for(size_); }
+
+  iterator begin() noexcept { return iterator(words_, 0U); }
+  iterator end() noexcept { return iterator(words_, size_); }
+  const_iterator cbegin() const noexcept { return const_iterator(words_, 0U); }
+  const_iterator cend() const noexcept {
+    return const_iterator(words_, size_);
+  }
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  size_type capacity() const noexcept { return capacity_ * bits_per_word; }
+  void shrink_to_fit();
+
+  void clear() noexcept { size_ = 0U; }
+  iterator insert(const_iterator pos, bool value);
+  void erase(iterator pos);
+  void push_back(bool value);
+  void pop_back();
+  void resize(size_type count, bool value = false);
+  void swap(vector &other) noexcept;
+
+  size_type count() const noexcept;
+  size_type find_first() const noexcept { return find_next_from(0U); }
+  // Первый установленный бит строго после pos; npos, если его нет.
+  size_type find_next(size_type pos) const noexcept;
+  vector &flip() noexcept;
+  void flip(size_type pos);
+
+  vector &operator&=(const vector &other);
+  vector &operator|=(const vector &other);
+  vector &operator^=(const vector &other);
+  bool operator==(const vector &other) const noexcept;
+  bool operator!=(const vector &other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  using word_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<word_type>;
+  using word_traits = std::allocator_traits<word_allocator>;
+
+  static size_type words_for(size_type bits) noexcept {
+    return (bits + bits_per_word - 1) / bits_per_word;
+  }
+  bool test(size_type pos) const noexcept {
+    return (words_[pos / bits_per_word] >> (pos % bits_per_word)) & 1U;
+  }
+  void assign_bit(size_type pos, bool value) noexcept {
+    reference(words_ + pos / bits_per_word,
+              word_type{1} << (pos % bits_per_word)) = value;
+  }
+  size_type find_next_from(size_type pos) const noexcept;
+  void clear_tail() noexcept;
+  void reallocate(size_type new_words);
+  size_type grown_words(size_type bits) const;
+  void check_same_size(const vector &other) const;
+  void release() noexcept;
+  // Забирает слова v; аллокаторы должны быть равны.
+  void take(vector &v) noexcept;
+
+  word_type *words_ = nullptr;
+  size_type size_ = 0;
+  size_type capacity_ = 0;  // в словах
+  word_allocator alloc_;
+};
+
+template <typename Allocator>
+vector<bool, Allocator>::vector(size_type n, const allocator_type &alloc)
+    : vector(n, false, alloc) {}
+
+template <typename Allocator>
+vector<bool, Allocator>::vector(size_type n, bool value,
+                                const allocator_type &alloc)
+    : alloc_(alloc) {
+  resize(n, value);
+}
+
+template <typename Allocator>
+vector<bool, Allocator>::vector(std::initializer_list<bool> const &items,
+                                const allocator_type &alloc)
+    : alloc_(alloc) {
+  reserve(items.size());
+  for (bool value : items) push_back(value);
+}
+
+template <typename Allocator>
+vector<bool, Allocator>::vector(const vector &v)
+    : alloc_(word_traits::select_on_container_copy_construction(v.alloc_)) {
+  reserve(v.size_);
+  std::copy(v.words_, v.words_ + words_for(v.size_), words_);
+  size_ = v.size_;
+}
+
+template <typename Allocator>
+vector<bool, Allocator>::vector(vector &&v) noexcept
+    : alloc_(std::move(v.alloc_)) {
+  take(v);
+}
+
+template <typename Allocator>
+vector<bool, Allocator>::~vector() {
+  release();
+}
+
+template <typename Allocator>
+vector<bool, Allocator> &vector<bool, Allocator>::operator=(const vector &v) {
+  if (this == &v) return *this;
+  vector copy(allocator_type(
+      word_traits::propagate_on_container_copy_assignment::value ? v.alloc_
+                                                                 : alloc_));
+  copy.reserve(v.size_);
+  std::copy(v.words_, v.words_ + words_for(v.size_), copy.words_);
+  copy.size_ = v.size_;
+  release();
+  if constexpr (word_traits::propagate_on_container_copy_assignment::value)
+    alloc_ = v.alloc_;
+  take(copy);
+  return *this;
+}
+
+// Слова забираются целиком, только если аллокаторы совместимы; иначе они
+// копируются в память своего аллокатора.
+template <typename Allocator>
+vector<bool, Allocator> &
+vector<bool, Allocator>::operator=(vector &&v) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value) {
+  if (this == &v) return *this;
+  if (word_traits::propagate_on_container_move_assignment::value ||
+      alloc_ == v.alloc_) {
+    release();
+    if constexpr (word_traits::propagate_on_container_move_assignment::value)
+      alloc_ = std::move(v.alloc_);
+    take(v);
+  } else {
+    clear();
+    reserve(v.size_);
+    std::copy(v.words_, v.words_ + words_for(v.size_), words_);
+    size_ = v.size_;
+    v.release();
+  }
+  return *this;
+}
+
+template <typename Allocator>
+typename vector<bool, Allocator>::reference vector<bool, Allocator>::at(
+    size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return (*this)[pos];
+}
+
+template <typename Allocator>
+bool vector<bool, Allocator>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return test(pos);
+}
+
+template <typename Allocator>
+typename vector<bool, Allocator>::reference
+vector<bool, Allocator>::operator[](size_type pos) {
+  S21_CHECK(pos < size_, "Index out of range");
+  return reference(words_ + pos / bits_per_word,
+                   word_type{1} << (pos % bits_per_word));
+}
+
+template <typename Allocator>
+bool vector<bool, Allocator>::operator[](size_type pos) const {
+  S21_CHECK(pos < size_, "Index out of range");
+  return test(pos);
+}
+
+template <typename Allocator>
+bool vector<bool, Allocator>::front() const {
+  if (empty()) {
+    throw std::out_of_range("FrontError: vector is empty");
+  }
+  return test(0U);
+}
+
+template <typename Allocator>
+bool vector<bool, Allocator>::back() const {
+  if (empty()) {
+    throw std::out_of_range("BackError: vector is empty");
+  }
+  return test(size_ - 1);
+}
+
+template <typename Allocator>
+typename vector<bool, Allocator>::size_type vector<bool, Allocator>::max_size()
+    const noexcept {
+  size_type words = word_traits::max_size(alloc_);
+  return words > npos / bits_per_word ? npos : words * bits_per_word;
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::out_of_range("ReserveError: new capacity exceeds max_size");
+  }
+  if (words_for(size) > capacity_) reallocate(words_for(size));
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::shrink_to_fit() {
+  if (capacity_ > words_for(size_)) reallocate(words_for(size_));
+}
+
+// Вставка и удаление сдвигают хвост по словам: каждый бит слова переходит
+// на соседнюю позицию, старший переносится в следующее слово.
+template <typename Allocator>
+typename vector<bool, Allocator>::iterator vector<bool, Allocator>::insert(
+    const_iterator pos, bool value) {
+  const size_type index = pos.index();
+  if (index > size_) {
+    throw std::out_of_range("InsertError: Index out of range");
+  }
+  push_back(false);
+  const size_type first = index / bits_per_word;
+  const size_type last = words_for(size_);
+  const size_type offset = index % bits_per_word;
+  for (size_type w = last - 1; w > first; --w)
+    words_[w] = (words_[w] << 1) | (words_[w - 1] >> (bits_per_word - 1));
+  const word_type low = (word_type{1} << offset) - 1;
+  words_[first] = (words_[first] & low) | ((words_[first] & ~low) << 1);
+  assign_bit(index, value);
+  clear_tail();
+  return iterator(words_, index);
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::erase(iterator pos) {
+  const size_type index = pos.index();
+  if (index >= size_) {
+    throw std::out_of_range("EraseError: Index out of range");
+  }
+  const size_type first = index / bits_per_word;
+  const size_type last = words_for(size_);
+  const word_type low = (word_type{1} << (index % bits_per_word)) - 1;
+  word_type high = (words_[first] >> 1) & ~low;
+  words_[first] = (words_[first] & low) | high;
+  for (size_type w = first + 1; w < last; ++w) {
+    words_[w - 1] |= words_[w] << (bits_per_word - 1);
+    words_[w] >>= 1;
+  }
+  --size_;
+  clear_tail();
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::push_back(bool value) {
+  if (size_ == capacity_ * bits_per_word) reallocate(grown_words(size_ + 1));
+  if (size_ % bits_per_word == 0U) words_[size_ / bits_per_word] = 0U;
+  assign_bit(size_++, value);
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::pop_back() {
+  if (size_ > 0U) {
+    --size_;
+    clear_tail();
+  }
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::resize(size_type count, bool value) {
+  if (count <= size_) {
+    size_ = count;
+    clear_tail();
+    return;
+  }
+  if (words_for(count) > capacity_) reallocate(grown_words(count));
+  const size_type old_words = words_for(size_);
+  const word_type fill = value ? ~word_type{0} : word_type{0};
+  if (size_ % bits_per_word != 0U && value)
+    words_[old_words - 1] |= ~word_type{0} << (size_ % bits_per_word);
+  std::fill(words_ + old_words, words_ + words_for(count), fill);
+  size_ = count;
+  clear_tail();
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::swap(vector &other) noexcept {
+  std::swap(words_, other.words_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  if constexpr (word_traits::propagate_on_container_swap::value)
+    std::swap(alloc_, other.alloc_);
+}
+
+template <typename Allocator>
+typename vector<bool, Allocator>::size_type vector<bool, Allocator>::count()
+    const noexcept {
+  size_type total = 0;
+  const size_type n = words_for(size_);
+  for (size_type w = 0; w < n; ++w) total += detail::popcount(words_[w]);
+  return total;
+}
+
+template <typename Allocator>
+typename vector<bool, Allocator>::size_type vector<bool, Allocator>::find_next(
+    size_type pos) const noexcept {
+  return pos == npos || pos + 1 >= size_ ? npos : find_next_from(pos + 1);
+}
+
+template <typename Allocator>
+typename vector<bool, Allocator>::size_type
+vector<bool, Allocator>::find_next_from(size_type pos) const noexcept {
+  if (pos >= size_) return npos;
+  size_type w = pos / bits_per_word;
+  word_type word = words_[w] & (~word_type{0} << (pos % bits_per_word));
+  const size_type n = words_for(size_);
+  while (word == 0U) {
+    if (++w == n) return npos;
+    word = words_[w];
+  }
+  return w * bits_per_word + detail::trailing_zeros(word);
+}
+
+template <typename Allocator>
+vector<bool, Allocator> &vector<bool, Allocator>::flip() noexcept {
+  const size_type n = words_for(size_);
+  for (size_type w = 0; w < n; ++w) words_[w] = ~words_[w];
+  clear_tail();
+  return *this;
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::flip(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("FlipError: Index out of range");
+  }
+  (*this)[pos].flip();
+}
+
+template <typename Allocator>
+vector<bool, Allocator> &vector<bool, Allocator>::operator&=(
+    const vector &other) {
+  check_same_size(other);
+  const size_type n = words_for(size_);
+  for (size_type w = 0; w < n; ++w) words_[w] &= other.words_[w];
+  return *this;
+}
+
+template <typename Allocator>
+vector<bool, Allocator> &vector<bool, Allocator>::operator|=(
+    const vector &other) {
+  check_same_size(other);
+  const size_type n = words_for(size_);
+  for (size_type w = 0; w < n; ++w) words_[w] |= other.words_[w];
+  return *this;
+}
+
+template <typename Allocator>
+vector<bool, Allocator> &vector<bool, Allocator>::operator^=(
+    const vector &other) {
+  check_same_size(other);
+  const size_type n = words_for(size_);
+  for (size_type w = 0; w < n; ++w) words_[w] ^= other.words_[w];
+  return *this;
+}
+
+template <typename Allocator>
+bool vector<bool, Allocator>::operator==(const vector &other) const noexcept {
+  return size_ == other.size_ &&
+         std::equal(words_, words_ + words_for(size_), other.words_);
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::clear_tail() noexcept {
+  if (size_ % bits_per_word != 0U)
+    words_[size_ / bits_per_word] &=
+        (word_type{1} << (size_ % bits_per_word)) - 1;
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::reallocate(size_type new_words) {
+  word_type *fresh =
+      new_words == 0U ? nullptr : word_traits::allocate(alloc_, new_words);
+  const size_type used = std::min(words_for(size_), new_words);
+  std::copy(words_, words_ + used, fresh);
+  if (words_ != nullptr) word_traits::deallocate(alloc_, words_, capacity_);
+  words_ = fresh;
+  capacity_ = new_words;
+}
+
+template <typename Allocator>
+typename vector<bool, Allocator>::size_type
+vector<bool, Allocator>::grown_words(size_type bits) const {
+  if (bits > max_size()) {
+    throw std::length_error("s21::vector<bool> exceeds max_size()");
+  }
+  return std::max(words_for(bits), capacity_ * 2);
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::check_same_size(const vector &other) const {
+  if (size_ != other.size_) {
+    throw std::invalid_argument("BitwiseError: vector sizes differ");
+  }
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::release() noexcept {
+  if (words_ != nullptr) word_traits::deallocate(alloc_, words_, capacity_);
+  words_ = nullptr;
+  size_ = 0U;
+  capacity_ = 0U;
+}
+
+template <typename Allocator>
+void vector<bool, Allocator>::take(vector &v) noexcept {
+  words_ = std::exchange(v.words_, nullptr);
+  size_ = std::exchange(v.size_, 0U);
+  capacity_ = std::exchange(v.capacity_, 0U);
+}
+
+template <typename Allocator>
+vector<bool, Allocator> operator&(vector<bool, Allocator> lhs,
+                                  const vector<bool, Allocator> &rhs) {
+  return lhs &= rhs;
+}
+
+template <typename Allocator>
+vector<bool, Allocator> operator|(vector<bool, Allocator> lhs,
+                                  const vector<bool, Allocator> &rhs) {
+  return lhs |= rhs;
+}
+
+template <typename Allocator>
+vector<bool, Allocator> operator^(vector<bool, Allocator> lhs,
+                                  const vector<bool, Allocator> &rhs) {
+  return lhs ^= rhs;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_VECTOR_BOOL_H
@@ -1,29 +1,61 @@
 #ifndef CPP2_S21_CONTAINERS_VECTOR_ITERATOR_H
 #define CPP2_S21_CONTAINERS_VECTOR_ITERATOR_H
 
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../s21_checked.h"
+
 namespace s21 {
 
+// Указатель с интерфейсом random access итератора. В сборке S21_CHECKED
+// итератор помнит границы элементов контейнера на момент создания и не даёт
+// разыменовать или сдвинуть себя за их пределы.
 template <typename T, bool Const>
 class vectorIterator {
  public:
-  using value_type = std::conditional_t<Const, const T, T>;
+  using value_type = std::remove_cv_t<T>;
   using pointer = std::conditional_t<Const, const T *, T *>;
   using reference = std::conditional_t<Const, const T &, T &>;
   using iterator_category = std::random_access_iterator_tag;
   using difference_type = std::ptrdiff_t;
 
   explicit vectorIterator(pointer ptr) : ptr_(ptr) {}
+  vectorIterator(pointer ptr, [[maybe_unused]] pointer first,
+                 [[maybe_unused]] pointer last)
+      : ptr_(ptr)
+#ifdef S21_CHECKED
+        ,
+        first_(first),
+        last_(last)
+#endif
+  {
+  }
 
   template <bool OtherConst>
   constexpr vectorIterator(const vectorIterator<T, OtherConst> &other) noexcept
-      : ptr_(other.operator->()) {}
+      : ptr_(other.ptr_)
+#ifdef S21_CHECKED
+        ,
+        first_(other.first_),
+        last_(other.last_)
+#endif
+  {
+  }
 
   vectorIterator() = default;
 
-  reference operator*() { return *ptr_; }
+  reference operator*() const {
+    check_dereferenceable(ptr_);
+    return *ptr_;
+  }
   pointer operator->() const { return ptr_; }
-  reference operator[](int m) { return ptr_[m]; }
-  reference value() { return *ptr_; }
+  reference operator[](difference_type n) const {
+    check_dereferenceable(ptr_ + n);
+    return ptr_[n];
+  }
+  reference value() const { return **this; }
 
   vectorIterator operator++(int);
   vectorIterator operator--(int);
@@ -36,47 +68,78 @@ class vectorIterator {
   bool operator>(const vectorIterator &other) const;
   bool operator<=(const vectorIterator &other) const;
   bool operator>=(const vectorIterator &other) const;
-  vectorIterator operator+(int n) const;
-  vectorIterator operator-(int n) const;
-  typename vectorIterator::difference_type operator-(
-      const vectorIterator &other) const;
+  vectorIterator operator+(difference_type n) const;
+  vectorIterator operator-(difference_type n) const;
+  difference_type operator-(const vectorIterator &other) const;
+
+  vectorIterator &operator+=(difference_type n);
+  vectorIterator &operator-=(difference_type n);
 
-  vectorIterator &operator+=(int n);
+  friend vectorIterator operator+(difference_type n, const vectorIterator &it) {
+    return it + n;
+  }
 
  private:
+  template <typename, bool>
+  friend class vectorIterator;
+
+  void check_dereferenceable([[maybe_unused]] pointer p) const {
+#ifdef S21_CHECKED
+    S21_CHECK(first_ == nullptr || (first_ <= p && p < last_),
+              "vectorIterator: dereference out of range");
+#endif
+  }
+
+  void check_reachable([[maybe_unused]] pointer p) const {
+#ifdef S21_CHECKED
+    S21_CHECK(first_ == nullptr || (first_ <= p && p <= last_),
+              "vectorIterator: moved out of range");
+#endif
+  }
+
   pointer ptr_;
+#ifdef S21_CHECKED
+  pointer first_ = nullptr;
+  pointer last_ = nullptr;
+#endif
 };
 
 template <typename T, bool Const>
-vectorIterator<T, Const> &vectorIterator<T, Const>::operator+=(int n) {
+vectorIterator<T, Const> &vectorIterator<T, Const>::operator+=(
+    difference_type n) {
+  check_reachable(ptr_ + n);
   ptr_ += n;
   return *this;
 }
 
+template <typename T, bool Const>
+vectorIterator<T, Const> &vectorIterator<T, Const>::operator-=(
+    difference_type n) {
+  return *this += -n;
+}
+
 template <typename T, bool Const>
 vectorIterator<T, Const> vectorIterator<T, Const>::operator++(int) {
   vectorIterator temp(*this);
-  ++ptr_;
+  ++*this;
   return temp;
 }
 
 template <typename T, bool Const>
 vectorIterator<T, Const> vectorIterator<T, Const>::operator--(int) {
   vectorIterator temp(*this);
-  --ptr_;
+  --*this;
   return temp;
 }
 
 template <typename T, bool Const>
 vectorIterator<T, Const> &vectorIterator<T, Const>::operator++() {
-  ++ptr_;
-  return *this;
+  return *this += 1;
 }
 
 template <typename T, bool Const>
 vectorIterator<T, Const> &vectorIterator<T, Const>::operator--() {
-  --ptr_;
-  return *this;
+  return *this += -1;
 }
 
 template <typename T, bool Const>
@@ -110,16 +173,18 @@ bool vectorIterator<T, Const>::operator>=(const vectorIterator &other) const {
 }
 
 template <typename T, bool Const>
-vectorIterator<T, Const> vectorIterator<T, Const>::operator+(int n) const {
+vectorIterator<T, Const> vectorIterator<T, Const>::operator+(
+    difference_type n) const {
   vectorIterator temp(*this);
-  temp.ptr_ += n;
+  temp += n;
   return temp;
 }
 
 template <typename T, bool Const>
-vectorIterator<T, Const> vectorIterator<T, Const>::operator-(int n) const {
+vectorIterator<T, Const> vectorIterator<T, Const>::operator-(
+    difference_type n) const {
   vectorIterator temp(*this);
-  temp.ptr_ -= n;
+  temp -= n;
   return temp;
 }
 
@@ -1,7 +1,24 @@
 #ifndef _S21_CONTAINERSPLUS_H_
 #define _S21_CONTAINERSPLUS_H_
 
+#include "s21_containersplus/allocators/s21_allocators.h"
+#include "s21_containersplus/arena/s21_arena.h"
 #include "s21_containersplus/array/s21_array.h"
+#include "s21_containersplus/bitmap_set/s21_bitmap_set.h"
+#include "s21_containersplus/concurrent_vector/s21_concurrent_vector.h"
+#include "s21_containersplus/gap_buffer/s21_gap_buffer.h"
+#include "s21_containersplus/interval_map/s21_interval_map.h"
+#include "s21_containersplus/mmap_vector/s21_mmap_vector.h"
 #include "s21_containersplus/multiset/s21_multiset.h"
+#include "s21_containersplus/packed_vector/s21_packed_vector.h"
+#include "s21_containersplus/parallel/s21_parallel.h"
+#include "s21_containersplus/radix_map/s21_radix_map.h"
+#include "s21_containersplus/rope/s21_rope.h"
+#include "s21_containersplus/segmented_vector/s21_segmented_vector.h"
+#include "s21_containersplus/shared_vector/s21_shared_vector.h"
+#include "s21_containersplus/simd/s21_simd.h"
+#include "s21_containersplus/small_vector/s21_small_vector.h"
+#include "s21_containersplus/soa_vector/s21_soa_vector.h"
+#include "s21_containersplus/span/s21_span.h"
 
 #endif  // _S21_CONTAINERSPLUS_H_
\ No newline at end of file
@@ -0,0 +1,147 @@
+#ifndef _S21_ALLOCATORS_H_
+#define _S21_ALLOCATORS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "../../s21_containers/vector/s21_vector.h"
+
+namespace s21 {
+// Allocator whose blocks start on an Alignment boundary (at least
+// alignof(T)). With 64 every s21::vector buffer begins on a cache line,
+// so aligned 512-bit loads over it never straddle two lines.
+//
+//   s21::aligned_vector<float> samples;  // data() % 64 == 0
+//   s21::vector<float, s21::aligned_allocator<float, 128>> wide;
+template <typename T, std::size_t Alignment = 64>
+class aligned_allocator {
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "alignment must be a power of two");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  static constexpr std::size_t alignment = std::max(Alignment, alignof(T));
+
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Alignment>;
+  };
+
+  aligned_allocator() noexcept = default;
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Alignment> &) noexcept {}
+
+  T *allocate(size_type n) {
+    if (n > max_size()) throw std::bad_array_new_length();
+    return static_cast<T *>(
+        ::operator new(n * sizeof(T), std::align_val_t(alignment)));
+  }
+  void deallocate(T *p, size_type) noexcept {
+    ::operator delete(p, std::align_val_t(alignment));
+  }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+  }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator==(const aligned_allocator<T, Alignment> &,
+                const aligned_allocator<U, Alignment> &) noexcept {
+  return true;
+}
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator!=(const aligned_allocator<T, Alignment> &,
+                const aligned_allocator<U, Alignment> &) noexcept {
+  return false;
+}
+
+// Allocator for multi-gigabyte buffers. Blocks of huge_page_size or more
+// are 2 MB aligned, rounded up to whole 2 MB and marked with
+// madvise(MADV_HUGEPAGE), so the kernel backs them with transparent huge
+// pages and one TLB entry covers 2 MB instead of 4 KB. Where THP are off
+// this is plain memory. Smaller blocks come from aligned_allocator.
+//
+//   s21::huge_page_vector<std::uint64_t> table(std::size_t{1} << 30);
+template <typename T, std::size_t Alignment = 64>
+class huge_page_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  static constexpr std::size_t huge_page_size = std::size_t{2} << 20;
+  static constexpr std::size_t alignment =
+      aligned_allocator<T, Alignment>::alignment;
+
+  template <typename U>
+  struct rebind {
+    using other = huge_page_allocator<U, Alignment>;
+  };
+
+  huge_page_allocator() noexcept = default;
+  template <typename U>
+  huge_page_allocator(const huge_page_allocator<U, Alignment> &) noexcept {}
+
+  T *allocate(size_type n) {
+    if (n > max_size()) throw std::bad_array_new_length();
+    size_type bytes = n * sizeof(T);
+    if (bytes < huge_page_size)
+      return aligned_allocator<T, Alignment>().allocate(n);
+    bytes = rounded(bytes);
+    void *p = ::operator new(bytes, std::align_val_t(huge_page_size));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    ::madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+    return static_cast<T *>(p);
+  }
+  void deallocate(T *p, size_type n) noexcept {
+    if (n * sizeof(T) < huge_page_size) {
+      aligned_allocator<T, Alignment>().deallocate(p, n);
+      return;
+    }
+    ::operator delete(p, std::align_val_t(huge_page_size));
+  }
+  size_type max_size() const noexcept {
+    return (std::numeric_limits<size_type>::max() - huge_page_size) /
+           sizeof(T);
+  }
+
+ private:
+  static size_type rounded(size_type bytes) noexcept {
+    return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+  }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator==(const huge_page_allocator<T, Alignment> &,
+                const huge_page_allocator<U, Alignment> &) noexcept {
+  return true;
+}
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator!=(const huge_page_allocator<T, Alignment> &,
+                const huge_page_allocator<U, Alignment> &) noexcept {
+  return false;
+}
+
+template <typename T, std::size_t Alignment = 64>
+using aligned_vector = vector<T, aligned_allocator<T, Alignment>>;
+
+template <typename T, std::size_t Alignment = 64>
+using huge_page_vector = vector<T, huge_page_allocator<T, Alignment>>;
+}  // namespace s21
+
+#endif  // _S21_ALLOCATORS_H_
@@ -0,0 +1,139 @@
+#ifndef _S21_ARENA_H_
+#define _S21_ARENA_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+namespace s21 {
+// Monotonic bump arena for std::pmr allocators. Allocation moves a pointer
+// inside the current block, deallocation is a no-op, and release() (or the
+// destructor) returns every block to the upstream resource at once. Blocks
+// grow geometrically. Not thread-safe.
+//
+//   s21::monotonic_arena arena;
+//   s21::pmr::vector<int> v(&arena);
+//   s21::pmr::map<int, int> m(&arena);
+class monotonic_arena : public std::pmr::memory_resource {
+ public:
+  using size_type = std::size_t;
+
+  static constexpr size_type kDefaultBlockSize = 4096;
+
+  explicit monotonic_arena(
+      size_type initial_block_size = kDefaultBlockSize,
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+      : upstream_(upstream),
+        next_block_size_(std::max(initial_block_size, kMinBlockSize)),
+        initial_block_size_(next_block_size_) {}
+
+  // Первым используется внешний буфер (например, на стеке); он не
+  // освобождается и переиспользуется после release().
+  monotonic_arena(
+      void *buffer, size_type size,
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+      : upstream_(upstream),
+        initial_begin_(static_cast<char *>(buffer)),
+        initial_end_(static_cast<char *>(buffer) + size),
+        current_(initial_begin_),
+        end_(initial_end_),
+        next_block_size_(std::max(size * 2, kMinBlockSize)),
+        initial_block_size_(next_block_size_) {}
+
+  monotonic_arena(const monotonic_arena &) = delete;
+  monotonic_arena &operator=(const monotonic_arena &) = delete;
+
+  ~monotonic_arena() override { release(); }
+
+  void release() noexcept {
+    while (blocks_ != nullptr) {
+      Block *next = blocks_->next_;
+      upstream_->deallocate(blocks_, blocks_->size_, alignof(Block));
+      blocks_ = next;
+    }
+    current_ = initial_begin_;
+    end_ = initial_end_;
+    next_block_size_ = initial_block_size_;
+    bytes_used_ = 0;
+    bytes_reserved_ = 0;
+    block_count_ = 0;
+  }
+
+  std::pmr::memory_resource *upstream_resource() const { return upstream_; }
+
+  // Байты, выданные контейнерам (с учётом выравнивания).
+  size_type bytes_used() const { return bytes_used_; }
+  // Байты, взятые у upstream, без внешнего буфера.
+  size_type bytes_reserved() const { return bytes_reserved_; }
+  size_type block_count() const { return block_count_; }
+
+ protected:
+  void *do_allocate(size_type bytes, size_type alignment) override {
+    void *p = bump(bytes, alignment);
+    if (p == nullptr) {
+      grow(bytes, alignment);
+      p = bump(bytes, alignment);
+    }
+    return p;
+  }
+
+  void do_deallocate(void *, size_type, size_type) override {}
+
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+ private:
+  struct alignas(std::max_align_t) Block {
+    Block *next_;
+    size_type size_;
+  };
+
+  static constexpr size_type kMinBlockSize = 256;
+
+  void *bump(size_type bytes, size_type alignment) {
+    if (current_ == nullptr) return nullptr;
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(current_);
+    std::uintptr_t aligned = (address + alignment - 1) & ~(alignment - 1);
+    size_type padding = aligned - address;
+    if (padding > static_cast<size_type>(end_ - current_) ||
+        bytes > static_cast<size_type>(end_ - current_) - padding)
+      return nullptr;
+    current_ += padding + bytes;
+    bytes_used_ += padding + bytes;
+    return reinterpret_cast<void *>(aligned);
+  }
+
+  void grow(size_type bytes, size_type alignment) {
+    size_type needed = sizeof(Block) + bytes + alignment;
+    size_type size = std::max(next_block_size_, needed);
+    Block *block =
+        static_cast<Block *>(upstream_->allocate(size, alignof(Block)));
+    block->next_ = blocks_;
+    block->size_ = size;
+    blocks_ = block;
+    current_ = reinterpret_cast<char *>(block + 1);
+    end_ = reinterpret_cast<char *>(block) + size;
+    bytes_reserved_ += size;
+    ++block_count_;
+    next_block_size_ = size * 2;
+  }
+
+  std::pmr::memory_resource *upstream_;
+  char *initial_begin_ = nullptr;
+  char *initial_end_ = nullptr;
+  char *current_ = nullptr;
+  char *end_ = nullptr;
+  Block *blocks_ = nullptr;
+  size_type next_block_size_;
+  size_type initial_block_size_;
+  size_type bytes_used_ = 0;
+  size_type bytes_reserved_ = 0;
+  size_type block_count_ = 0;
+};
+}  // namespace s21
+
+#endif  // _S21_ARENA_H_
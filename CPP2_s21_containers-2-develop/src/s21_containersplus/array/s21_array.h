@@ -6,9 +6,17 @@
 #include <initializer_list>
 #include <stdexcept>
 
+#include "../../s21_containers/s21_checked.h"
+
 namespace s21 {
-template <typename T, std::size_t N>
+// Alignment задаёт выравнивание массива элементов (не меньше alignof(T)):
+// s21::array<float, 16, 64> начинается с границы кэш-линии, и векторные
+// загрузки по нему не пересекают двух линий.
+template <typename T, std::size_t N, std::size_t Alignment = alignof(T)>
 class array {
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "array alignment must be a power of two");
+
  public:
   using value_type = T;
   using reference = T &;
@@ -48,7 +56,7 @@ class array {
   void fill(const_reference value);
 
  private:
-  T elements[N];
+  alignas(T) alignas(Alignment) T elements[N];
 };
 }  // namespace s21
 #include "s21_array.tpp"
@@ -1,11 +1,12 @@
 namespace s21 {
-template <typename value_type, std::size_t N>
-array<value_type, N>::array() {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+array<value_type, N, Alignment>::array() {
   for (size_type i = 0; i < N; i++) elements[i] = value_type();
 }
 
-template <typename value_type, std::size_t N>
-array<value_type, N>::array(std::initializer_list<value_type> const& items)
+template <typename value_type, std::size_t N, std::size_t Alignment>
+array<value_type, N, Alignment>::array(
+    std::initializer_list<value_type> const& items)
     : array() {
   size_type i = 0;
   for (const auto& item : items) {
@@ -17,121 +18,124 @@ array<value_type, N>::array(std::initializer_list<value_type> const& items)
   for (; i < N; ++i) elements[i] = value_type();
 }
 
-template <typename value_type, std::size_t N>
-array<value_type, N>::array(const array& a) {
-  for (size_type i = 0; i < N; i++) {
-    elements[i] = a.elements[i];
-  }
+template <typename value_type, std::size_t N, std::size_t Alignment>
+array<value_type, N, Alignment>::array(const array& a) {
+  std::copy(a.elements, a.elements + N, elements);
 }
 
-template <typename value_type, std::size_t N>
-array<value_type, N>::array(array&& a) noexcept {
-  for (size_type i = 0; i < N; i++) elements[i] = std::move(a.elements[i]);
+template <typename value_type, std::size_t N, std::size_t Alignment>
+array<value_type, N, Alignment>::array(array&& a) noexcept {
+  std::move(a.elements, a.elements + N, elements);
 }
 
-template <typename value_type, std::size_t N>
-array<value_type, N>::~array() {}
+template <typename value_type, std::size_t N, std::size_t Alignment>
+array<value_type, N, Alignment>::~array() {}
 
-template <typename value_type, std::size_t N>
-value_type& array<value_type, N>::at(std::size_t pos) {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+value_type& array<value_type, N, Alignment>::at(std::size_t pos) {
   if (pos >= N) throw std::out_of_range("out of Index array");
   return elements[pos];
 }
 
-template <typename value_type, std::size_t N>
-const value_type& array<value_type, N>::at(std::size_t pos) const {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+const value_type& array<value_type, N, Alignment>::at(std::size_t pos) const {
   if (pos >= N) throw std::out_of_range("out of Index array");
   return elements[pos];
 }
 
-template <typename value_type, std::size_t N>
-value_type& array<value_type, N>::operator[](size_type pos) {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+value_type& array<value_type, N, Alignment>::operator[](size_type pos) {
+  S21_CHECK(pos < N, "out of Index array");
   return this->elements[pos];
 }
-template <typename value_type, std::size_t N>
-const value_type& array<value_type, N>::operator[](size_type pos) const {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+const value_type& array<value_type, N, Alignment>::operator[](
+    size_type pos) const {
+  S21_CHECK(pos < N, "out of Index array");
   return this->elements[pos];
 }
 
-template <typename value_type, std::size_t N>
-const value_type& array<value_type, N>::front() const {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+const value_type& array<value_type, N, Alignment>::front() const {
   return elements[0];
 }
 
-template <typename value_type, std::size_t N>
-const value_type& array<value_type, N>::back() const {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+const value_type& array<value_type, N, Alignment>::back() const {
   return elements[N - 1];
 }
 
-template <typename value_type, std::size_t N>
-array<value_type, N>& array<value_type, N>::operator=(array&& a) noexcept {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+array<value_type, N, Alignment>& array<value_type, N, Alignment>::operator=(
+    array&& a) noexcept {
   if (this != &a) {
-    for (size_type i = 0; i < N; i++) elements[i] = std::move(a.elements[i]);
+    std::move(a.elements, a.elements + N, elements);
   }
   return *this;
 }
 
-template <typename value_type, std::size_t N>
-const array<value_type, N>& array<value_type, N>::operator=(const array& a) {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+const array<value_type, N, Alignment>&
+array<value_type, N, Alignment>::operator=(const array& a) {
   if (this != &a) {
     std::copy(a.elements, a.elements + N, elements);
   }
   return *this;
 }
 
-template <typename value_type, std::size_t N>
-value_type* array<value_type, N>::data() {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+value_type* array<value_type, N, Alignment>::data() {
   return elements;
 }
 
-template <typename value_type, std::size_t N>
-const value_type* array<value_type, N>::data() const {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+const value_type* array<value_type, N, Alignment>::data() const {
   return elements;
 }
 
-template <typename value_type, std::size_t N>
-value_type* array<value_type, N>::begin() {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+value_type* array<value_type, N, Alignment>::begin() {
   return elements;
 }
 
-template <typename value_type, std::size_t N>
-const value_type* array<value_type, N>::begin() const {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+const value_type* array<value_type, N, Alignment>::begin() const {
   return elements;
 }
 
-template <typename value_type, std::size_t N>
-const value_type* array<value_type, N>::end() const {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+const value_type* array<value_type, N, Alignment>::end() const {
   return elements + N;
 }
 
-template <typename value_type, std::size_t N>
-value_type* array<value_type, N>::end() {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+value_type* array<value_type, N, Alignment>::end() {
   return elements + N;
 }
 
-template <typename value_type, std::size_t N>
-bool array<value_type, N>::empty() const {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+bool array<value_type, N, Alignment>::empty() const {
   return N == 0;
 }
 
-template <typename value_type, std::size_t N>
-std::size_t array<value_type, N>::size() const {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+std::size_t array<value_type, N, Alignment>::size() const {
   return N;
 }
 
-template <typename value_type, std::size_t N>
-std::size_t array<value_type, N>::max_size() const {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+std::size_t array<value_type, N, Alignment>::max_size() const {
   return N;
 }
 
-template <typename value_type, std::size_t N>
-void array<value_type, N>::swap(array& other) {
+template <typename value_type, std::size_t N, std::size_t Alignment>
+void array<value_type, N, Alignment>::swap(array& other) {
   std::swap(elements, other.elements);
 }
 
-template <typename value_type, std::size_t N>
-void array<value_type, N>::fill(const_reference value) {
-  for (size_type i = 0; i < N; i++) elements[i] = value;
+template <typename value_type, std::size_t N, std::size_t Alignment>
+void array<value_type, N, Alignment>::fill(const_reference value) {
+  std::fill_n(elements, N, value);
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -0,0 +1,197 @@
+#ifndef _S21_BITMAP_SET_H_
+#define _S21_BITMAP_SET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "../../s21_containers/s21_bits.h"
+#include "../../s21_containers/set/s21_set.h"
+
+namespace s21 {
+// Compressed set of unsigned integers split into chunks of 2^16 values by
+// the high bits (Roaring layout). A chunk is a sorted array while it holds
+// at most 4096 values, a 8 KiB bitmap above that, or a list of runs after
+// run_optimize() when runs are smaller. Bitmap chunks are combined and
+// counted a 64-bit word at a time.
+template <typename T = std::uint32_t>
+class bitmap_set {
+  static_assert(std::is_unsigned<T>::value && sizeof(T) <= 4,
+                "bitmap_set holds unsigned integers of up to 32 bits");
+
+ public:
+  class IteratorBitmap;
+
+  using key_type = T;
+  using value_type = T;
+  using size_type = std::size_t;
+  using iterator = IteratorBitmap;
+  using const_iterator = IteratorBitmap;
+
+ protected:
+  enum class Kind : std::uint8_t { kArray, kBitmap, kRun };
+
+  struct Run {
+    std::uint16_t start_;
+    std::uint16_t last_;  // включительно
+  };
+
+  struct Chunk {
+    std::uint16_t key_ = 0;
+    Kind kind_ = Kind::kArray;
+    std::uint32_t cardinality_ = 0;
+    std::vector<std::uint16_t> array_;
+    std::vector<std::uint64_t> words_;
+    std::vector<Run> runs_;
+  };
+
+  static constexpr std::uint32_t kArrayLimit = 4096;
+  static constexpr std::size_t kWords = 1024;
+
+  std::vector<Chunk> chunks_;
+  size_type size_ = 0;
+
+ public:
+  class IteratorBitmap {
+    friend class bitmap_set<T>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = T;
+
+    IteratorBitmap() : set_(nullptr), chunk_(0), low_(0), pos_(0) {}
+
+    value_type operator*() const {
+      return static_cast<value_type>(
+          (static_cast<std::uint32_t>(set_->chunks_[chunk_].key_) << 16) |
+          low_);
+    }
+
+    IteratorBitmap &operator++() {
+      if (!next_in_chunk(set_->chunks_[chunk_], low_, pos_)) {
+        ++chunk_;
+        if (chunk_ < set_->chunks_.size())
+          first_in_chunk(set_->chunks_[chunk_], low_, pos_);
+      }
+      return *this;
+    }
+
+    IteratorBitmap operator++(int) {
+      IteratorBitmap temp = *this;
+      ++(*this);
+      return temp;
+    }
+
+    bool operator==(const IteratorBitmap &other) const {
+      return chunk_ == other.chunk_ && (is_end() || low_ == other.low_);
+    }
+
+    bool operator!=(const IteratorBitmap &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    IteratorBitmap(const bitmap_set<T> *set, size_type chunk)
+        : set_(set), chunk_(chunk), low_(0), pos_(0) {
+      if (!is_end()) first_in_chunk(set_->chunks_[chunk_], low_, pos_);
+    }
+
+    bool is_end() const {
+      return set_ == nullptr || chunk_ >= set_->chunks_.size();
+    }
+
+    const bitmap_set<T> *set_;
+    size_type chunk_;
+    std::uint32_t low_;
+    size_type pos_;
+  };
+
+  bitmap_set();
+  bitmap_set(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  bitmap_set(InputIt first, InputIt last);
+  bitmap_set(const bitmap_set &other) = default;
+  bitmap_set(bitmap_set &&other) noexcept;
+  ~bitmap_set() = default;
+
+  bitmap_set &operator=(const bitmap_set &other) = default;
+  bitmap_set &operator=(bitmap_set &&other) noexcept;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  void clear();
+  void swap(bitmap_set &other) noexcept;
+
+  bool insert(value_type value);
+  void insert_range(value_type first, value_type last);
+  size_type erase(value_type value);
+  bool contains(value_type value) const;
+  size_type rank(value_type value) const;
+
+  bitmap_set &operator|=(const bitmap_set &other);
+  bitmap_set &operator&=(const bitmap_set &other);
+
+  void run_optimize();
+  size_type memory_usage() const;
+  set<value_type> to_set() const;
+
+ private:
+  static long next_set_bit(const std::vector<std::uint64_t> &words,
+                           std::uint32_t from);
+  static size_type count_words(const std::vector<std::uint64_t> &words);
+
+  template <typename Fn>
+  static void for_each(const Chunk &chunk, Fn fn);
+  static void first_in_chunk(const Chunk &chunk, std::uint32_t &low,
+                             size_type &pos);
+  static bool next_in_chunk(const Chunk &chunk, std::uint32_t &low,
+                            size_type &pos);
+
+  static bool chunk_contains(const Chunk &chunk, std::uint16_t low);
+  static bool chunk_add(Chunk &chunk, std::uint16_t low);
+  static bool chunk_remove(Chunk &chunk, std::uint16_t low);
+  static void chunk_add_range(Chunk &chunk, std::uint32_t first,
+                              std::uint32_t last);
+  static size_type chunk_rank(const Chunk &chunk, std::uint16_t low);
+  static void chunk_union(Chunk &chunk, const Chunk &other);
+  static void chunk_intersect(Chunk &chunk, const Chunk &other);
+
+  static void to_bitmap(Chunk &chunk);
+  static void to_array(Chunk &chunk);
+  static void to_runs(Chunk &chunk);
+  static void make_mutable(Chunk &chunk);
+  static size_type count_runs(const Chunk &chunk);
+
+  typename std::vector<Chunk>::iterator chunk_position(std::uint16_t key);
+  typename std::vector<Chunk>::const_iterator chunk_position(
+      std::uint16_t key) const;
+  Chunk &chunk_for(std::uint16_t key);
+  void recount();
+};
+
+template <typename T>
+bitmap_set<T> operator|(bitmap_set<T> left, const bitmap_set<T> &right) {
+  left |= right;
+  return left;
+}
+
+template <typename T>
+bitmap_set<T> operator&(bitmap_set<T> left, const bitmap_set<T> &right) {
+  left &= right;
+  return left;
+}
+}  // namespace s21
+
+#include "s21_bitmap_set.tpp"
+
+#endif  // _S21_BITMAP_SET_H_
@@ -0,0 +1,552 @@
+namespace s21 {
+template <typename T>
+bitmap_set<T>::bitmap_set() : chunks_(), size_(0) {}
+
+template <typename T>
+bitmap_set<T>::bitmap_set(std::initializer_list<value_type> const &items)
+    : bitmap_set() {
+  for (value_type item : items) insert(item);
+}
+
+template <typename T>
+template <typename InputIt>
+bitmap_set<T>::bitmap_set(InputIt first, InputIt last) : bitmap_set() {
+  for (; first != last; ++first) insert(static_cast<value_type>(*first));
+}
+
+template <typename T>
+bitmap_set<T>::bitmap_set(bitmap_set &&other) noexcept
+    : chunks_(std::move(other.chunks_)), size_(other.size_) {
+  other.chunks_.clear();
+  other.size_ = 0;
+}
+
+template <typename T>
+bitmap_set<T> &bitmap_set<T>::operator=(bitmap_set &&other) noexcept {
+  if (this != &other) {
+    chunks_ = std::move(other.chunks_);
+    size_ = other.size_;
+    other.chunks_.clear();
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+template <typename T>
+typename bitmap_set<T>::iterator bitmap_set<T>::begin() const {
+  return iterator(this, 0);
+}
+
+template <typename T>
+typename bitmap_set<T>::iterator bitmap_set<T>::end() const {
+  return iterator(this, chunks_.size());
+}
+
+template <typename T>
+bool bitmap_set<T>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T>
+typename bitmap_set<T>::size_type bitmap_set<T>::size() const {
+  return size_;
+}
+
+template <typename T>
+void bitmap_set<T>::clear() {
+  chunks_.clear();
+  size_ = 0;
+}
+
+template <typename T>
+void bitmap_set<T>::swap(bitmap_set &other) noexcept {
+  std::swap(chunks_, other.chunks_);
+  std::swap(size_, other.size_);
+}
+
+template <typename T>
+bool bitmap_set<T>::insert(value_type value) {
+  std::uint32_t v = value;
+  if (!chunk_add(chunk_for(static_cast<std::uint16_t>(v >> 16)),
+                 static_cast<std::uint16_t>(v & 0xFFFFU)))
+    return false;
+  ++size_;
+  return true;
+}
+
+// Вставляет [first, last]; целые чанки заполняются словами, а не по битам.
+template <typename T>
+void bitmap_set<T>::insert_range(value_type first, value_type last) {
+  if (last < first) return;
+  std::uint32_t from = first;
+  std::uint32_t to = last;
+  for (std::uint32_t key = from >> 16; key <= (to >> 16); ++key) {
+    std::uint32_t low = key == (from >> 16) ? (from & 0xFFFFU) : 0U;
+    std::uint32_t high = key == (to >> 16) ? (to & 0xFFFFU) : 0xFFFFU;
+    Chunk &chunk = chunk_for(static_cast<std::uint16_t>(key));
+    size_ -= chunk.cardinality_;
+    chunk_add_range(chunk, low, high);
+    size_ += chunk.cardinality_;
+  }
+}
+
+template <typename T>
+typename bitmap_set<T>::size_type bitmap_set<T>::erase(value_type value) {
+  std::uint32_t v = value;
+  auto it = chunk_position(static_cast<std::uint16_t>(v >> 16));
+  if (it == chunks_.end() || it->key_ != (v >> 16)) return 0;
+  if (!chunk_remove(*it, static_cast<std::uint16_t>(v & 0xFFFFU))) return 0;
+  if (it->cardinality_ == 0) chunks_.erase(it);
+  --size_;
+  return 1;
+}
+
+template <typename T>
+bool bitmap_set<T>::contains(value_type value) const {
+  std::uint32_t v = value;
+  auto it = chunk_position(static_cast<std::uint16_t>(v >> 16));
+  return it != chunks_.end() && it->key_ == (v >> 16) &&
+         chunk_contains(*it, static_cast<std::uint16_t>(v & 0xFFFFU));
+}
+
+// Число элементов, не превосходящих value.
+template <typename T>
+typename bitmap_set<T>::size_type bitmap_set<T>::rank(value_type value) const {
+  std::uint32_t v = value;
+  size_type result = 0;
+  for (const Chunk &chunk : chunks_) {
+    if (chunk.key_ < (v >> 16)) {
+      result += chunk.cardinality_;
+    } else {
+      if (chunk.key_ == (v >> 16))
+        result += chunk_rank(chunk, static_cast<std::uint16_t>(v & 0xFFFFU));
+      break;
+    }
+  }
+  return result;
+}
+
+template <typename T>
+bitmap_set<T> &bitmap_set<T>::operator|=(const bitmap_set &other) {
+  if (this == &other) return *this;
+  std::vector<Chunk> merged;
+  merged.reserve(chunks_.size() + other.chunks_.size());
+  auto mine = chunks_.begin();
+  auto theirs = other.chunks_.begin();
+  while (mine != chunks_.end() || theirs != other.chunks_.end()) {
+    if (theirs == other.chunks_.end() ||
+        (mine != chunks_.end() && mine->key_ < theirs->key_)) {
+      merged.push_back(std::move(*mine++));
+    } else if (mine == chunks_.end() || theirs->key_ < mine->key_) {
+      merged.push_back(*theirs++);
+    } else {
+      chunk_union(*mine, *theirs++);
+      merged.push_back(std::move(*mine++));
+    }
+  }
+  chunks_ = std::move(merged);
+  recount();
+  return *this;
+}
+
+template <typename T>
+bitmap_set<T> &bitmap_set<T>::operator&=(const bitmap_set &other) {
+  if (this == &other) return *this;
+  std::vector<Chunk> common;
+  auto mine = chunks_.begin();
+  auto theirs = other.chunks_.begin();
+  while (mine != chunks_.end() && theirs != other.chunks_.end()) {
+    if (mine->key_ < theirs->key_) {
+      ++mine;
+    } else if (theirs->key_ < mine->key_) {
+      ++theirs;
+    } else {
+      chunk_intersect(*mine, *theirs++);
+      if (mine->cardinality_ != 0) common.push_back(std::move(*mine));
+      ++mine;
+    }
+  }
+  chunks_ = std::move(common);
+  recount();
+  return *this;
+}
+
+// Переводит чанки в список отрезков там, где он занимает меньше памяти.
+template <typename T>
+void bitmap_set<T>::run_optimize() {
+  for (Chunk &chunk : chunks_) {
+    if (chunk.kind_ == Kind::kRun) continue;
+    size_type current = chunk.kind_ == Kind::kArray
+                            ? chunk.cardinality_ * sizeof(std::uint16_t)
+                            : kWords * sizeof(std::uint64_t);
+    if (count_runs(chunk) * sizeof(Run) < current) to_runs(chunk);
+  }
+}
+
+template <typename T>
+typename bitmap_set<T>::size_type bitmap_set<T>::memory_usage() const {
+  size_type bytes = sizeof(*this) + chunks_.capacity() * sizeof(Chunk);
+  for (const Chunk &chunk : chunks_) {
+    bytes += chunk.array_.capacity() * sizeof(std::uint16_t) +
+             chunk.words_.capacity() * sizeof(std::uint64_t) +
+             chunk.runs_.capacity() * sizeof(Run);
+  }
+  return bytes;
+}
+
+template <typename T>
+set<typename bitmap_set<T>::value_type> bitmap_set<T>::to_set() const {
+  set<value_type> result;
+  for (value_type value : *this) result.insert(value);
+  return result;
+}
+
+template <typename T>
+long bitmap_set<T>::next_set_bit(const std::vector<std::uint64_t> &words,
+                                 std::uint32_t from) {
+  if (from >= kWords * 64) return -1;
+  size_type index = from >> 6;
+  std::uint64_t word = words[index] & (~0ULL << (from & 63U));
+  while (word == 0) {
+    if (++index == kWords) return -1;
+    word = words[index];
+  }
+  return static_cast<long>(index * 64 + detail::trailing_zeros(word));
+}
+
+template <typename T>
+typename bitmap_set<T>::size_type bitmap_set<T>::count_words(
+    const std::vector<std::uint64_t> &words) {
+  size_type result = 0;
+  for (std::uint64_t word : words) result += detail::popcount(word);
+  return result;
+}
+
+template <typename T>
+template <typename Fn>
+void bitmap_set<T>::for_each(const Chunk &chunk, Fn fn) {
+  if (chunk.kind_ == Kind::kArray) {
+    for (std::uint16_t low : chunk.array_) fn(low);
+  } else if (chunk.kind_ == Kind::kBitmap) {
+    for (size_type i = 0; i < kWords; ++i) {
+      for (std::uint64_t word = chunk.words_[i]; word != 0; word &= word - 1)
+        fn(static_cast<std::uint16_t>(i * 64 + detail::trailing_zeros(word)));
+    }
+  } else {
+    for (const Run &run : chunk.runs_) {
+      for (std::uint32_t low = run.start_; low <= run.last_; ++low)
+        fn(static_cast<std::uint16_t>(low));
+    }
+  }
+}
+
+template <typename T>
+void bitmap_set<T>::first_in_chunk(const Chunk &chunk, std::uint32_t &low,
+                                   size_type &pos) {
+  pos = 0;
+  if (chunk.kind_ == Kind::kArray)
+    low = chunk.array_[0];
+  else if (chunk.kind_ == Kind::kBitmap)
+    low = static_cast<std::uint32_t>(next_set_bit(chunk.words_, 0));
+  else
+    low = chunk.runs_[0].start_;
+}
+
+template <typename T>
+bool bitmap_set<T>::next_in_chunk(const Chunk &chunk, std::uint32_t &low,
+                                  size_type &pos) {
+  if (chunk.kind_ == Kind::kArray) {
+    if (++pos >= chunk.array_.size()) return false;
+    low = chunk.array_[pos];
+  } else if (chunk.kind_ == Kind::kBitmap) {
+    long next = next_set_bit(chunk.words_, low + 1);
+    if (next < 0) return false;
+    low = static_cast<std::uint32_t>(next);
+  } else if (low < chunk.runs_[pos].last_) {
+    ++low;
+  } else {
+    if (++pos >= chunk.runs_.size()) return false;
+    low = chunk.runs_[pos].start_;
+  }
+  return true;
+}
+
+template <typename T>
+bool bitmap_set<T>::chunk_contains(const Chunk &chunk, std::uint16_t low) {
+  if (chunk.kind_ == Kind::kArray)
+    return std::binary_search(chunk.array_.begin(), chunk.array_.end(), low);
+  if (chunk.kind_ == Kind::kBitmap)
+    return (chunk.words_[low >> 6] >> (low & 63U)) & 1U;
+  auto it = std::upper_bound(
+      chunk.runs_.begin(), chunk.runs_.end(), low,
+      [](std::uint16_t value, const Run &run) { return value < run.start_; });
+  return it != chunk.runs_.begin() && low <= (it - 1)->last_;
+}
+
+template <typename T>
+bool bitmap_set<T>::chunk_add(Chunk &chunk, std::uint16_t low) {
+  make_mutable(chunk);
+  if (chunk.kind_ == Kind::kArray) {
+    auto it = std::lower_bound(chunk.array_.begin(), chunk.array_.end(), low);
+    if (it != chunk.array_.end() && *it == low) return false;
+    if (chunk.cardinality_ < kArrayLimit) {
+      chunk.array_.insert(it, low);
+      ++chunk.cardinality_;
+      return true;
+    }
+    to_bitmap(chunk);
+  }
+  std::uint64_t &word = chunk.words_[low >> 6];
+  std::uint64_t bit = 1ULL << (low & 63U);
+  if (word & bit) return false;
+  word |= bit;
+  ++chunk.cardinality_;
+  return true;
+}
+
+template <typename T>
+bool bitmap_set<T>::chunk_remove(Chunk &chunk, std::uint16_t low) {
+  make_mutable(chunk);
+  if (chunk.kind_ == Kind::kArray) {
+    auto it = std::lower_bound(chunk.array_.begin(), chunk.array_.end(), low);
+    if (it == chunk.array_.end() || *it != low) return false;
+    chunk.array_.erase(it);
+    --chunk.cardinality_;
+    return true;
+  }
+  std::uint64_t &word = chunk.words_[low >> 6];
+  std::uint64_t bit = 1ULL << (low & 63U);
+  if (!(word & bit)) return false;
+  word &= ~bit;
+  if (--chunk.cardinality_ <= kArrayLimit) to_array(chunk);
+  return true;
+}
+
+template <typename T>
+void bitmap_set<T>::chunk_add_range(Chunk &chunk, std::uint32_t first,
+                                    std::uint32_t last) {
+  if (first == 0 && last == 0xFFFFU) {
+    chunk.array_.clear();
+    chunk.words_.clear();
+    chunk.runs_.assign(1, Run{0, 0xFFFFU});
+    chunk.kind_ = Kind::kRun;
+    chunk.cardinality_ = 0x10000U;
+    return;
+  }
+  make_mutable(chunk);
+  if (chunk.kind_ == Kind::kArray &&
+      chunk.cardinality_ + (last - first + 1) <= kArrayLimit) {
+    for (std::uint32_t low = first; low <= last; ++low)
+      chunk_add(chunk, static_cast<std::uint16_t>(low));
+    return;
+  }
+  if (chunk.kind_ == Kind::kArray) to_bitmap(chunk);
+  size_type first_word = first >> 6;
+  size_type last_word = last >> 6;
+  std::uint64_t head = ~0ULL << (first & 63U);
+  std::uint64_t tail = ~0ULL >> (63U - (last & 63U));
+  if (first_word == last_word) {
+    chunk.words_[first_word] |= head & tail;
+  } else {
+    chunk.words_[first_word] |= head;
+    for (size_type i = first_word + 1; i < last_word; ++i)
+      chunk.words_[i] = ~0ULL;
+    chunk.words_[last_word] |= tail;
+  }
+  chunk.cardinality_ = static_cast<std::uint32_t>(count_words(chunk.words_));
+}
+
+template <typename T>
+typename bitmap_set<T>::size_type bitmap_set<T>::chunk_rank(const Chunk &chunk,
+                                                            std::uint16_t low) {
+  if (chunk.kind_ == Kind::kArray) {
+    return std::upper_bound(chunk.array_.begin(), chunk.array_.end(), low) -
+           chunk.array_.begin();
+  }
+  if (chunk.kind_ == Kind::kBitmap) {
+    size_type result = 0;
+    size_type index = low >> 6;
+    for (size_type i = 0; i < index; ++i)
+      result += detail::popcount(chunk.words_[i]);
+    std::uint64_t mask = ~0ULL >> (63U - (low & 63U));
+    return result + detail::popcount(chunk.words_[index] & mask);
+  }
+  size_type result = 0;
+  for (const Run &run : chunk.runs_) {
+    if (run.start_ > low) break;
+    result += std::min<std::uint32_t>(run.last_, low) - run.start_ + 1;
+  }
+  return result;
+}
+
+template <typename T>
+void bitmap_set<T>::chunk_union(Chunk &chunk, const Chunk &other) {
+  if (other.kind_ == Kind::kRun) {
+    Chunk copy = other;
+    make_mutable(copy);
+    chunk_union(chunk, copy);
+    return;
+  }
+  make_mutable(chunk);
+  if (chunk.kind_ == Kind::kArray && other.kind_ == Kind::kArray &&
+      chunk.cardinality_ + other.cardinality_ <= kArrayLimit) {
+    std::vector<std::uint16_t> merged;
+    merged.reserve(chunk.cardinality_ + other.cardinality_);
+    std::set_union(chunk.array_.begin(), chunk.array_.end(),
+                   other.array_.begin(), other.array_.end(),
+                   std::back_inserter(merged));
+    chunk.array_ = std::move(merged);
+    chunk.cardinality_ = static_cast<std::uint32_t>(chunk.array_.size());
+    return;
+  }
+  if (chunk.kind_ == Kind::kArray) to_bitmap(chunk);
+  if (other.kind_ == Kind::kBitmap) {
+    for (size_type i = 0; i < kWords; ++i) chunk.words_[i] |= other.words_[i];
+  } else {
+    for (std::uint16_t low : other.array_)
+      chunk.words_[low >> 6] |= 1ULL << (low & 63U);
+  }
+  chunk.cardinality_ = static_cast<std::uint32_t>(count_words(chunk.words_));
+}
+
+template <typename T>
+void bitmap_set<T>::chunk_intersect(Chunk &chunk, const Chunk &other) {
+  if (other.kind_ == Kind::kRun) {
+    Chunk copy = other;
+    make_mutable(copy);
+    chunk_intersect(chunk, copy);
+    return;
+  }
+  make_mutable(chunk);
+  if (chunk.kind_ == Kind::kBitmap && other.kind_ == Kind::kBitmap) {
+    for (size_type i = 0; i < kWords; ++i) chunk.words_[i] &= other.words_[i];
+    chunk.cardinality_ = static_cast<std::uint32_t>(count_words(chunk.words_));
+    if (chunk.cardinality_ <= kArrayLimit) to_array(chunk);
+    return;
+  }
+  std::vector<std::uint16_t> common;
+  if (chunk.kind_ == Kind::kArray && other.kind_ == Kind::kArray) {
+    std::set_intersection(chunk.array_.begin(), chunk.array_.end(),
+                          other.array_.begin(), other.array_.end(),
+                          std::back_inserter(common));
+  } else {
+    const Chunk &sparse = chunk.kind_ == Kind::kArray ? chunk : other;
+    const Chunk &dense = chunk.kind_ == Kind::kArray ? other : chunk;
+    for (std::uint16_t low : sparse.array_)
+      if (chunk_contains(dense, low)) common.push_back(low);
+  }
+  chunk.words_.clear();
+  chunk.words_.shrink_to_fit();
+  chunk.array_ = std::move(common);
+  chunk.kind_ = Kind::kArray;
+  chunk.cardinality_ = static_cast<std::uint32_t>(chunk.array_.size());
+}
+
+template <typename T>
+void bitmap_set<T>::to_bitmap(Chunk &chunk) {
+  std::vector<std::uint64_t> words(kWords, 0);
+  for_each(chunk, [&words](std::uint16_t low) {
+    words[low >> 6] |= 1ULL << (low & 63U);
+  });
+  chunk.words_ = std::move(words);
+  chunk.array_.clear();
+  chunk.array_.shrink_to_fit();
+  chunk.runs_.clear();
+  chunk.runs_.shrink_to_fit();
+  chunk.kind_ = Kind::kBitmap;
+}
+
+template <typename T>
+void bitmap_set<T>::to_array(Chunk &chunk) {
+  std::vector<std::uint16_t> values;
+  values.reserve(chunk.cardinality_);
+  for_each(chunk, [&values](std::uint16_t low) { values.push_back(low); });
+  chunk.array_ = std::move(values);
+  chunk.words_.clear();
+  chunk.words_.shrink_to_fit();
+  chunk.runs_.clear();
+  chunk.runs_.shrink_to_fit();
+  chunk.kind_ = Kind::kArray;
+}
+
+template <typename T>
+void bitmap_set<T>::to_runs(Chunk &chunk) {
+  std::vector<Run> runs;
+  runs.reserve(count_runs(chunk));
+  for_each(chunk, [&runs](std::uint16_t low) {
+    if (!runs.empty() && runs.back().last_ + 1U == low)
+      runs.back().last_ = low;
+    else
+      runs.push_back(Run{low, low});
+  });
+  chunk.runs_ = std::move(runs);
+  chunk.array_.clear();
+  chunk.array_.shrink_to_fit();
+  chunk.words_.clear();
+  chunk.words_.shrink_to_fit();
+  chunk.kind_ = Kind::kRun;
+}
+
+// Отрезки изменяемыми не бывают: перед вставкой или удалением чанк
+// возвращается к массиву или битовой карте.
+template <typename T>
+void bitmap_set<T>::make_mutable(Chunk &chunk) {
+  if (chunk.kind_ != Kind::kRun) return;
+  if (chunk.cardinality_ > kArrayLimit)
+    to_bitmap(chunk);
+  else
+    to_array(chunk);
+}
+
+// Начало отрезка: бит установлен, а предыдущий нет.
+template <typename T>
+typename bitmap_set<T>::size_type bitmap_set<T>::count_runs(
+    const Chunk &chunk) {
+  if (chunk.kind_ == Kind::kRun) return chunk.runs_.size();
+  size_type runs = 0;
+  if (chunk.kind_ == Kind::kArray) {
+    for (size_type i = 0; i < chunk.array_.size(); ++i)
+      if (i == 0 || chunk.array_[i - 1] + 1U != chunk.array_[i]) ++runs;
+    return runs;
+  }
+  std::uint64_t carry = 0;
+  for (std::uint64_t word : chunk.words_) {
+    runs += detail::popcount(word & ~((word << 1) | carry));
+    carry = word >> 63;
+  }
+  return runs;
+}
+
+template <typename T>
+typename std::vector<typename bitmap_set<T>::Chunk>::iterator
+bitmap_set<T>::chunk_position(std::uint16_t key) {
+  return std::lower_bound(
+      chunks_.begin(), chunks_.end(), key,
+      [](const Chunk &chunk, std::uint16_t k) { return chunk.key_ < k; });
+}
+
+template <typename T>
+typename std::vector<typename bitmap_set<T>::Chunk>::const_iterator
+bitmap_set<T>::chunk_position(std::uint16_t key) const {
+  return std::lower_bound(
+      chunks_.begin(), chunks_.end(), key,
+      [](const Chunk &chunk, std::uint16_t k) { return chunk.key_ < k; });
+}
+
+template <typename T>
+typename bitmap_set<T>::Chunk &bitmap_set<T>::chunk_for(std::uint16_t key) {
+  auto it = chunk_position(key);
+  if (it == chunks_.end() || it->key_ != key) {
+    Chunk chunk;
+    chunk.key_ = key;
+    it = chunks_.insert(it, std::move(chunk));
+  }
+  return *it;
+}
+
+template <typename T>
+void bitmap_set<T>::recount() {
+  size_ = 0;
+  for (const Chunk &chunk : chunks_) size_ += chunk.cardinality_;
+}
+}  // namespace s21
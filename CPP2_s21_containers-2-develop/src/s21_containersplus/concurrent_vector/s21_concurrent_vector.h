@@ -0,0 +1,143 @@
+#ifndef _S21_CONCURRENT_VECTOR_H_
+#define _S21_CONCURRENT_VECTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "../segmented_vector/s21_segmented_vector.h"
+
+namespace s21 {
+// Append-only vector for many producer threads. push_back, emplace_back
+// and grow_by install the segments their slots need, reserve the slots
+// with a CAS on the size and construct in place; segments are laid out as
+// in segmented_vector and installed with a CAS too, so elements never
+// move and no lock is taken. Each slot has
+// a ready bit that is set with release order after construction:
+// is_published(i) and at(i) tell whether element i can be read from
+// another thread; operator[] trusts the caller (an index returned by its
+// own push_back, or everything after the producers are joined).
+//
+// size() counts reserved slots and may run ahead of construction, but
+// never past installed segments. A slot whose constructor threw stays
+// unpublished. clear(), swap, assignment and destruction require that no
+// other thread uses the vector.
+//
+// Producers call the allocator concurrently (allocate for new segments,
+// construct for elements), so it must be thread-safe: std::allocator
+// and std::pmr::synchronized_pool_resource are, monotonic_arena and
+// unsynchronized_pool_resource are not.
+template <typename T, typename Allocator = std::allocator<T>>
+class concurrent_vector {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = segmentedIterator<concurrent_vector, false>;
+  using const_iterator = segmentedIterator<concurrent_vector, true>;
+
+  static constexpr size_type first_segment =
+      segmented_vector<T, Allocator>::first_segment;
+  static constexpr size_type max_segments =
+      segmented_vector<T, Allocator>::max_segments;
+
+  concurrent_vector() noexcept(noexcept(Allocator())) = default;
+  explicit concurrent_vector(const allocator_type &alloc) noexcept
+      : alloc_(alloc) {}
+  concurrent_vector(const concurrent_vector &) = delete;
+  concurrent_vector(concurrent_vector &&other) noexcept;
+  ~concurrent_vector();
+  concurrent_vector &operator=(const concurrent_vector &) = delete;
+  concurrent_vector &operator=(concurrent_vector &&other) noexcept(
+      std::allocator_traits<Allocator>::is_always_equal::value ||
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value);
+
+  allocator_type get_allocator() const { return alloc_; }
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  bool is_published(size_type pos) const noexcept;
+
+  iterator begin() noexcept { return iterator(this, 0U); }
+  iterator end() noexcept { return iterator(this, size()); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0U); }
+  const_iterator cend() const noexcept {
+    return const_iterator(this, size());
+  }
+
+  bool empty() const noexcept { return size() == 0U; }
+  size_type size() const noexcept {
+    return size_.load(std::memory_order_acquire);
+  }
+  size_type capacity() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+
+  void clear() noexcept;
+  void swap(concurrent_vector &other) noexcept;
+
+  // Безопасны при одновременном вызове из любого числа потоков.
+  iterator push_back(const_reference value);
+  iterator push_back(value_type &&value);
+  template <class... Args>
+  iterator emplace_back(Args &&...args);
+  // Резервирует count подряд идущих слотов одним fetch_add и заполняет их
+  // value-инициализированными (или копиями value) элементами.
+  iterator grow_by(size_type count);
+  iterator grow_by(size_type count, const_reference value);
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using word_type = std::uint64_t;
+
+  struct segment {
+    T *data;
+    std::atomic<word_type> *ready;
+  };
+
+  static size_type segment_of(size_type pos) noexcept {
+    unsigned long long v = pos / first_segment + 1;
+    return std::numeric_limits<unsigned long long>::digits - 1 -
+           __builtin_clzll(v);
+  }
+  static size_type segment_begin(size_type k) noexcept {
+    return (first_segment << k) - first_segment;
+  }
+  static size_type segment_size(size_type k) noexcept {
+    return first_segment << k;
+  }
+
+  size_type claim(size_type count);
+  segment *segment_at(size_type k);
+  segment *find_segment(size_type pos) const noexcept {
+    return segments_[segment_of(pos)].load(std::memory_order_acquire);
+  }
+  T *slot(size_type pos) const noexcept {
+    return find_segment(pos)->data + (pos - segment_begin(segment_of(pos)));
+  }
+  template <class... Args>
+  void construct_at(size_type pos, Args &&...args);
+  void release() noexcept;
+  // Забирает сегменты other; аллокаторы должны быть равны.
+  void take(concurrent_vector &other) noexcept;
+
+  std::atomic<segment *> segments_[max_segments] = {};
+  std::atomic<size_type> size_{0};
+  allocator_type alloc_;
+};
+}  // namespace s21
+
+#include "s21_concurrent_vector.tpp"
+
+#endif  // _S21_CONCURRENT_VECTOR_H_
@@ -0,0 +1,257 @@
+namespace s21 {
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector(
+    concurrent_vector &&other) noexcept
+    : alloc_(std::move(other.alloc_)) {
+  take(other);
+}
+
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::~concurrent_vector() {
+  release();
+}
+
+// Сегменты забираются целиком, только если аллокаторы совместимы; иначе
+// опубликованные элементы перемещаются поштучно в память своего
+// аллокатора (неопубликованные слоты при этом выпадают).
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator> &concurrent_vector<T, Allocator>::operator=(
+    concurrent_vector &&other) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value) {
+  if (this == &other) return *this;
+  if (alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_ == other.alloc_) {
+    release();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+      alloc_ = std::move(other.alloc_);
+    take(other);
+  } else {
+    clear();
+    const size_type count = other.size();
+    reserve(count);
+    for (size_type i = 0; i < count; ++i)
+      if (other.is_published(i)) emplace_back(std::move(*other.slot(i)));
+    other.release();
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::at(size_type pos) {
+  if (!is_published(pos)) {
+    throw std::out_of_range("AtError: element is not published");
+  }
+  return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::at(size_type pos) const {
+  if (!is_published(pos)) {
+    throw std::out_of_range("AtError: element is not published");
+  }
+  return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::operator[](size_type pos) {
+  S21_CHECK(is_published(pos), "Index out of range");
+  return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::operator[](size_type pos) const {
+  S21_CHECK(is_published(pos), "Index out of range");
+  return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+bool concurrent_vector<T, Allocator>::is_published(
+    size_type pos) const noexcept {
+  if (pos >= size()) return false;
+  const segment *s = find_segment(pos);
+  if (s == nullptr) return false;
+  size_type offset = pos - segment_begin(segment_of(pos));
+  word_type word = s->ready[offset / 64].load(std::memory_order_acquire);
+  return (word >> (offset % 64)) & 1U;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::capacity() const noexcept {
+  size_type k = 0;
+  while (k < max_segments &&
+         segments_[k].load(std::memory_order_acquire) != nullptr)
+    ++k;
+  return segment_begin(k);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::max_size() const noexcept {
+  return std::min(segment_begin(max_segments - 1),
+                  alloc_traits::max_size(alloc_));
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("ReserveError: new capacity exceeds max_size");
+  }
+  if (size == 0U) return;
+  for (size_type k = 0; k <= segment_of(size - 1); ++k) segment_at(k);
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::clear() noexcept {
+  for (size_type k = 0; k < max_segments; ++k) {
+    segment *s = segments_[k].load(std::memory_order_relaxed);
+    if (s == nullptr) continue;
+    const size_type words = (segment_size(k) + 63) / 64;
+    for (size_type w = 0; w < words; ++w) {
+      word_type bits = s->ready[w].exchange(0U, std::memory_order_relaxed);
+      while (bits != 0U) {
+        size_type bit = __builtin_ctzll(bits);
+        alloc_traits::destroy(alloc_, s->data + w * 64 + bit);
+        bits &= bits - 1;
+      }
+    }
+  }
+  size_.store(0U, std::memory_order_release);
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::swap(concurrent_vector &other) noexcept {
+  for (size_type k = 0; k < max_segments; ++k)
+    segments_[k].store(other.segments_[k].exchange(
+                           segments_[k].load(std::memory_order_relaxed)),
+                       std::memory_order_relaxed);
+  size_.store(other.size_.exchange(size_.load(std::memory_order_relaxed)),
+              std::memory_order_relaxed);
+  if constexpr (alloc_traits::propagate_on_container_swap::value)
+    std::swap(alloc_, other.alloc_);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::push_back(const_reference value) {
+  return emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::push_back(value_type &&value) {
+  return emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::emplace_back(Args &&...args) {
+  size_type pos = claim(1U);
+  construct_at(pos, std::forward<Args>(args)...);
+  return iterator(this, pos);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::grow_by(size_type count) {
+  size_type first = claim(count);
+  for (size_type i = 0; i < count; ++i) construct_at(first + i);
+  return iterator(this, first);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::grow_by(size_type count,
+                                         const_reference value) {
+  size_type first = claim(count);
+  for (size_type i = 0; i < count; ++i) construct_at(first + i, value);
+  return iterator(this, first);
+}
+
+// Занимает count слотов. Предел и сегменты проверяются до того, как
+// новый размер станет виден: если max_size превышен или allocate бросил,
+// size() не изменился, и за ним нет слотов без сегмента. Проигравший CAS
+// повторяет с новым размером; уже установленные сегменты пригодятся.
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::claim(size_type count) {
+  size_type first = size_.load(std::memory_order_acquire);
+  if (count == 0U) return first;
+  do {
+    if (first > max_size() || count > max_size() - first) {
+      throw std::length_error("s21::concurrent_vector exceeds max_size()");
+    }
+    const size_type last = segment_of(first + count - 1);
+    for (size_type k = segment_of(first); k <= last; ++k) segment_at(k);
+  } while (!size_.compare_exchange_weak(first, first + count,
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_acquire));
+  return first;
+}
+
+// Сегмент k создаётся тем, кто первым до него дошёл. Проигравшие гонку
+// CAS освобождают свою копию; ожидания нет ни у кого.
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::segment *
+concurrent_vector<T, Allocator>::segment_at(size_type k) {
+  segment *current = segments_[k].load(std::memory_order_acquire);
+  if (current != nullptr) return current;
+
+  const size_type n = segment_size(k);
+  auto fresh = std::make_unique<segment>();
+  fresh->data = alloc_traits::allocate(alloc_, n);
+  try {
+    fresh->ready = new std::atomic<word_type>[(n + 63) / 64]();
+  } catch (...) {
+    alloc_traits::deallocate(alloc_, fresh->data, n);
+    throw;
+  }
+  if (segments_[k].compare_exchange_strong(current, fresh.get(),
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_acquire))
+    return fresh.release();
+  alloc_traits::deallocate(alloc_, fresh->data, n);
+  delete[] fresh->ready;
+  return current;
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+void concurrent_vector<T, Allocator>::construct_at(size_type pos,
+                                                   Args &&...args) {
+  const size_type k = segment_of(pos);
+  const size_type offset = pos - segment_begin(k);
+  segment *s = segments_[k].load(std::memory_order_acquire);
+  alloc_traits::construct(alloc_, s->data + offset,
+                          std::forward<Args>(args)...);
+  s->ready[offset / 64].fetch_or(word_type{1} << (offset % 64),
+                                 std::memory_order_release);
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::release() noexcept {
+  clear();
+  for (size_type k = 0; k < max_segments; ++k) {
+    segment *s = segments_[k].exchange(nullptr, std::memory_order_relaxed);
+    if (s == nullptr) continue;
+    alloc_traits::deallocate(alloc_, s->data, segment_size(k));
+    delete[] s->ready;
+    delete s;
+  }
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::take(concurrent_vector &other) noexcept {
+  for (size_type k = 0; k < max_segments; ++k)
+    segments_[k].store(other.segments_[k].exchange(nullptr),
+                       std::memory_order_relaxed);
+  size_.store(other.size_.exchange(0U), std::memory_order_relaxed);
+}
+}  // namespace s21
@@ -0,0 +1,155 @@
+#ifndef _S21_GAP_BUFFER_H_
+#define _S21_GAP_BUFFER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/vector/s21_vector.h"
+#include "../segmented_vector/s21_segmented_vector.h"
+
+namespace s21 {
+// Sequence with a gap of free slots at the cursor, as in text editors.
+// Element i lives at i before the cursor and at i + gap size after it.
+// Insertions and erasures at the cursor only move the gap's edge, so
+// typing or deleting at one place is O(1) amortized however long the
+// buffer is; moving the cursor by d relocates d elements. Any insert or
+// erase first moves the cursor to its position and leaves it right after
+// the inserted (or at the erased) elements. Reading is random access as
+// in s21::vector, with index iterators that survive edits.
+//
+//   s21::gap_buffer<char32_t> text(content.begin(), content.end());
+//   text.move_cursor(offset);
+//   text.insert(text.begin() + offset, U'x');  // at the cursor: O(1)
+//   text.erase_before_cursor();                // backspace
+template <typename T, typename Allocator = std::allocator<T>>
+class gap_buffer {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "gap_buffer moves elements across the gap with noexcept "
+                "moves");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = segmentedIterator<gap_buffer, false>;
+  using const_iterator = segmentedIterator<gap_buffer, true>;
+
+  gap_buffer() noexcept(noexcept(Allocator())) = default;
+  explicit gap_buffer(const allocator_type &alloc) noexcept : alloc_(alloc) {}
+  explicit gap_buffer(size_type n,
+                      const allocator_type &alloc = allocator_type());
+  gap_buffer(std::initializer_list<T> const &items,
+             const allocator_type &alloc = allocator_type());
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  gap_buffer(InputIt first, InputIt last,
+             const allocator_type &alloc = allocator_type());
+  gap_buffer(const gap_buffer &other);
+  gap_buffer(gap_buffer &&other) noexcept;
+  ~gap_buffer();
+  gap_buffer &operator=(const gap_buffer &other);
+  gap_buffer &operator=(gap_buffer &&other) noexcept(
+      std::allocator_traits<Allocator>::is_always_equal::value ||
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value);
+
+  allocator_type get_allocator() const { return alloc_; }
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  iterator begin() noexcept { return iterator(this, 0U); }
+  iterator end() noexcept { return iterator(this, size()); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0U); }
+  const_iterator cend() const noexcept {
+    return const_iterator(this, size());
+  }
+
+  bool empty() const noexcept { return size() == 0U; }
+  size_type size() const noexcept {
+    return capacity_ - (gap_end_ - gap_begin_);
+  }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept {
+    return alloc_traits::max_size(alloc_);
+  }
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  size_type cursor() const noexcept { return gap_begin_; }
+  void move_cursor(size_type pos);
+
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type &&value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  // Удаление count элементов перед курсором (backspace) и после него
+  // (delete); курсор остаётся между теми же соседями.
+  void erase_before_cursor(size_type count = 1);
+  void erase_after_cursor(size_type count = 1);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void swap(gap_buffer &other) noexcept;
+
+  // fn(first, last) для куска до курсора и куска после него (пустые
+  // пропускаются): так буфер пишется в файл двумя блоками.
+  template <typename Fn>
+  void for_each_segment(Fn fn);
+  template <typename Fn>
+  void for_each_segment(Fn fn) const;
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static constexpr bool kBitwise = is_trivially_relocatable<T>::value;
+
+  size_type physical(size_type pos) const noexcept {
+    return pos < gap_begin_ ? pos : pos + (gap_end_ - gap_begin_);
+  }
+  void relocate(T *from, T *to, size_type count) noexcept;
+  template <class... Args>
+  void construct_at_cursor(Args &&...args);
+  void make_room(size_type count);
+  void reallocate(size_type new_capacity);
+  void destroy_all() noexcept;
+  void release() noexcept;
+  // Забирает буфер other; аллокаторы должны быть равны.
+  void take(gap_buffer &other) noexcept;
+
+  T *data_ = nullptr;
+  size_type capacity_ = 0;
+  size_type gap_begin_ = 0;
+  size_type gap_end_ = 0;
+  allocator_type alloc_;
+};
+}  // namespace s21
+
+#include "s21_gap_buffer.tpp"
+
+#endif  // _S21_GAP_BUFFER_H_
@@ -0,0 +1,435 @@
+namespace s21 {
+template <typename T, typename Allocator>
+gap_buffer<T, Allocator>::gap_buffer(size_type n, const allocator_type &alloc)
+    : alloc_(alloc) {
+  try {
+    reserve(n);
+    while (gap_begin_ < n) construct_at_cursor();
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
+gap_buffer<T, Allocator>::gap_buffer(std::initializer_list<T> const &items,
+                                     const allocator_type &alloc)
+    : gap_buffer(items.begin(), items.end(), alloc) {}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+gap_buffer<T, Allocator>::gap_buffer(InputIt first, InputIt last,
+                                     const allocator_type &alloc)
+    : alloc_(alloc) {
+  try {
+    insert(cend(), first, last);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
+gap_buffer<T, Allocator>::gap_buffer(const gap_buffer &other)
+    : alloc_(alloc_traits::select_on_container_copy_construction(
+          other.alloc_)) {
+  try {
+    reserve(other.size());
+    other.for_each_segment([this](const T *first, const T *last) {
+      for (; first != last; ++first) construct_at_cursor(*first);
+    });
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
+gap_buffer<T, Allocator>::gap_buffer(gap_buffer &&other) noexcept
+    : alloc_(std::move(other.alloc_)) {
+  take(other);
+}
+
+template <typename T, typename Allocator>
+gap_buffer<T, Allocator>::~gap_buffer() {
+  release();
+}
+
+// Копия строится аллокатором, который будет у *this после присваивания,
+// и только потом забирается: буфер всегда освобождает тот аллокатор, что
+// его выделил.
+template <typename T, typename Allocator>
+gap_buffer<T, Allocator> &gap_buffer<T, Allocator>::operator=(
+    const gap_buffer &other) {
+  if (this == &other) return *this;
+  gap_buffer copy(alloc_traits::propagate_on_container_copy_assignment::value
+                      ? other.alloc_
+                      : alloc_);
+  copy.reserve(other.size());
+  other.for_each_segment([&copy](const T *first, const T *last) {
+    for (; first != last; ++first) copy.construct_at_cursor(*first);
+  });
+  release();
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+    alloc_ = other.alloc_;
+  take(copy);
+  return *this;
+}
+
+// Буфер забирается целиком, только если аллокаторы совместимы; иначе
+// элементы перемещаются поштучно в память своего аллокатора.
+template <typename T, typename Allocator>
+gap_buffer<T, Allocator> &gap_buffer<T, Allocator>::operator=(
+    gap_buffer &&other) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value) {
+  if (this == &other) return *this;
+  if (alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_ == other.alloc_) {
+    release();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+      alloc_ = std::move(other.alloc_);
+    take(other);
+  } else {
+    clear();
+    reserve(other.size());
+    other.for_each_segment([this](T *first, T *last) {
+      for (; first != last; ++first) construct_at_cursor(std::move(*first));
+    });
+    other.release();
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::reference gap_buffer<T, Allocator>::at(
+    size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return data_[physical(pos)];
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::const_reference
+gap_buffer<T, Allocator>::at(size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return data_[physical(pos)];
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::reference
+gap_buffer<T, Allocator>::operator[](size_type pos) {
+  S21_CHECK(pos < size(), "Index out of range");
+  return data_[physical(pos)];
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::const_reference
+gap_buffer<T, Allocator>::operator[](size_type pos) const {
+  S21_CHECK(pos < size(), "Index out of range");
+  return data_[physical(pos)];
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::reference
+gap_buffer<T, Allocator>::front() {
+  if (empty()) {
+    throw std::out_of_range("FrontError: gap_buffer is empty");
+  }
+  return data_[physical(0U)];
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::const_reference
+gap_buffer<T, Allocator>::front() const {
+  if (empty()) {
+    throw std::out_of_range("FrontError: gap_buffer is empty");
+  }
+  return data_[physical(0U)];
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::reference gap_buffer<T, Allocator>::back() {
+  if (empty()) {
+    throw std::out_of_range("BackError: gap_buffer is empty");
+  }
+  return data_[physical(size() - 1)];
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::const_reference
+gap_buffer<T, Allocator>::back() const {
+  if (empty()) {
+    throw std::out_of_range("BackError: gap_buffer is empty");
+  }
+  return data_[physical(size() - 1)];
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("ReserveError: new capacity exceeds max_size");
+  }
+  if (size > capacity_) reallocate(size);
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::shrink_to_fit() {
+  if (size() < capacity_) reallocate(size());
+}
+
+// Переносятся только элементы между старым и новым положением курсора.
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::move_cursor(size_type pos) {
+  if (pos > size()) {
+    throw std::out_of_range("CursorError: Index out of range");
+  }
+  if (pos < gap_begin_) {
+    size_type count = gap_begin_ - pos;
+    relocate(data_ + pos, data_ + gap_end_ - count, count);
+    gap_begin_ -= count;
+    gap_end_ -= count;
+  } else if (pos > gap_begin_) {
+    size_type count = pos - gap_begin_;
+    relocate(data_ + gap_end_, data_ + gap_begin_, count);
+    gap_begin_ += count;
+    gap_end_ += count;
+  }
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::clear() noexcept {
+  destroy_all();
+  gap_begin_ = 0U;
+  gap_end_ = capacity_;
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::iterator gap_buffer<T, Allocator>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::iterator gap_buffer<T, Allocator>::insert(
+    const_iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::iterator gap_buffer<T, Allocator>::insert(
+    const_iterator pos, size_type count, const_reference value) {
+  size_type index = pos.index();
+  value_type copy(value);
+  move_cursor(index);
+  make_room(count);
+  for (size_type i = 0; i < count; ++i) construct_at_cursor(copy);
+  return iterator(this, index);
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+typename gap_buffer<T, Allocator>::iterator gap_buffer<T, Allocator>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  size_type index = pos.index();
+  move_cursor(index);
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    make_room(static_cast<size_type>(std::distance(first, last)));
+  }
+  for (; first != last; ++first) {
+    make_room(1U);
+    construct_at_cursor(*first);
+  }
+  return iterator(this, index);
+}
+
+// Значение сначала собирается во временном объекте: аргумент может
+// ссылаться на элемент буфера, который переедет при сдвиге курсора.
+template <typename T, typename Allocator>
+template <class... Args>
+typename gap_buffer<T, Allocator>::iterator gap_buffer<T, Allocator>::emplace(
+    const_iterator pos, Args &&...args) {
+  size_type index = pos.index();
+  value_type value(std::forward<Args>(args)...);
+  move_cursor(index);
+  make_room(1U);
+  construct_at_cursor(std::move(value));
+  return iterator(this, index);
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::iterator gap_buffer<T, Allocator>::erase(
+    const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename T, typename Allocator>
+typename gap_buffer<T, Allocator>::iterator gap_buffer<T, Allocator>::erase(
+    const_iterator first, const_iterator last) {
+  size_type index = first.index();
+  S21_CHECK(first <= last && last.index() <= size(), "Index out of range");
+  move_cursor(index);
+  erase_after_cursor(last.index() - index);
+  return iterator(this, index);
+}
+
+// Как в редакторе: backspace в начале текста ничего не удаляет, поэтому
+// count ограничивается числом элементов с нужной стороны курсора.
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::erase_before_cursor(size_type count) {
+  count = std::min(count, gap_begin_);
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_type i = gap_begin_ - count; i < gap_begin_; ++i)
+      alloc_traits::destroy(alloc_, data_ + i);
+  }
+  gap_begin_ -= count;
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::erase_after_cursor(size_type count) {
+  count = std::min(count, capacity_ - gap_end_);
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_type i = gap_end_; i < gap_end_ + count; ++i)
+      alloc_traits::destroy(alloc_, data_ + i);
+  }
+  gap_end_ += count;
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+typename gap_buffer<T, Allocator>::reference
+gap_buffer<T, Allocator>::emplace_back(Args &&...args) {
+  return *emplace(cend(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::pop_back() {
+  if (empty()) return;
+  move_cursor(size());
+  erase_before_cursor();
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::swap(gap_buffer &other) noexcept {
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(gap_begin_, other.gap_begin_);
+  std::swap(gap_end_, other.gap_end_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value)
+    std::swap(alloc_, other.alloc_);
+}
+
+template <typename T, typename Allocator>
+template <typename Fn>
+void gap_buffer<T, Allocator>::for_each_segment(Fn fn) {
+  if (gap_begin_ > 0U) fn(data_, data_ + gap_begin_);
+  if (gap_end_ < capacity_) fn(data_ + gap_end_, data_ + capacity_);
+}
+
+template <typename T, typename Allocator>
+template <typename Fn>
+void gap_buffer<T, Allocator>::for_each_segment(Fn fn) const {
+  const T *data = data_;
+  if (gap_begin_ > 0U) fn(data, data + gap_begin_);
+  if (gap_end_ < capacity_) fn(data + gap_end_, data + capacity_);
+}
+
+// Переносит count элементов из from в to; области могут перекрываться,
+// поэтому порядок обхода выбирается по направлению сдвига.
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::relocate(T *from, T *to,
+                                        size_type count) noexcept {
+  if (count == 0U || from == to) return;
+  if constexpr (kBitwise) {
+    std::memmove(static_cast<void *>(to), static_cast<const void *>(from),
+                 count * sizeof(T));
+  } else if (to < from) {
+    for (size_type i = 0; i < count; ++i) {
+      alloc_traits::construct(alloc_, to + i, std::move(from[i]));
+      alloc_traits::destroy(alloc_, from + i);
+    }
+  } else {
+    for (size_type i = count; i-- > 0U;) {
+      alloc_traits::construct(alloc_, to + i, std::move(from[i]));
+      alloc_traits::destroy(alloc_, from + i);
+    }
+  }
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+void gap_buffer<T, Allocator>::construct_at_cursor(Args &&...args) {
+  alloc_traits::construct(alloc_, data_ + gap_begin_,
+                          std::forward<Args>(args)...);
+  ++gap_begin_;
+}
+
+// Зазор растёт вдвое, так что серия вставок у курсора — амортизированное
+// O(1) на элемент.
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::make_room(size_type count) {
+  if (gap_end_ - gap_begin_ >= count) return;
+  size_type length = size();
+  if (count > max_size() - length) {
+    throw std::length_error("s21::gap_buffer exceeds max_size()");
+  }
+  size_type grown = capacity_ > max_size() / 2 ? max_size() : capacity_ * 2;
+  reallocate(std::max({length + count, grown, size_type{16}}));
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::reallocate(size_type new_capacity) {
+  T *data = new_capacity > 0U ? alloc_traits::allocate(alloc_, new_capacity)
+                              : nullptr;
+  size_type tail = capacity_ - gap_end_;
+  relocate(data_, data, gap_begin_);
+  relocate(data_ + gap_end_, data + new_capacity - tail, tail);
+  if (data_ != nullptr) alloc_traits::deallocate(alloc_, data_, capacity_);
+  data_ = data;
+  capacity_ = new_capacity;
+  gap_end_ = new_capacity - tail;
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::destroy_all() noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_type i = 0; i < gap_begin_; ++i)
+      alloc_traits::destroy(alloc_, data_ + i);
+    for (size_type i = gap_end_; i < capacity_; ++i)
+      alloc_traits::destroy(alloc_, data_ + i);
+  }
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::release() noexcept {
+  destroy_all();
+  if (data_ != nullptr) alloc_traits::deallocate(alloc_, data_, capacity_);
+  data_ = nullptr;
+  capacity_ = gap_begin_ = gap_end_ = 0U;
+}
+
+template <typename T, typename Allocator>
+void gap_buffer<T, Allocator>::take(gap_buffer &other) noexcept {
+  data_ = other.data_;
+  capacity_ = other.capacity_;
+  gap_begin_ = other.gap_begin_;
+  gap_end_ = other.gap_end_;
+  other.data_ = nullptr;
+  other.capacity_ = other.gap_begin_ = other.gap_end_ = 0U;
+}
+}  // namespace s21
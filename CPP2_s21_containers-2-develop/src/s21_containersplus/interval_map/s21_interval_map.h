@@ -0,0 +1,231 @@
+#ifndef _S21_INTERVAL_MAP_H_
+#define _S21_INTERVAL_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Ordered by interval start, each node keeps the largest interval end of its
+// subtree, so overlap queries can skip whole subtrees. Intervals are closed:
+// [low, high]. Several entries may share the same interval.
+template <typename T, typename V>
+class interval_map {
+ public:
+  template <bool Const>
+  class IteratorInterval;
+  class OverlapIterator;
+  class OverlapRange;
+
+  using key_type = std::pair<T, T>;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = IteratorInterval<false>;
+  using const_iterator = IteratorInterval<true>;
+  using overlap_iterator = OverlapIterator;
+  using size_type = std::size_t;
+
+ protected:
+  struct Node {
+    value_type data_;
+    T max_end_;
+    int height_;
+
+    Node *parent_;
+    Node *left_;
+    Node *right_;
+
+    explicit Node(const value_type &data)
+        : data_(data),
+          max_end_(data.first.second),
+          height_(1),
+          parent_(nullptr),
+          left_(nullptr),
+          right_(nullptr) {}
+  };
+
+  Node *root_ = nullptr;
+  size_type size_ = 0;
+
+ public:
+  // Bidirectional iterator in start order. Only the mapped value can be
+  // written through an iterator; iterator converts to const_iterator.
+  template <bool Const>
+  class IteratorInterval {
+    friend class interval_map<T, V>;
+    template <bool>
+    friend class IteratorInterval;
+
+   public:
+    using value_type = interval_map::value_type;
+    using reference =
+        std::conditional_t<Const, const value_type &, value_type &>;
+    using pointer = std::conditional_t<Const, const value_type *, value_type *>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+
+    IteratorInterval() : current_(nullptr), tree_(nullptr) {}
+    IteratorInterval(Node *node, const interval_map<T, V> *tree)
+        : current_(node), tree_(tree) {}
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    IteratorInterval(const IteratorInterval<OtherConst> &other)
+        : current_(other.current_), tree_(other.tree_) {}
+
+    reference operator*() const { return current_->data_; }
+    pointer operator->() const { return &current_->data_; }
+
+    const T &low() const { return current_->data_.first.first; }
+    const T &high() const { return current_->data_.first.second; }
+    std::conditional_t<Const, const mapped_type &, mapped_type &> value()
+        const {
+      return current_->data_.second;
+    }
+
+    IteratorInterval &operator++() {
+      current_ = tree_->next(current_);
+      return *this;
+    }
+
+    IteratorInterval operator++(int) {
+      IteratorInterval temp = *this;
+      ++(*this);
+      return temp;
+    }
+
+    IteratorInterval &operator--() {
+      current_ = current_ == nullptr ? tree_->max(tree_->root_)
+                                     : tree_->prev(current_);
+      return *this;
+    }
+
+    IteratorInterval operator--(int) {
+      IteratorInterval temp = *this;
+      --(*this);
+      return temp;
+    }
+
+    friend bool operator==(const IteratorInterval &a,
+                           const IteratorInterval &b) {
+      return a.current_ == b.current_;
+    }
+
+    friend bool operator!=(const IteratorInterval &a,
+                           const IteratorInterval &b) {
+      return a.current_ != b.current_;
+    }
+
+   protected:
+    Node *current_ = nullptr;
+    const interval_map<T, V> *tree_ = nullptr;
+  };
+
+  // Walks the entries overlapping [low, high] in start order. Nothing is
+  // collected up front: each step resumes the pruned in-order walk from the
+  // current node. Queries are const, so the entries are read-only.
+  class OverlapIterator : public const_iterator {
+    friend class interval_map<T, V>;
+
+   public:
+    OverlapIterator() : const_iterator() {}
+    OverlapIterator(Node *node, const interval_map<T, V> *tree, const T &low,
+                    const T &high)
+        : const_iterator(node, tree), low_(low), high_(high) {}
+
+    OverlapIterator &operator++() {
+      this->current_ = this->tree_->next_overlap(this->current_, low_, high_);
+      return *this;
+    }
+
+    OverlapIterator operator++(int) {
+      OverlapIterator temp = *this;
+      ++(*this);
+      return temp;
+    }
+
+   private:
+    T low_{};
+    T high_{};
+  };
+
+  class OverlapRange {
+   public:
+    OverlapRange(OverlapIterator first) : first_(first) {}
+
+    OverlapIterator begin() const { return first_; }
+    OverlapIterator end() const { return OverlapIterator(); }
+    bool empty() const { return first_ == OverlapIterator(); }
+
+   private:
+    OverlapIterator first_;
+  };
+
+  interval_map();
+  interval_map(std::initializer_list<value_type> const &items);
+  interval_map(const interval_map &other);
+  interval_map(interval_map &&other) noexcept;
+  ~interval_map();
+
+  interval_map &operator=(interval_map &&other) noexcept;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const;
+  size_type size() const;
+  void clear();
+  void swap(interval_map &other) noexcept;
+
+  iterator insert(const T &low, const T &high, const V &value);
+  iterator insert(const value_type &item);
+  void erase(const_iterator pos);
+
+  template <typename InputIt>
+  void bulk_load(InputIt first, InputIt last);
+  void bulk_load(std::initializer_list<value_type> const &items);
+
+  OverlapRange overlaps(const T &low, const T &high) const;
+  OverlapRange stab(const T &point) const;
+  bool any_overlap(const T &low, const T &high) const;
+  size_type count_overlaps(const T &low, const T &high) const;
+
+ private:
+  static int height(const Node *node);
+  static void update(Node *node);
+  static bool key_less(const key_type &a, const key_type &b);
+
+  Node *min(Node *node) const;
+  Node *max(Node *node) const;
+  Node *next(Node *node) const;
+  Node *prev(Node *node) const;
+
+  Node *first_overlap(Node *node, const T &low, const T &high) const;
+  Node *next_overlap(Node *node, const T &low, const T &high) const;
+
+  void replace_child(Node *parent, Node *old_child, Node *new_child);
+  Node *rotate_left(Node *node);
+  Node *rotate_right(Node *node);
+  void rebalance_up(Node *node);
+
+  Node *build(std::vector<Node *> &nodes, size_type first, size_type last,
+              Node *parent);
+  void flatten(Node *node, std::vector<Node *> &out);
+  Node *copy_tree(Node *node, Node *parent);
+  void clear(Node *node);
+};
+}  // namespace s21
+
+#include "s21_interval_map.tpp"
+
+#endif  // _S21_INTERVAL_MAP_H_
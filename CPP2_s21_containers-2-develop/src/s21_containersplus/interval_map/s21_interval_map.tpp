@@ -0,0 +1,397 @@
+namespace s21 {
+template <typename T, typename V>
+interval_map<T, V>::interval_map() : root_(nullptr), size_(0) {}
+
+template <typename T, typename V>
+interval_map<T, V>::interval_map(std::initializer_list<value_type> const &items)
+    : interval_map() {
+  bulk_load(items);
+}
+
+template <typename T, typename V>
+interval_map<T, V>::interval_map(const interval_map &other)
+    : root_(nullptr), size_(other.size_) {
+  root_ = copy_tree(other.root_, nullptr);
+}
+
+template <typename T, typename V>
+interval_map<T, V>::interval_map(interval_map &&other) noexcept
+    : root_(other.root_), size_(other.size_) {
+  other.root_ = nullptr;
+  other.size_ = 0;
+}
+
+template <typename T, typename V>
+interval_map<T, V>::~interval_map() {
+  clear();
+}
+
+template <typename T, typename V>
+interval_map<T, V> &interval_map<T, V>::operator=(
+    interval_map &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::iterator interval_map<T, V>::begin() {
+  return iterator(root_ ? min(root_) : nullptr, this);
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::iterator interval_map<T, V>::end() {
+  return iterator(nullptr, this);
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::const_iterator interval_map<T, V>::begin()
+    const {
+  return const_iterator(root_ ? min(root_) : nullptr, this);
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::const_iterator interval_map<T, V>::end() const {
+  return const_iterator(nullptr, this);
+}
+
+template <typename T, typename V>
+bool interval_map<T, V>::empty() const {
+  return root_ == nullptr;
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::size_type interval_map<T, V>::size() const {
+  return size_;
+}
+
+template <typename T, typename V>
+void interval_map<T, V>::clear() {
+  clear(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename T, typename V>
+void interval_map<T, V>::swap(interval_map &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::iterator interval_map<T, V>::insert(
+    const T &low, const T &high, const V &value) {
+  return insert(value_type(key_type(low, high), value));
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::iterator interval_map<T, V>::insert(
+    const value_type &item) {
+  Node *cell = new Node(item);
+  Node *parent = nullptr;
+  Node *current = root_;
+  while (current != nullptr) {
+    parent = current;
+    current = key_less(item.first, current->data_.first) ? current->left_
+                                                         : current->right_;
+  }
+  cell->parent_ = parent;
+  if (parent == nullptr) {
+    root_ = cell;
+  } else if (key_less(item.first, parent->data_.first)) {
+    parent->left_ = cell;
+  } else {
+    parent->right_ = cell;
+  }
+  ++size_;
+  rebalance_up(parent);
+  return iterator(cell, this);
+}
+
+template <typename T, typename V>
+void interval_map<T, V>::erase(const_iterator pos) {
+  Node *node = pos.current_;
+  if (node == nullptr) return;
+
+  Node *rebalance_from = nullptr;
+  if (node->left_ == nullptr || node->right_ == nullptr) {
+    Node *child = node->left_ ? node->left_ : node->right_;
+    if (child) child->parent_ = node->parent_;
+    replace_child(node->parent_, node, child);
+    rebalance_from = node->parent_;
+  } else {
+    Node *successor = min(node->right_);
+    if (successor->parent_ != node) {
+      rebalance_from = successor->parent_;
+      successor->parent_->left_ = successor->right_;
+      if (successor->right_) successor->right_->parent_ = successor->parent_;
+      successor->right_ = node->right_;
+      successor->right_->parent_ = successor;
+    } else {
+      rebalance_from = successor;
+    }
+    successor->left_ = node->left_;
+    successor->left_->parent_ = successor;
+    successor->parent_ = node->parent_;
+    replace_child(node->parent_, node, successor);
+  }
+  delete node;
+  --size_;
+  rebalance_up(rebalance_from);
+}
+
+// Новые узлы принадлежат loaded, пока build() не свяжет их с деревом:
+// исключение при сортировке или выделении памяти их не теряет.
+template <typename T, typename V>
+template <typename InputIt>
+void interval_map<T, V>::bulk_load(InputIt first, InputIt last) {
+  std::vector<std::unique_ptr<Node>> loaded;
+  for (; first != last; ++first)
+    loaded.push_back(std::make_unique<Node>(*first));
+  std::stable_sort(
+      loaded.begin(), loaded.end(),
+      [](const std::unique_ptr<Node> &a, const std::unique_ptr<Node> &b) {
+        return key_less(a->data_.first, b->data_.first);
+      });
+
+  std::vector<Node *> present;
+  present.reserve(size_);
+  flatten(root_, present);
+
+  // слияние, устойчивое как std::merge: при равных ключах старые раньше
+  std::vector<Node *> all;
+  all.reserve(present.size() + loaded.size());
+  auto old_node = present.begin();
+  for (const std::unique_ptr<Node> &node : loaded) {
+    while (old_node != present.end() &&
+           !key_less(node->data_.first, (*old_node)->data_.first))
+      all.push_back(*old_node++);
+    all.push_back(node.get());
+  }
+  all.insert(all.end(), old_node, present.end());
+
+  root_ = build(all, 0, all.size(), nullptr);
+  size_ = all.size();
+  for (std::unique_ptr<Node> &node : loaded) node.release();
+}
+
+template <typename T, typename V>
+void interval_map<T, V>::bulk_load(
+    std::initializer_list<value_type> const &items) {
+  bulk_load(items.begin(), items.end());
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::OverlapRange interval_map<T, V>::overlaps(
+    const T &low, const T &high) const {
+  return OverlapRange(
+      OverlapIterator(first_overlap(root_, low, high), this, low, high));
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::OverlapRange interval_map<T, V>::stab(
+    const T &point) const {
+  return overlaps(point, point);
+}
+
+template <typename T, typename V>
+bool interval_map<T, V>::any_overlap(const T &low, const T &high) const {
+  return first_overlap(root_, low, high) != nullptr;
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::size_type interval_map<T, V>::count_overlaps(
+    const T &low, const T &high) const {
+  size_type result = 0;
+  for (Node *node = first_overlap(root_, low, high); node != nullptr;
+       node = next_overlap(node, low, high)) {
+    ++result;
+  }
+  return result;
+}
+
+template <typename T, typename V>
+int interval_map<T, V>::height(const Node *node) {
+  return node ? node->height_ : 0;
+}
+
+template <typename T, typename V>
+void interval_map<T, V>::update(Node *node) {
+  node->height_ = std::max(height(node->left_), height(node->right_)) + 1;
+  node->max_end_ = node->data_.first.second;
+  if (node->left_ && node->max_end_ < node->left_->max_end_)
+    node->max_end_ = node->left_->max_end_;
+  if (node->right_ && node->max_end_ < node->right_->max_end_)
+    node->max_end_ = node->right_->max_end_;
+}
+
+template <typename T, typename V>
+bool interval_map<T, V>::key_less(const key_type &a, const key_type &b) {
+  if (a.first < b.first) return true;
+  if (b.first < a.first) return false;
+  return a.second < b.second;
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::Node *interval_map<T, V>::min(Node *node) const {
+  while (node->left_ != nullptr) node = node->left_;
+  return node;
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::Node *interval_map<T, V>::max(Node *node) const {
+  while (node->right_ != nullptr) node = node->right_;
+  return node;
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::Node *interval_map<T, V>::next(Node *node) const {
+  if (node->right_) return min(node->right_);
+  while (node->parent_ && node == node->parent_->right_) node = node->parent_;
+  return node->parent_;
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::Node *interval_map<T, V>::prev(Node *node) const {
+  if (node->left_) return max(node->left_);
+  while (node->parent_ && node == node->parent_->left_) node = node->parent_;
+  return node->parent_;
+}
+
+// Leftmost entry of the subtree overlapping [low, high]. Subtrees whose
+// max end lies before low are skipped, and the walk stops at the first start
+// past high since everything after it starts later still.
+template <typename T, typename V>
+typename interval_map<T, V>::Node *interval_map<T, V>::first_overlap(
+    Node *node, const T &low, const T &high) const {
+  if (node == nullptr || node->max_end_ < low) return nullptr;
+  Node *found = first_overlap(node->left_, low, high);
+  if (found) return found;
+  if (high < node->data_.first.first) return nullptr;
+  if (!(node->data_.first.second < low)) return node;
+  return first_overlap(node->right_, low, high);
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::Node *interval_map<T, V>::next_overlap(
+    Node *node, const T &low, const T &high) const {
+  Node *found = first_overlap(node->right_, low, high);
+  if (found) return found;
+  for (; node->parent_ != nullptr; node = node->parent_) {
+    Node *parent = node->parent_;
+    if (node != parent->left_) continue;
+    if (high < parent->data_.first.first) return nullptr;
+    if (!(parent->data_.first.second < low)) return parent;
+    found = first_overlap(parent->right_, low, high);
+    if (found) return found;
+  }
+  return nullptr;
+}
+
+template <typename T, typename V>
+void interval_map<T, V>::replace_child(Node *parent, Node *old_child,
+                                       Node *new_child) {
+  if (parent == nullptr) {
+    root_ = new_child;
+  } else if (parent->left_ == old_child) {
+    parent->left_ = new_child;
+  } else {
+    parent->right_ = new_child;
+  }
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::Node *interval_map<T, V>::rotate_left(
+    Node *node) {
+  Node *pivot = node->right_;
+  node->right_ = pivot->left_;
+  if (pivot->left_) pivot->left_->parent_ = node;
+  pivot->parent_ = node->parent_;
+  replace_child(node->parent_, node, pivot);
+  pivot->left_ = node;
+  node->parent_ = pivot;
+  update(node);
+  update(pivot);
+  return pivot;
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::Node *interval_map<T, V>::rotate_right(
+    Node *node) {
+  Node *pivot = node->left_;
+  node->left_ = pivot->right_;
+  if (pivot->right_) pivot->right_->parent_ = node;
+  pivot->parent_ = node->parent_;
+  replace_child(node->parent_, node, pivot);
+  pivot->right_ = node;
+  node->parent_ = pivot;
+  update(node);
+  update(pivot);
+  return pivot;
+}
+
+// max_end_ can change all the way up, so the walk always reaches the root.
+template <typename T, typename V>
+void interval_map<T, V>::rebalance_up(Node *node) {
+  while (node != nullptr) {
+    update(node);
+    int balance = height(node->left_) - height(node->right_);
+    if (balance > 1) {
+      if (height(node->left_->left_) < height(node->left_->right_))
+        rotate_left(node->left_);
+      node = rotate_right(node);
+    } else if (balance < -1) {
+      if (height(node->right_->right_) < height(node->right_->left_))
+        rotate_right(node->right_);
+      node = rotate_left(node);
+    }
+    node = node->parent_;
+  }
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::Node *interval_map<T, V>::build(
+    std::vector<Node *> &nodes, size_type first, size_type last,
+    Node *parent) {
+  if (first >= last) return nullptr;
+  size_type middle = first + (last - first) / 2;
+  Node *node = nodes[middle];
+  node->parent_ = parent;
+  node->left_ = build(nodes, first, middle, node);
+  node->right_ = build(nodes, middle + 1, last, node);
+  update(node);
+  return node;
+}
+
+template <typename T, typename V>
+void interval_map<T, V>::flatten(Node *node, std::vector<Node *> &out) {
+  if (node == nullptr) return;
+  flatten(node->left_, out);
+  out.push_back(node);
+  flatten(node->right_, out);
+}
+
+template <typename T, typename V>
+typename interval_map<T, V>::Node *interval_map<T, V>::copy_tree(
+    Node *node, Node *parent) {
+  if (node == nullptr) return nullptr;
+  Node *new_node = new Node(node->data_);
+  new_node->parent_ = parent;
+  new_node->max_end_ = node->max_end_;
+  new_node->height_ = node->height_;
+  new_node->left_ = copy_tree(node->left_, new_node);
+  new_node->right_ = copy_tree(node->right_, new_node);
+  return new_node;
+}
+
+template <typename T, typename V>
+void interval_map<T, V>::clear(Node *node) {
+  if (node != nullptr) {
+    clear(node->left_);
+    clear(node->right_);
+    delete node;
+  }
+}
+}  // namespace s21
@@ -0,0 +1,144 @@
+#ifndef _S21_MMAP_VECTOR_H_
+#define _S21_MMAP_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/vector/s21_vector.h"
+
+namespace s21 {
+// Vector of trivially copyable T stored in a memory-mapped file. The file
+// starts with a 64-byte header (magic, format version, sizeof/alignof T,
+// element count) followed by the elements themselves, so reopening a
+// dataset maps it in O(1) instead of reading and copying it. Growth
+// extends the file with ftruncate and the mapping with mremap; the file
+// keeps its spare capacity between runs.
+//
+// Changes reach the page cache at once and the disk when the kernel
+// decides, unless flush() is called or the policy asks for msync:
+//   manual    only explicit flush();
+//   on_close  flush() in close() and the destructor;
+//   on_grow   also an asynchronous msync before every growth.
+//
+//   s21::mmap_vector<Record> records("records.bin");
+//   records.push_back(record);   // survives a restart
+template <typename T>
+class mmap_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mmap_vector stores raw bytes of T in a file");
+  static_assert(alignof(T) <= 64, "mmap_vector data is 64-byte aligned");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = vectorIterator<T, false>;
+  using const_iterator = vectorIterator<T, true>;
+  using iterator_pointer = T *;
+
+  enum class open_mode { open_or_create, open_existing, create };
+  enum class flush_policy { manual, on_close, on_grow };
+
+  static constexpr std::uint32_t format_version = 1;
+  static constexpr size_type header_size = 64;
+
+  mmap_vector() noexcept = default;
+  explicit mmap_vector(const std::string &path,
+                       open_mode mode = open_mode::open_or_create,
+                       flush_policy policy = flush_policy::on_close);
+  mmap_vector(const mmap_vector &) = delete;
+  mmap_vector(mmap_vector &&other) noexcept;
+  ~mmap_vector();
+  mmap_vector &operator=(const mmap_vector &) = delete;
+  mmap_vector &operator=(mmap_vector &&other) noexcept;
+
+  void open(const std::string &path,
+            open_mode mode = open_mode::open_or_create,
+            flush_policy policy = flush_policy::on_close);
+  void close();
+  bool is_open() const noexcept { return base_ != nullptr; }
+  flush_policy policy() const noexcept { return policy_; }
+  void set_policy(flush_policy policy) noexcept { policy_ = policy; }
+  // msync всего отображения; async = MS_ASYNC (не ждать записи на диск)
+  void flush(bool async = false);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  reference back();
+  iterator_pointer data() noexcept { return data_; }
+  const T *data() const noexcept { return data_; }
+
+  iterator begin();
+  iterator end();
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept;
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void push_back(const_reference value);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+  void swap(mmap_vector &other) noexcept;
+
+ private:
+  // Заголовок файла, лежит прямо в отображении.
+  struct header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_bytes;
+    std::uint64_t value_size;
+    std::uint64_t value_align;
+    std::uint64_t size;
+    char reserved[24];
+  };
+  static_assert(sizeof(header) == header_size);
+
+  static constexpr char kMagic[8] = {'S', '2', '1', 'M', 'V', 'E', 'C', '1'};
+
+  header *meta() const noexcept { return reinterpret_cast<header *>(base_); }
+  void map_file(size_type bytes);
+  void validate(size_type file_bytes) const;
+  void grow_file(size_type new_capacity);
+  void ensure_open() const;
+  size_type grown_capacity(size_type count) const;
+  void release() noexcept;
+
+  int fd_ = -1;
+  unsigned char *base_ = nullptr;
+  size_type mapped_ = 0;
+  T *data_ = nullptr;
+  size_type capacity_ = 0;
+  flush_policy policy_ = flush_policy::on_close;
+};
+}  // namespace s21
+
+#include "s21_mmap_vector.tpp"
+
+#endif  // _S21_MMAP_VECTOR_H_
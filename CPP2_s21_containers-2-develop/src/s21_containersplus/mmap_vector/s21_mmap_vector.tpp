@@ -0,0 +1,328 @@
+namespace s21 {
+template <typename T>
+mmap_vector<T>::mmap_vector(const std::string &path, open_mode mode,
+                            flush_policy policy) {
+  open(path, mode, policy);
+}
+
+template <typename T>
+mmap_vector<T>::mmap_vector(mmap_vector &&other) noexcept {
+  swap(other);
+}
+
+template <typename T>
+mmap_vector<T>::~mmap_vector() {
+  try {
+    close();
+  } catch (...) {
+    // ошибку msync из деструктора сообщить некому; файл всё равно закрыт
+    release();
+  }
+}
+
+template <typename T>
+mmap_vector<T> &mmap_vector<T>::operator=(mmap_vector &&other) noexcept {
+  if (this != &other) {
+    mmap_vector moved(std::move(other));
+    swap(moved);
+  }
+  return *this;
+}
+
+template <typename T>
+void mmap_vector<T>::open(const std::string &path, open_mode mode,
+                          flush_policy policy) {
+  close();
+  int flags = O_RDWR | O_CLOEXEC;
+  if (mode == open_mode::open_or_create) flags |= O_CREAT;
+  if (mode == open_mode::create) flags |= O_CREAT | O_TRUNC;
+  fd_ = ::open(path.c_str(), flags, 0644);
+  if (fd_ == -1) {
+    throw std::system_error(errno, std::generic_category(),
+                            "mmap_vector: cannot open " + path);
+  }
+  policy_ = policy;
+  try {
+    struct stat info;
+    if (::fstat(fd_, &info) == -1) {
+      throw std::system_error(errno, std::generic_category(),
+                              "mmap_vector: cannot stat " + path);
+    }
+    size_type file_bytes = static_cast<size_type>(info.st_size);
+    if (file_bytes == 0U) {
+      // новый файл: только заголовок, ёмкость нулевая
+      if (::ftruncate(fd_, header_size) == -1) {
+        throw std::system_error(errno, std::generic_category(),
+                                "mmap_vector: cannot extend " + path);
+      }
+      map_file(header_size);
+      header *h = meta();
+      std::memcpy(h->magic, kMagic, sizeof(kMagic));
+      h->version = format_version;
+      h->header_bytes = header_size;
+      h->value_size = sizeof(T);
+      h->value_align = alignof(T);
+      h->size = 0U;
+    } else {
+      if (file_bytes < header_size) {
+        throw std::invalid_argument(
+            "OpenError: file is too short for an mmap_vector header");
+      }
+      map_file(file_bytes);
+      validate(file_bytes);
+    }
+    capacity_ = (mapped_ - header_size) / sizeof(T);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T>
+void mmap_vector<T>::close() {
+  if (!is_open()) return;
+  if (policy_ != flush_policy::manual) flush();
+  release();
+}
+
+template <typename T>
+void mmap_vector<T>::flush(bool async) {
+  ensure_open();
+  if (::msync(base_, mapped_, async ? MS_ASYNC : MS_SYNC) == -1)
+    throw std::system_error(errno, std::generic_category(), "mmap_vector");
+}
+
+template <typename T>
+typename mmap_vector<T>::reference mmap_vector<T>::at(size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return data_[pos];
+}
+
+template <typename T>
+typename mmap_vector<T>::const_reference mmap_vector<T>::at(
+    size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return data_[pos];
+}
+
+template <typename T>
+typename mmap_vector<T>::reference mmap_vector<T>::operator[](
+    size_type pos) {
+  S21_CHECK(pos < size(), "Index out of range");
+  return data_[pos];
+}
+
+template <typename T>
+typename mmap_vector<T>::const_reference mmap_vector<T>::operator[](
+    size_type pos) const {
+  S21_CHECK(pos < size(), "Index out of range");
+  return data_[pos];
+}
+
+template <typename T>
+typename mmap_vector<T>::reference mmap_vector<T>::front() {
+  if (empty()) {
+    throw std::out_of_range("FrontError: mmap_vector is empty");
+  }
+  return data_[0U];
+}
+
+template <typename T>
+typename mmap_vector<T>::reference mmap_vector<T>::back() {
+  if (empty()) {
+    throw std::out_of_range("BackError: mmap_vector is empty");
+  }
+  return data_[size() - 1];
+}
+
+template <typename T>
+typename mmap_vector<T>::iterator mmap_vector<T>::begin() {
+  return iterator(data_, data_, data_ + size());
+}
+
+template <typename T>
+typename mmap_vector<T>::iterator mmap_vector<T>::end() {
+  return iterator(data_ + size(), data_, data_ + size());
+}
+
+template <typename T>
+typename mmap_vector<T>::const_iterator mmap_vector<T>::cbegin() const {
+  return const_iterator(data_, data_, data_ + size());
+}
+
+template <typename T>
+typename mmap_vector<T>::const_iterator mmap_vector<T>::cend() const {
+  return const_iterator(data_ + size(), data_, data_ + size());
+}
+
+template <typename T>
+typename mmap_vector<T>::size_type mmap_vector<T>::size() const noexcept {
+  return is_open() ? static_cast<size_type>(meta()->size) : 0U;
+}
+
+template <typename T>
+typename mmap_vector<T>::size_type mmap_vector<T>::max_size() const noexcept {
+  using offset = std::make_signed_t<size_type>;
+  return (static_cast<size_type>(std::numeric_limits<offset>::max()) -
+          header_size) /
+         sizeof(T);
+}
+
+template <typename T>
+void mmap_vector<T>::reserve(size_type size) {
+  ensure_open();
+  if (size > max_size()) {
+    throw std::length_error("ReserveError: new capacity exceeds max_size");
+  }
+  if (size > capacity_) grow_file(size);
+}
+
+template <typename T>
+void mmap_vector<T>::shrink_to_fit() {
+  ensure_open();
+  if (capacity_ > size()) grow_file(size());
+}
+
+template <typename T>
+void mmap_vector<T>::clear() noexcept {
+  if (is_open()) meta()->size = 0U;
+}
+
+template <typename T>
+void mmap_vector<T>::push_back(const_reference value) {
+  ensure_open();
+  // value может лежать в самом отображении, а рост его переносит
+  T copy = value;
+  size_type count = size();
+  if (count == capacity_) grow_file(grown_capacity(count + 1));
+  data_[count] = copy;
+  meta()->size = count + 1;
+}
+
+template <typename T>
+template <class... Args>
+typename mmap_vector<T>::reference mmap_vector<T>::emplace_back(
+    Args &&...args) {
+  push_back(T(std::forward<Args>(args)...));
+  return data_[size() - 1];
+}
+
+template <typename T>
+void mmap_vector<T>::pop_back() {
+  if (size() > 0U) --meta()->size;
+}
+
+template <typename T>
+void mmap_vector<T>::resize(size_type count) {
+  resize(count, T());
+}
+
+template <typename T>
+void mmap_vector<T>::resize(size_type count, const_reference value) {
+  ensure_open();
+  T copy = value;
+  size_type old = size();
+  if (count > capacity_) grow_file(grown_capacity(count));
+  for (size_type i = old; i < count; ++i) data_[i] = copy;
+  meta()->size = count;
+}
+
+template <typename T>
+void mmap_vector<T>::swap(mmap_vector &other) noexcept {
+  std::swap(fd_, other.fd_);
+  std::swap(base_, other.base_);
+  std::swap(mapped_, other.mapped_);
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(policy_, other.policy_);
+}
+
+template <typename T>
+void mmap_vector<T>::map_file(size_type bytes) {
+  void *p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (p == MAP_FAILED)
+    throw std::system_error(errno, std::generic_category(), "mmap_vector");
+  base_ = static_cast<unsigned char *>(p);
+  mapped_ = bytes;
+  data_ = reinterpret_cast<T *>(base_ + header_size);
+}
+
+template <typename T>
+void mmap_vector<T>::validate(size_type file_bytes) const {
+  const header *h = meta();
+  if (std::memcmp(h->magic, kMagic, sizeof(kMagic)) != 0) {
+    throw std::invalid_argument("OpenError: not an mmap_vector file");
+  }
+  if (h->version != format_version || h->header_bytes != header_size) {
+    throw std::invalid_argument("OpenError: unsupported format version");
+  }
+  if (h->value_size != sizeof(T) || h->value_align != alignof(T)) {
+    throw std::invalid_argument("OpenError: file holds another value type");
+  }
+  if (h->size > (file_bytes - header_size) / sizeof(T)) {
+    throw std::invalid_argument("OpenError: file is truncated");
+  }
+}
+
+// Меняет размер файла и отображения под new_capacity элементов. При
+// росте файл удлиняется до переотображения, при сжатии — после: обращение
+// к странице за концом файла даёт SIGBUS.
+template <typename T>
+void mmap_vector<T>::grow_file(size_type new_capacity) {
+  const size_type bytes = header_size + new_capacity * sizeof(T);
+  if (policy_ == flush_policy::on_grow) flush(true);
+  if (bytes > mapped_ && ::ftruncate(fd_, static_cast<off_t>(bytes)) == -1)
+    throw std::system_error(errno, std::generic_category(), "mmap_vector");
+#ifdef __linux__
+  void *p = ::mremap(base_, mapped_, bytes, MREMAP_MAYMOVE);
+  if (p == MAP_FAILED)
+    throw std::system_error(errno, std::generic_category(), "mmap_vector");
+  base_ = static_cast<unsigned char *>(p);
+  mapped_ = bytes;
+  data_ = reinterpret_cast<T *>(base_ + header_size);
+#else
+  unsigned char *old_base = base_;
+  size_type old_mapped = mapped_;
+  map_file(bytes);
+  ::munmap(old_base, old_mapped);
+#endif
+  if (bytes < header_size + capacity_ * sizeof(T))
+    static_cast<void>(::ftruncate(fd_, static_cast<off_t>(bytes)));
+  capacity_ = new_capacity;
+}
+
+template <typename T>
+void mmap_vector<T>::ensure_open() const {
+  if (!is_open()) throw std::logic_error("mmap_vector: file is not open");
+}
+
+// Геометрический рост, но не меньше страницы: каждый рост — это
+// ftruncate и mremap, мелкие шаги обходятся дорого.
+template <typename T>
+typename mmap_vector<T>::size_type mmap_vector<T>::grown_capacity(
+    size_type count) const {
+  if (count > max_size()) {
+    throw std::length_error("s21::mmap_vector exceeds max_size()");
+  }
+  constexpr size_type kPageElements =
+      sizeof(T) < 4096U ? 4096U / sizeof(T) : 1U;
+  size_type doubled =
+      capacity_ < max_size() / 2 ? capacity_ * 2 : max_size();
+  return std::max({count, doubled, kPageElements});
+}
+
+template <typename T>
+void mmap_vector<T>::release() noexcept {
+  if (base_ != nullptr) ::munmap(base_, mapped_);
+  if (fd_ != -1) ::close(fd_);
+  fd_ = -1;
+  base_ = nullptr;
+  mapped_ = 0;
+  data_ = nullptr;
+  capacity_ = 0;
+}
+}  // namespace s21
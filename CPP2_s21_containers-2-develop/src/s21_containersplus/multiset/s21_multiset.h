@@ -1,22 +1,28 @@
 #ifndef _S21_MULTISET_H_
 #define _S21_MULTISET_H_
 
+#include <memory>
+#include <memory_resource>
+
 #include "../../s21_containers/AVLtree/AVLtree.h"
 
 namespace s21 {
-template <typename K>
-class multiset : public AVLTree<K, K> {
+template <typename K, typename Allocator = std::allocator<K>>
+class multiset : public AVLTree<K, K, Allocator> {
  public:
   using key_type = K;
   using value_type = K;
+  using allocator_type = Allocator;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename AVLTree<K, K>::iterator;
-  using const_iterator = typename AVLTree<K, K>::const_iterator;
+  using iterator = typename AVLTree<K, K, Allocator>::iterator;
+  using const_iterator = typename AVLTree<K, K, Allocator>::const_iterator;
   using size_type = size_t;
 
   multiset();
-  multiset(std::initializer_list<value_type> const &items);
+  explicit multiset(const allocator_type &alloc);
+  multiset(std::initializer_list<value_type> const &items,
+           const allocator_type &alloc = allocator_type());
   multiset(const multiset &mst_);
   multiset(multiset &&mst_);
   ~multiset() = default;
@@ -28,7 +34,27 @@ class multiset : public AVLTree<K, K> {
   std::pair<iterator, bool> insert(const K &value);
   template <class... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  std::pair<multiset, multiset> split(const K &key);
+  static multiset join(multiset &&left, multiset &&right);
+
+  template <typename Pred>
+  size_type erase_if(
+      Pred pred,
+      double rebuild_ratio = AVLTree<K, K, Allocator>::kEraseRebuildRatio);
 };
+
+template <typename K, typename Allocator, typename Pred>
+typename multiset<K, Allocator>::size_type erase_if(
+    multiset<K, Allocator> &s, Pred pred,
+    double rebuild_ratio = AVLTree<K, K, Allocator>::kEraseRebuildRatio) {
+  return s.erase_if(pred, rebuild_ratio);
+}
+
+namespace pmr {
+template <typename K>
+using multiset = s21::multiset<K, std::pmr::polymorphic_allocator<K>>;
+}  // namespace pmr
 }  // namespace s21
 
 #include "s21_multiset.tpp"
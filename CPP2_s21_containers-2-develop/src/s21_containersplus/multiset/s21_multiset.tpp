@@ -1,31 +1,39 @@
 namespace s21 {
-template <typename K>
-multiset<K>::multiset() : AVLTree<K, K>() {}
+template <typename K, typename Allocator>
+multiset<K, Allocator>::multiset() : AVLTree<K, K, Allocator>() {}
 
-template <typename K>
-multiset<K>::multiset(std::initializer_list<value_type> const &items) {
+template <typename K, typename Allocator>
+multiset<K, Allocator>::multiset(const allocator_type &alloc)
+    : AVLTree<K, K, Allocator>(alloc) {}
+
+template <typename K, typename Allocator>
+multiset<K, Allocator>::multiset(std::initializer_list<value_type> const &items,
+                                 const allocator_type &alloc)
+    : AVLTree<K, K, Allocator>(alloc) {
   for (auto i = items.begin(); i != items.end(); ++i) {
-    AVLTree<K, K>::add_mst(*i, *i);
+    AVLTree<K, K, Allocator>::add_mst(*i, *i);
   }
 }
 
-template <typename K>
-multiset<K>::multiset(const multiset &mst_) : AVLTree<K, K>(mst_) {}
+template <typename K, typename Allocator>
+multiset<K, Allocator>::multiset(const multiset &mst_)
+    : AVLTree<K, K, Allocator>(mst_) {}
 
-template <typename K>
-multiset<K>::multiset(multiset &&mst_) : AVLTree<K, K>(std::move(mst_)) {}
+template <typename K, typename Allocator>
+multiset<K, Allocator>::multiset(multiset &&mst_)
+    : AVLTree<K, K, Allocator>(std::move(mst_)) {}
 
-template <typename K>
-multiset<K> &multiset<K>::operator=(multiset &&mst_) {
+template <typename K, typename Allocator>
+multiset<K, Allocator> &multiset<K, Allocator>::operator=(multiset &&mst_) {
   if (this != &mst_) {
-    AVLTree<K, K>::operator=(std::move(mst_));
+    AVLTree<K, K, Allocator>::operator=(std::move(mst_));
   }
   return *this;
 }
 
-template <typename K>
-std::pair<typename multiset<K>::iterator, bool> multiset<K>::insert(
-    const K &value) {
+template <typename K, typename Allocator>
+std::pair<typename multiset<K, Allocator>::iterator, bool>
+multiset<K, Allocator>::insert(const K &value) {
   auto it = this->find(value);
   bool is_inserted = (it == this->end());
   this->add_mst(
@@ -34,17 +42,45 @@ std::pair<typename multiset<K>::iterator, bool> multiset<K>::insert(
   return std::make_pair(this->find(value), is_inserted);
 }
 
-template <typename K>
+template <typename K, typename Allocator>
 template <class... Args>
-std::vector<std::pair<typename multiset<K>::iterator, bool>>
-multiset<K>::insert_many(Args &&...args) {
-  std::vector<std::pair<typename multiset<K>::iterator, bool>> v;
+std::vector<std::pair<typename multiset<K, Allocator>::iterator, bool>>
+multiset<K, Allocator>::insert_many(Args &&...args) {
+  std::vector<std::pair<typename multiset<K, Allocator>::iterator, bool>> v;
   (v.push_back(this->insert(std::forward<Args>(args))), ...);
   return v;
 }
 
-template <typename K>
-void multiset<K>::merge(multiset &other) {
-  AVLTree<K, K>::merge_mst(other);
+template <typename K, typename Allocator>
+void multiset<K, Allocator>::merge(multiset &other) {
+  AVLTree<K, K, Allocator>::merge_mst(other);
+}
+
+template <typename K, typename Allocator>
+std::pair<multiset<K, Allocator>, multiset<K, Allocator>>
+multiset<K, Allocator>::split(const K &key) {
+  std::pair<multiset, multiset> parts(multiset(this->get_allocator()),
+                                      multiset(this->get_allocator()));
+  AVLTree<K, K, Allocator>::split_tree(key, parts.first, parts.second);
+  return parts;
+}
+
+template <typename K, typename Allocator>
+template <typename Pred>
+typename multiset<K, Allocator>::size_type
+multiset<K, Allocator>::erase_if(Pred pred, double rebuild_ratio) {
+  return AVLTree<K, K, Allocator>::erase_nodes_if(
+      [&pred](const K &key, const K &) {
+        return static_cast<bool>(pred(key));
+      },
+      rebuild_ratio);
+}
+
+template <typename K, typename Allocator>
+multiset<K, Allocator>
+multiset<K, Allocator>::join(multiset &&left, multiset &&right) {
+  multiset result(left.get_allocator());
+  result.join_tree(left, right, true);
+  return result;
 }
 }  // namespace s21
\ No newline at end of file
@@ -0,0 +1,265 @@
+#ifndef _S21_CODECS_H_
+#define _S21_CODECS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "../../s21_containers/vector/s21_vector.h"
+#include "../simd/s21_simd.h"
+
+namespace s21 {
+// Кодеки блоков для s21::packed_vector. Блок — block_size значений
+// uint64_t; его байты дописываются в общий поток, а параметры (смещение,
+// ширина, база) хранятся в packed_block. Свой кодек — структура с тремя
+// статическими функциями той же сигнатуры, что у кодеков ниже:
+//
+//   encode(values, block, out)  дописывает байты блока в out и заполняет
+//                               block (offset уже выставлен);
+//   decode(data, block, out)    распаковывает все block_size значений;
+//   get(data, block, index)     одно значение блока.
+namespace codec {
+constexpr std::size_t block_size = 128;
+
+struct packed_block {
+  std::uint64_t offset = 0;
+  std::uint64_t base = 0;
+  std::uint64_t reference = 0;
+  std::uint32_t width = 0;
+};
+
+namespace detail {
+// Упаковка по четырём дорожкам: значение i идёт в дорожку i % 4, а
+// 64-битные слова дорожек чередуются (слово j дорожки l лежит на месте
+// 4 * j + l). Тогда четыре соседних значения распаковываются одними и
+// теми же сдвигами из четырёх соседних слов — одной AVX2-инструкцией.
+constexpr std::size_t kLanes = 4;
+constexpr std::size_t kPerLane = block_size / kLanes;
+
+inline std::size_t packed_words(unsigned width) noexcept {
+  return kLanes * ((kPerLane * width + 63) / 64);
+}
+
+inline std::uint64_t width_mask(unsigned width) noexcept {
+  return width >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << width) - 1;
+}
+
+inline unsigned bit_width(std::uint64_t value) noexcept {
+  return value == 0U ? 0U : 64U - __builtin_clzll(value);
+}
+
+inline std::uint64_t load_word(const std::uint8_t *data,
+                               std::size_t word) noexcept {
+  std::uint64_t value;
+  std::memcpy(&value, data + word * sizeof(value), sizeof(value));
+  return value;
+}
+
+inline void pack(const std::uint64_t *values, unsigned width,
+                 vector<std::uint8_t> &out) {
+  std::uint64_t words[kLanes * kPerLane] = {};
+  for (std::size_t k = 0; k < kPerLane; ++k) {
+    std::size_t bit = k * width, word = bit / 64, shift = bit % 64;
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      std::uint64_t v = values[k * kLanes + lane];
+      words[word * kLanes + lane] |= v << shift;
+      if (shift + width > 64)
+        words[(word + 1) * kLanes + lane] |= v >> (64 - shift);
+    }
+  }
+  const auto *bytes = reinterpret_cast<const std::uint8_t *>(words);
+  out.insert(out.cend(), bytes,
+             bytes + packed_words(width) * sizeof(std::uint64_t));
+}
+
+inline std::uint64_t unpack_one(const std::uint8_t *data, unsigned width,
+                                std::size_t index) noexcept {
+  if (width == 0U) return 0U;
+  std::size_t lane = index % kLanes, bit = index / kLanes * width;
+  std::size_t word = bit / 64, shift = bit % 64;
+  std::uint64_t v = load_word(data, word * kLanes + lane) >> shift;
+  if (shift + width > 64)
+    v |= load_word(data, (word + 1) * kLanes + lane) << (64 - shift);
+  return v & width_mask(width);
+}
+
+inline void unpack_scalar(const std::uint8_t *data, unsigned width,
+                          std::uint64_t *out) noexcept {
+  for (std::size_t i = 0; i < block_size; ++i)
+    out[i] = unpack_one(data, width, i);
+}
+
+#if S21_SIMD_X86
+inline void unpack_sse2(const std::uint8_t *data, unsigned width,
+                        std::uint64_t *out) noexcept {
+  const __m128i mask = _mm_set1_epi64x(static_cast<long long>(
+      width_mask(width)));
+  const auto *words = reinterpret_cast<const __m128i *>(data);
+  for (std::size_t k = 0; k < kPerLane; ++k) {
+    std::size_t bit = k * width, word = bit / 64, shift = bit % 64;
+    const __m128i right = _mm_cvtsi32_si128(static_cast<int>(shift));
+    __m128i lo = _mm_srl_epi64(_mm_loadu_si128(words + 2 * word), right);
+    __m128i hi = _mm_srl_epi64(_mm_loadu_si128(words + 2 * word + 1), right);
+    if (shift + width > 64) {
+      const __m128i left = _mm_cvtsi32_si128(static_cast<int>(64 - shift));
+      lo = _mm_or_si128(
+          lo, _mm_sll_epi64(_mm_loadu_si128(words + 2 * word + 2), left));
+      hi = _mm_or_si128(
+          hi, _mm_sll_epi64(_mm_loadu_si128(words + 2 * word + 3), left));
+    }
+    auto *dest = reinterpret_cast<__m128i *>(out + k * kLanes);
+    _mm_storeu_si128(dest, _mm_and_si128(lo, mask));
+    _mm_storeu_si128(dest + 1, _mm_and_si128(hi, mask));
+  }
+}
+
+__attribute__((target("avx2"))) inline void unpack_avx2(
+    const std::uint8_t *data, unsigned width, std::uint64_t *out) noexcept {
+  const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(
+      width_mask(width)));
+  const auto *words = reinterpret_cast<const __m256i *>(data);
+  for (std::size_t k = 0; k < kPerLane; ++k) {
+    std::size_t bit = k * width, word = bit / 64, shift = bit % 64;
+    __m256i v = _mm256_srl_epi64(_mm256_loadu_si256(words + word),
+                                 _mm_cvtsi32_si128(static_cast<int>(shift)));
+    if (shift + width > 64)
+      v = _mm256_or_si256(
+          v, _mm256_sll_epi64(
+                 _mm256_loadu_si256(words + word + 1),
+                 _mm_cvtsi32_si128(static_cast<int>(64 - shift))));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + k * kLanes),
+                        _mm256_and_si256(v, mask));
+  }
+}
+#endif  // S21_SIMD_X86
+
+inline void unpack(const std::uint8_t *data, unsigned width,
+                   std::uint64_t *out) noexcept {
+  if (width == 0U) {
+    std::fill(out, out + block_size, std::uint64_t{0});
+    return;
+  }
+#if S21_SIMD_X86
+  if (simd::detail::has_avx2()) return unpack_avx2(data, width, out);
+  return unpack_sse2(data, width, out);
+#else
+  unpack_scalar(data, width, out);
+#endif
+}
+
+// Разности соседних значений (первая — 0); для отсортированных данных
+// это маленькие числа, для прочих — разности по модулю 2^64.
+inline void deltas(const std::uint64_t *values, std::uint64_t *out) noexcept {
+  out[0] = 0U;
+  for (std::size_t i = 1; i < block_size; ++i)
+    out[i] = values[i] - values[i - 1];
+}
+}  // namespace detail
+
+// Все значения блока одной ширины — по самому широкому из них.
+struct bitpack {
+  static void encode(const std::uint64_t *values, packed_block &block,
+                     vector<std::uint8_t> &out) {
+    std::uint64_t all = 0;
+    for (std::size_t i = 0; i < block_size; ++i) all |= values[i];
+    block.width = detail::bit_width(all);
+    detail::pack(values, block.width, out);
+  }
+  static void decode(const std::uint8_t *data, const packed_block &block,
+                     std::uint64_t *out) noexcept {
+    detail::unpack(data, block.width, out);
+  }
+  static std::uint64_t get(const std::uint8_t *data, const packed_block &block,
+                           std::size_t index) noexcept {
+    return detail::unpack_one(data, block.width, index);
+  }
+};
+
+// Delta + frame of reference: первое значение блока в base, дальше
+// разности соседей минус наименьшая из них (reference), упакованные
+// bitpack. Для отсортированных списков с небольшими шагами — несколько
+// бит на значение. get распаковывает префикс блока.
+struct delta {
+  static void encode(const std::uint64_t *values, packed_block &block,
+                     vector<std::uint8_t> &out) {
+    std::uint64_t packed[block_size];
+    detail::deltas(values, packed);
+    std::uint64_t reference = *std::min_element(packed + 1,
+                                                packed + block_size);
+    std::uint64_t all = 0;
+    for (std::size_t i = 1; i < block_size; ++i) {
+      packed[i] -= reference;
+      all |= packed[i];
+    }
+    block.base = values[0];
+    block.reference = reference;
+    block.width = detail::bit_width(all);
+    detail::pack(packed, block.width, out);
+  }
+  static void decode(const std::uint8_t *data, const packed_block &block,
+                     std::uint64_t *out) noexcept {
+    detail::unpack(data, block.width, out);
+    std::uint64_t value = block.base;
+    out[0] = value;
+    for (std::size_t i = 1; i < block_size; ++i)
+      out[i] = value += out[i] + block.reference;
+  }
+  static std::uint64_t get(const std::uint8_t *data, const packed_block &block,
+                           std::size_t index) noexcept {
+    std::uint64_t value = block.base + index * block.reference;
+    for (std::size_t i = 1; i <= index; ++i)
+      value += detail::unpack_one(data, block.width, i);
+    return value;
+  }
+};
+
+// Разности соседей в LEB128: 7 бит на байт, старший бит — «дальше ещё».
+// Плотнее delta при редких больших скачках, но декодируется побайтно.
+struct varint {
+  static void encode(const std::uint64_t *values, packed_block &block,
+                     vector<std::uint8_t> &out) {
+    std::uint64_t packed[block_size];
+    detail::deltas(values, packed);
+    block.base = values[0];
+    for (std::size_t i = 1; i < block_size; ++i) {
+      std::uint64_t v = packed[i];
+      for (; v >= 0x80U; v >>= 7)
+        out.push_back(static_cast<std::uint8_t>(v | 0x80U));
+      out.push_back(static_cast<std::uint8_t>(v));
+    }
+  }
+  static void decode(const std::uint8_t *data, const packed_block &block,
+                     std::uint64_t *out) noexcept {
+    decode_prefix(data, block, block_size, out);
+  }
+  static std::uint64_t get(const std::uint8_t *data, const packed_block &block,
+                           std::size_t index) noexcept {
+    std::uint64_t prefix[block_size];
+    decode_prefix(data, block, index + 1, prefix);
+    return prefix[index];
+  }
+
+ private:
+  static void decode_prefix(const std::uint8_t *data,
+                            const packed_block &block, std::size_t count,
+                            std::uint64_t *out) noexcept {
+    std::uint64_t value = block.base;
+    out[0] = value;
+    for (std::size_t i = 1; i < count; ++i) {
+      std::uint64_t d = 0;
+      unsigned shift = 0;
+      std::uint8_t byte;
+      do {
+        byte = *data++;
+        d |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+        shift += 7;
+      } while (byte & 0x80U);
+      out[i] = value += d;
+    }
+  }
+};
+}  // namespace codec
+}  // namespace s21
+
+#endif  // _S21_CODECS_H_
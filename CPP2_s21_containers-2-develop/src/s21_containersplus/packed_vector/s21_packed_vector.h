@@ -0,0 +1,154 @@
+#ifndef _S21_PACKED_VECTOR_H_
+#define _S21_PACKED_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "../../s21_containers/s21_checked.h"
+#include "../../s21_containers/vector/s21_vector.h"
+#include "s21_codecs.h"
+
+namespace s21 {
+template <typename Vector>
+class packedIterator;
+
+// Сжатый вектор uint64_t только для добавления в конец. Значения
+// кодируются блоками по block_size выбранным кодеком (codec::bitpack,
+// codec::delta, codec::varint или свой, см. s21_codecs.h); последний
+// неполный блок лежит несжатым, и push_back пишет прямо в него.
+//
+//   s21::packed_vector<s21::codec::delta> postings;
+//   for (std::uint64_t doc : ids) postings.push_back(doc);
+//   postings.for_each_segment([](const std::uint64_t *b,
+//                                const std::uint64_t *e) { ... });
+//
+// Доступ по индексу распаковывает одно значение своего блока (delta и
+// varint — префикс блока). Последовательный проход — итераторы или
+// for_each_segment — распаковывает блок целиком векторными инструкциями.
+template <typename Codec = codec::delta>
+class packed_vector {
+ public:
+  using value_type = std::uint64_t;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type;
+  using const_reference = value_type;
+  using iterator = packedIterator<packed_vector>;
+  using const_iterator = packedIterator<packed_vector>;
+  using codec_type = Codec;
+
+  static constexpr size_type block_size = codec::block_size;
+
+  packed_vector() = default;
+  packed_vector(std::initializer_list<value_type> const &items);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  packed_vector(InputIt first, InputIt last);
+  packed_vector(const packed_vector &other) = default;
+  packed_vector(packed_vector &&other) noexcept;
+  ~packed_vector() = default;
+  packed_vector &operator=(const packed_vector &other);
+  packed_vector &operator=(packed_vector &&other) noexcept;
+
+  value_type at(size_type pos) const;
+  value_type operator[](size_type pos) const;
+  value_type front() const;
+  value_type back() const;
+
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0U); }
+  const_iterator cend() const noexcept { return const_iterator(this, size_); }
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept { return blocks_.max_size(); }
+  // Байты, занятые сжатыми блоками, их заголовками и хвостом.
+  size_type memory_usage() const noexcept;
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void push_back(value_type value);
+  void pop_back();
+  void swap(packed_vector &other) noexcept;
+
+  // Распаковывает блок номер block (последний — хвост) в out, возвращает
+  // число значений в нём.
+  size_type decode_block(size_type block, value_type *out) const;
+  // fn(first, last) для каждого распакованного блока по порядку.
+  template <typename Fn>
+  void for_each_segment(Fn fn) const;
+
+ private:
+  using block_type = codec::packed_block;
+
+  void seal_tail();
+
+  vector<std::uint8_t> bytes_;
+  vector<block_type> blocks_;
+  value_type tail_[block_size] = {};
+  size_type size_ = 0;
+};
+
+// Однонаправленный итератор с буфером на один распакованный блок: шаг
+// внутри блока — чтение из буфера, переход в следующий блок — один
+// decode_block. Буфер у каждой копии итератора свой, поэтому значения
+// отдаются по копии, как operator[] контейнера.
+template <typename Vector>
+class packedIterator {
+ public:
+  using value_type = typename Vector::value_type;
+  using reference = value_type;
+  using pointer = void;
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+
+  packedIterator() = default;
+  packedIterator(const Vector *owner, std::size_t index)
+      : owner_(owner), index_(index) {}
+
+  value_type operator*() const {
+    std::size_t block = index_ / Vector::block_size;
+    if (block != block_) {
+      owner_->decode_block(block, buffer_);
+      block_ = block;
+    }
+    return buffer_[index_ % Vector::block_size];
+  }
+  std::size_t index() const noexcept { return index_; }
+
+  packedIterator &operator++() {
+    ++index_;
+    return *this;
+  }
+  packedIterator operator++(int) {
+    packedIterator temp(*this);
+    ++*this;
+    return temp;
+  }
+
+  bool operator==(const packedIterator &other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const packedIterator &other) const {
+    return index_ != other.index_;
+  }
+
+ private:
+  static constexpr std::size_t kNoBlock = static_cast<std::size_t>(-1);
+
+  const Vector *owner_ = nullptr;
+  std::size_t index_ = 0;
+  mutable std::size_t block_ = kNoBlock;
+  mutable value_type buffer_[Vector::block_size];
+};
+}  // namespace s21
+
+#include "s21_packed_vector.tpp"
+
+#endif  // _S21_PACKED_VECTOR_H_
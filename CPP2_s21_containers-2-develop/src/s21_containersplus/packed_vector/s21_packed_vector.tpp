@@ -0,0 +1,182 @@
+namespace s21 {
+template <typename Codec>
+packed_vector<Codec>::packed_vector(
+    std::initializer_list<value_type> const &items)
+    : packed_vector(items.begin(), items.end()) {}
+
+template <typename Codec>
+template <typename InputIt, typename>
+packed_vector<Codec>::packed_vector(InputIt first, InputIt last) {
+  for (; first != last; ++first) push_back(*first);
+}
+
+template <typename Codec>
+packed_vector<Codec>::packed_vector(packed_vector &&other) noexcept
+    : bytes_(std::move(other.bytes_)),
+      blocks_(std::move(other.blocks_)),
+      size_(other.size_) {
+  std::copy(other.tail_, other.tail_ + block_size, tail_);
+  other.size_ = 0U;
+}
+
+template <typename Codec>
+packed_vector<Codec> &packed_vector<Codec>::operator=(
+    const packed_vector &other) {
+  if (this != &other) {
+    packed_vector copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Codec>
+packed_vector<Codec> &packed_vector<Codec>::operator=(
+    packed_vector &&other) noexcept {
+  if (this != &other) {
+    packed_vector moved(std::move(other));
+    swap(moved);
+  }
+  return *this;
+}
+
+template <typename Codec>
+typename packed_vector<Codec>::value_type packed_vector<Codec>::at(
+    size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return (*this)[pos];
+}
+
+template <typename Codec>
+typename packed_vector<Codec>::value_type packed_vector<Codec>::operator[](
+    size_type pos) const {
+  S21_CHECK(pos < size_, "Index out of range");
+  size_type block = pos / block_size;
+  if (block == blocks_.size()) return tail_[pos % block_size];
+  const block_type &header = blocks_[block];
+  return Codec::get(bytes_.data() + header.offset, header, pos % block_size);
+}
+
+template <typename Codec>
+typename packed_vector<Codec>::value_type packed_vector<Codec>::front()
+    const {
+  if (empty()) {
+    throw std::out_of_range("FrontError: packed_vector is empty");
+  }
+  return (*this)[0U];
+}
+
+template <typename Codec>
+typename packed_vector<Codec>::value_type packed_vector<Codec>::back() const {
+  if (empty()) {
+    throw std::out_of_range("BackError: packed_vector is empty");
+  }
+  return (*this)[size_ - 1];
+}
+
+template <typename Codec>
+typename packed_vector<Codec>::size_type packed_vector<Codec>::memory_usage()
+    const noexcept {
+  return bytes_.capacity() + blocks_.capacity() * sizeof(block_type) +
+         sizeof(tail_);
+}
+
+// Сжатый размер заранее неизвестен: резервируются только заголовки.
+template <typename Codec>
+void packed_vector<Codec>::reserve(size_type size) {
+  blocks_.reserve(size / block_size);
+}
+
+template <typename Codec>
+void packed_vector<Codec>::shrink_to_fit() {
+  bytes_.shrink_to_fit();
+  blocks_.shrink_to_fit();
+}
+
+template <typename Codec>
+void packed_vector<Codec>::clear() noexcept {
+  bytes_.clear();
+  blocks_.clear();
+  size_ = 0U;
+}
+
+template <typename Codec>
+void packed_vector<Codec>::push_back(value_type value) {
+  tail_[size_ % block_size] = value;
+  ++size_;
+  if (size_ % block_size == 0U) {
+    try {
+      seal_tail();
+    } catch (...) {
+      --size_;
+      throw;
+    }
+  }
+}
+
+// Если хвост пуст, последний блок распаковывается обратно в хвост и его
+// байты отрезаются от конца потока.
+template <typename Codec>
+void packed_vector<Codec>::pop_back() {
+  if (empty()) return;
+  if (size_ % block_size == 0U) {
+    const block_type &header = blocks_.back();
+    Codec::decode(bytes_.data() + header.offset, header, tail_);
+    bytes_.erase(bytes_.cbegin() + header.offset, bytes_.cend());
+    blocks_.pop_back();
+  }
+  --size_;
+}
+
+template <typename Codec>
+void packed_vector<Codec>::swap(packed_vector &other) noexcept {
+  bytes_.swap(other.bytes_);
+  blocks_.swap(other.blocks_);
+  std::swap_ranges(tail_, tail_ + block_size, other.tail_);
+  std::swap(size_, other.size_);
+}
+
+template <typename Codec>
+typename packed_vector<Codec>::size_type packed_vector<Codec>::decode_block(
+    size_type block, value_type *out) const {
+  if (block > blocks_.size()) {
+    throw std::out_of_range("DecodeError: Block index out of range");
+  }
+  if (block == blocks_.size()) {
+    size_type count = size_ % block_size;
+    std::copy(tail_, tail_ + count, out);
+    return count;
+  }
+  const block_type &header = blocks_[block];
+  Codec::decode(bytes_.data() + header.offset, header, out);
+  return block_size;
+}
+
+template <typename Codec>
+template <typename Fn>
+void packed_vector<Codec>::for_each_segment(Fn fn) const {
+  value_type buffer[block_size];
+  for (size_type block = 0; block < blocks_.size(); ++block) {
+    const block_type &header = blocks_[block];
+    Codec::decode(bytes_.data() + header.offset, header, buffer);
+    fn(static_cast<const value_type *>(buffer), buffer + block_size);
+  }
+  if (size_ % block_size != 0U)
+    fn(static_cast<const value_type *>(tail_), tail_ + size_ % block_size);
+}
+
+// При исключении из encode поток обрезается до прежней длины.
+template <typename Codec>
+void packed_vector<Codec>::seal_tail() {
+  block_type header;
+  header.offset = bytes_.size();
+  try {
+    Codec::encode(tail_, header, bytes_);
+    blocks_.push_back(header);
+  } catch (...) {
+    bytes_.erase(bytes_.cbegin() + header.offset, bytes_.cend());
+    throw;
+  }
+}
+}  // namespace s21
@@ -0,0 +1,144 @@
+#ifndef _S21_PARALLEL_H_
+#define _S21_PARALLEL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_thread_pool.h"
+
+namespace s21 {
+// Параллельные алгоритмы над random access диапазонами и непрерывными
+// контейнерами (s21::vector, s21::array, s21::small_vector). Диапазон
+// делится на куски не мельче grain элементов, не больше четырёх на поток
+// пула; короткие диапазоны обрабатываются вызывающим потоком без пула.
+// Каждый алгоритм есть в двух видах: с явным thread_pool первым аргументом
+// и с общим default_pool().
+//
+//   s21::parallel::sort(samples);
+//   double total = s21::parallel::reduce(samples, 0.0);
+//
+// reduce и inclusive_scan группируют операции иначе, чем std::accumulate:
+// op должна быть ассоциативной (коммутативность не нужна).
+namespace parallel {
+constexpr std::size_t kDefaultGrain = 1 << 14;
+
+namespace detail {
+template <typename Container>
+using if_contiguous =
+    decltype(std::declval<Container &>().data(),
+             std::declval<Container &>().size(), void());
+}  // namespace detail
+
+template <class RandomIt, class Compare = std::less<>>
+void sort(thread_pool &pool, RandomIt first, RandomIt last,
+          Compare comp = Compare());
+template <class RandomIt, class Compare = std::less<>>
+void stable_sort(thread_pool &pool, RandomIt first, RandomIt last,
+                 Compare comp = Compare());
+template <class RandomIt, class OutputIt, class UnaryOp>
+OutputIt transform(thread_pool &pool, RandomIt first, RandomIt last,
+                   OutputIt d_first, UnaryOp op);
+template <class RandomIt, class T, class BinaryOp = std::plus<>>
+T reduce(thread_pool &pool, RandomIt first, RandomIt last, T init,
+         BinaryOp op = BinaryOp());
+template <class RandomIt, class OutputIt, class BinaryOp = std::plus<>>
+OutputIt inclusive_scan(thread_pool &pool, RandomIt first, RandomIt last,
+                        OutputIt d_first, BinaryOp op = BinaryOp());
+template <class RandomIt, class UnaryFn>
+void for_each(thread_pool &pool, RandomIt first, RandomIt last, UnaryFn fn);
+
+template <class RandomIt, class Compare = std::less<>>
+void sort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+  parallel::sort(default_pool(), first, last, comp);
+}
+
+template <class RandomIt, class Compare = std::less<>>
+void stable_sort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+  parallel::stable_sort(default_pool(), first, last, comp);
+}
+
+template <class RandomIt, class OutputIt, class UnaryOp>
+OutputIt transform(RandomIt first, RandomIt last, OutputIt d_first,
+                   UnaryOp op) {
+  return parallel::transform(default_pool(), first, last, d_first, op);
+}
+
+template <class RandomIt, class T, class BinaryOp = std::plus<>>
+T reduce(RandomIt first, RandomIt last, T init, BinaryOp op = BinaryOp()) {
+  return parallel::reduce(default_pool(), first, last, std::move(init), op);
+}
+
+template <class RandomIt, class OutputIt, class BinaryOp = std::plus<>>
+OutputIt inclusive_scan(RandomIt first, RandomIt last, OutputIt d_first,
+                        BinaryOp op = BinaryOp()) {
+  return parallel::inclusive_scan(default_pool(), first, last, d_first, op);
+}
+
+template <class RandomIt, class UnaryFn>
+void for_each(RandomIt first, RandomIt last, UnaryFn fn) {
+  parallel::for_each(default_pool(), first, last, fn);
+}
+
+// Перегрузки для контейнеров работают через data() и size(). Изменяемый
+// диапазон принимается и временным объектом — так сортируется или
+// обходится часть контейнера через s21::span без копии:
+//
+//   s21::parallel::sort(s21::span(samples).subspan(first, count));
+template <class Container, class Compare = std::less<>,
+          class = detail::if_contiguous<Container>>
+void sort(Container &&c, Compare comp = Compare()) {
+  parallel::sort(c.data(), c.data() + c.size(), comp);
+}
+
+template <class Container, class Compare = std::less<>,
+          class = detail::if_contiguous<Container>>
+void stable_sort(Container &&c, Compare comp = Compare()) {
+  parallel::stable_sort(c.data(), c.data() + c.size(), comp);
+}
+
+template <class In, class Out, class UnaryOp, class = detail::if_contiguous<In>,
+          class = detail::if_contiguous<Out>>
+void transform(const In &in, Out &&out, UnaryOp op) {
+  if (out.size() < in.size()) {
+    throw std::invalid_argument("TransformError: output is too short");
+  }
+  parallel::transform(in.data(), in.data() + in.size(), out.data(), op);
+}
+
+template <class Container, class T, class BinaryOp = std::plus<>,
+          class = detail::if_contiguous<Container>>
+T reduce(const Container &c, T init, BinaryOp op = BinaryOp()) {
+  return parallel::reduce(c.data(), c.data() + c.size(), std::move(init),
+                          op);
+}
+
+template <class In, class Out, class BinaryOp = std::plus<>,
+          class = detail::if_contiguous<In>,
+          class = detail::if_contiguous<Out>>
+void inclusive_scan(const In &in, Out &&out, BinaryOp op = BinaryOp()) {
+  if (out.size() < in.size()) {
+    throw std::invalid_argument("ScanError: output is too short");
+  }
+  parallel::inclusive_scan(in.data(), in.data() + in.size(), out.data(), op);
+}
+
+template <class Container, class UnaryFn,
+          class = detail::if_contiguous<Container>>
+void for_each(Container &&c, UnaryFn fn) {
+  parallel::for_each(c.data(), c.data() + c.size(), fn);
+}
+}  // namespace parallel
+}  // namespace s21
+
+#include "s21_parallel.tpp"
+
+#endif  // _S21_PARALLEL_H_
@@ -0,0 +1,254 @@
+namespace s21 {
+namespace parallel {
+namespace detail {
+// Число кусков для n элементов: не мельче grain, не больше четырёх на
+// участника пула (запас на неравномерную нагрузку).
+inline std::size_t chunk_count(const thread_pool &pool, std::size_t n,
+                               std::size_t grain = kDefaultGrain) {
+  std::size_t by_grain = (n + grain - 1) / grain;
+  return std::max<std::size_t>(1U, std::min(by_grain, pool.size() * 4));
+}
+
+// Граница куска c из chunks при делении [0, n) на почти равные части.
+inline std::size_t chunk_begin(std::size_t n, std::size_t chunks,
+                               std::size_t c) {
+  return c * (n / chunks) + std::min(c, n % chunks);
+}
+
+// fn(begin, end) для каждого куска [0, n), куски обрабатываются параллельно.
+template <typename Fn>
+void for_chunks(thread_pool &pool, std::size_t n, std::size_t chunks,
+                Fn &&fn) {
+  pool.run(chunks, [&](std::size_t c) {
+    fn(chunk_begin(n, chunks, c), chunk_begin(n, chunks, c + 1));
+  });
+}
+
+// Сколько элементов a попадает в первые d элементов устойчивого слияния a
+// и b (при равенстве раньше идёт a): поиск по диагонали merge path.
+template <class It, class Compare>
+std::size_t merge_split(It a, std::size_t na, It b, std::size_t nb,
+                        std::size_t d, Compare &comp) {
+  std::size_t lo = d > nb ? d - nb : 0U;
+  std::size_t hi = std::min(d, na);
+  while (lo < hi) {
+    std::size_t mid = lo + (hi - lo) / 2;
+    if (comp(b[d - mid - 1], a[mid]))
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return lo;
+}
+
+// Один раунд слияния соседних отсортированных серий из src в dst. Каждая
+// пара режется на части по merge path, так что даже последнее слияние
+// двух половин идёт на всех потоках. Нечётная последняя серия просто
+// переносится. Границы частей ищутся до начала слияния: потом src уже
+// частично перемещён. Возвращает границы новых серий.
+template <class Src, class Dst, class Compare>
+std::vector<std::size_t> merge_round(thread_pool &pool, Src src, Dst dst,
+                                     const std::vector<std::size_t> &runs,
+                                     Compare &comp) {
+  struct part {
+    std::size_t first, middle, last, d0, d1, i0, i1;
+  };
+  const std::size_t n = runs.back();
+  const std::size_t total_parts = chunk_count(pool, n);
+  std::vector<part> parts;
+  std::vector<std::size_t> merged = {0U};
+  for (std::size_t r = 0; r + 1 < runs.size(); r += 2) {
+    std::size_t first = runs[r];
+    std::size_t middle = runs[r + 1];
+    std::size_t last = r + 2 < runs.size() ? runs[r + 2] : middle;
+    std::size_t length = last - first;
+    std::size_t pieces =
+        std::max<std::size_t>(1U, length * total_parts / n);
+    for (std::size_t p = 0; p < pieces; ++p)
+      parts.push_back({first, middle, last, chunk_begin(length, pieces, p),
+                       chunk_begin(length, pieces, p + 1), 0U, 0U});
+    merged.push_back(last);
+  }
+
+  pool.run(parts.size(), [&](std::size_t i) {
+    part &p = parts[i];
+    std::size_t na = p.middle - p.first;
+    std::size_t nb = p.last - p.middle;
+    p.i0 = merge_split(src + p.first, na, src + p.middle, nb, p.d0, comp);
+    p.i1 = merge_split(src + p.first, na, src + p.middle, nb, p.d1, comp);
+  });
+  pool.run(parts.size(), [&](std::size_t i) {
+    const part &p = parts[i];
+    Src a = src + p.first;
+    Src b = src + p.middle;
+    std::merge(std::make_move_iterator(a + p.i0),
+               std::make_move_iterator(a + p.i1),
+               std::make_move_iterator(b + (p.d0 - p.i0)),
+               std::make_move_iterator(b + (p.d1 - p.i1)),
+               dst + p.first + p.d0, comp);
+  });
+  return merged;
+}
+
+// Куски сортируются независимо (chunk_sort), затем сливаются раундами.
+// Для типов с noexcept-перемещением слияние идёт через буфер и режется по
+// merge path; иначе пары серий сливаются std::inplace_merge.
+template <class RandomIt, class Compare, class ChunkSort>
+void merge_sort(thread_pool &pool, RandomIt first, RandomIt last,
+                Compare &comp, ChunkSort chunk_sort) {
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+  const std::size_t n = last - first;
+  const std::size_t chunks = std::min(chunk_count(pool, n), pool.size());
+  if (chunks <= 1U) {
+    chunk_sort(first, last);
+    return;
+  }
+
+  std::vector<std::size_t> runs(chunks + 1);
+  for (std::size_t c = 0; c <= chunks; ++c)
+    runs[c] = chunk_begin(n, chunks, c);
+  pool.run(chunks, [&](std::size_t c) {
+    chunk_sort(first + runs[c], first + runs[c + 1]);
+  });
+
+  if constexpr (std::is_nothrow_move_constructible_v<value_type> &&
+                std::is_nothrow_move_assignable_v<value_type>) {
+    std::allocator<value_type> alloc;
+    value_type *buffer = alloc.allocate(n);
+    const std::size_t parts = chunk_count(pool, n);
+    // буфер создаётся перемещением, так что первый раунд идёт из него
+    for_chunks(pool, n, parts, [&](std::size_t b, std::size_t e) {
+      std::uninitialized_move(first + b, first + e, buffer + b);
+    });
+    bool in_buffer = true;
+    try {
+      while (runs.size() > 2) {
+        if (in_buffer)
+          runs = merge_round(pool, buffer, first, runs, comp);
+        else
+          runs = merge_round(pool, first, buffer, runs, comp);
+        in_buffer = !in_buffer;
+      }
+    } catch (...) {
+      // comp бросил: элементы first валидны, но их значения не определены
+      std::destroy(buffer, buffer + n);
+      alloc.deallocate(buffer, n);
+      throw;
+    }
+    for_chunks(pool, n, parts, [&](std::size_t b, std::size_t e) {
+      if (in_buffer) std::move(buffer + b, buffer + e, first + b);
+      std::destroy(buffer + b, buffer + e);
+    });
+    alloc.deallocate(buffer, n);
+  } else {
+    while (runs.size() > 2) {
+      std::vector<std::size_t> merged = {0U};
+      for (std::size_t r = 2; r < runs.size(); r += 2)
+        merged.push_back(runs[r]);
+      if (merged.back() != n) merged.push_back(n);
+      pool.run(runs.size() / 2, [&](std::size_t p) {
+        std::size_t r = 2 * p;
+        if (r + 2 < runs.size())
+          std::inplace_merge(first + runs[r], first + runs[r + 1],
+                             first + runs[r + 2], comp);
+      });
+      runs = std::move(merged);
+    }
+  }
+}
+}  // namespace detail
+
+template <class RandomIt, class Compare>
+void sort(thread_pool &pool, RandomIt first, RandomIt last, Compare comp) {
+  detail::merge_sort(pool, first, last, comp, [&](RandomIt b, RandomIt e) {
+    std::sort(b, e, comp);
+  });
+}
+
+template <class RandomIt, class Compare>
+void stable_sort(thread_pool &pool, RandomIt first, RandomIt last,
+                 Compare comp) {
+  detail::merge_sort(pool, first, last, comp, [&](RandomIt b, RandomIt e) {
+    std::stable_sort(b, e, comp);
+  });
+}
+
+template <class RandomIt, class OutputIt, class UnaryOp>
+OutputIt transform(thread_pool &pool, RandomIt first, RandomIt last,
+                   OutputIt d_first, UnaryOp op) {
+  const std::size_t n = last - first;
+  detail::for_chunks(pool, n, detail::chunk_count(pool, n),
+                     [&](std::size_t b, std::size_t e) {
+                       std::transform(first + b, first + e, d_first + b, op);
+                     });
+  return d_first + n;
+}
+
+template <class RandomIt, class T, class BinaryOp>
+T reduce(thread_pool &pool, RandomIt first, RandomIt last, T init,
+         BinaryOp op) {
+  const std::size_t n = last - first;
+  const std::size_t chunks = detail::chunk_count(pool, n);
+  std::vector<std::optional<T>> partial(chunks);
+  pool.run(chunks, [&](std::size_t c) {
+    std::size_t b = detail::chunk_begin(n, chunks, c);
+    std::size_t e = detail::chunk_begin(n, chunks, c + 1);
+    if (b == e) return;
+    T sum = first[b];
+    for (std::size_t i = b + 1; i < e; ++i)
+      sum = op(std::move(sum), first[i]);
+    partial[c] = std::move(sum);
+  });
+  for (auto &sum : partial)
+    if (sum) init = op(std::move(init), std::move(*sum));
+  return init;
+}
+
+// Три фазы: суммы кусков, их префиксы (последовательно, кусков немного) и
+// сканирование каждого куска со своим смещением. d_first может совпадать
+// с first.
+template <class RandomIt, class OutputIt, class BinaryOp>
+OutputIt inclusive_scan(thread_pool &pool, RandomIt first, RandomIt last,
+                        OutputIt d_first, BinaryOp op) {
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+  const std::size_t n = last - first;
+  const std::size_t chunks = detail::chunk_count(pool, n);
+  if (chunks <= 1U) return std::inclusive_scan(first, last, d_first, op);
+
+  std::vector<std::optional<value_type>> offset(chunks);
+  pool.run(chunks - 1, [&](std::size_t c) {
+    std::size_t b = detail::chunk_begin(n, chunks, c);
+    std::size_t e = detail::chunk_begin(n, chunks, c + 1);
+    value_type sum = first[b];
+    for (std::size_t i = b + 1; i < e; ++i)
+      sum = op(std::move(sum), first[i]);
+    offset[c + 1] = std::move(sum);
+  });
+  for (std::size_t c = 2; c < chunks; ++c)
+    offset[c] = op(*offset[c - 1], std::move(*offset[c]));
+  pool.run(chunks, [&](std::size_t c) {
+    std::size_t b = detail::chunk_begin(n, chunks, c);
+    std::size_t e = detail::chunk_begin(n, chunks, c + 1);
+    if (!offset[c]) {
+      std::inclusive_scan(first + b, first + e, d_first + b, op);
+      return;
+    }
+    value_type sum = *offset[c];
+    for (std::size_t i = b; i < e; ++i) {
+      sum = op(std::move(sum), first[i]);
+      d_first[i] = sum;
+    }
+  });
+  return d_first + n;
+}
+
+template <class RandomIt, class UnaryFn>
+void for_each(thread_pool &pool, RandomIt first, RandomIt last, UnaryFn fn) {
+  const std::size_t n = last - first;
+  detail::for_chunks(pool, n, detail::chunk_count(pool, n),
+                     [&](std::size_t b, std::size_t e) {
+                       std::for_each(first + b, first + e, fn);
+                     });
+}
+}  // namespace parallel
+}  // namespace s21
@@ -0,0 +1,158 @@
+#ifndef _S21_THREAD_POOL_H_
+#define _S21_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+namespace parallel {
+// Пул из size() участников: size() - 1 рабочих потоков и вызывающий поток,
+// который всегда работает над своей задачей сам. Поэтому thread_pool(1)
+// выполняет всё последовательно, а вложенные run() не блокируют друг друга:
+// владелец пачки может доделать её в одиночку.
+class thread_pool {
+ public:
+  using size_type = std::size_t;
+
+  explicit thread_pool(size_type threads = hardware_threads()) {
+    threads = std::max<size_type>(threads, 1U);
+    workers_.reserve(threads - 1);
+    for (size_type i = 1; i < threads; ++i)
+      workers_.emplace_back([this] { worker_loop(); });
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) worker.join();
+  }
+
+  size_type size() const noexcept { return workers_.size() + 1; }
+
+  static size_type hardware_threads() noexcept {
+    return std::max(std::thread::hardware_concurrency(), 1U);
+  }
+
+  // Вызывает fn(i) для каждого i из [0, tasks) и ждёт завершения всех
+  // вызовов. Первое брошенное исключение пробрасывается вызывающему,
+  // оставшиеся задачи после него пропускаются.
+  template <typename Fn>
+  void run(size_type tasks, Fn &&fn);
+
+ private:
+  struct batch {
+    explicit batch(size_type tasks) : count(tasks) {}
+
+    void work() {
+      for (;;) {
+        size_type i = next.fetch_add(1, std::memory_order_relaxed);
+        if (i >= count) return;
+        if (!failed.load(std::memory_order_relaxed)) {
+          try {
+            task(i);
+          } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) error = std::current_exception();
+            failed.store(true, std::memory_order_relaxed);
+          }
+        }
+        if (finished.fetch_add(1, std::memory_order_acq_rel) + 1 == count) {
+          std::lock_guard<std::mutex> lock(mutex);
+          done.notify_all();
+        }
+      }
+    }
+
+    void task(size_type i) { invoke(context, i); }
+
+    const size_type count;
+    void (*invoke)(void *, size_type) = nullptr;
+    void *context = nullptr;
+    std::atomic<size_type> next{0};
+    std::atomic<size_type> finished{0};
+    std::atomic<bool> failed{false};
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+  };
+
+  void worker_loop() {
+    for (;;) {
+      std::shared_ptr<batch> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) return;
+        job = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      job->work();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::deque<std::shared_ptr<batch>> queue_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+};
+
+template <typename Fn>
+void thread_pool::run(size_type tasks, Fn &&fn) {
+  if (tasks == 0U) return;
+  if (tasks == 1U || workers_.empty()) {
+    for (size_type i = 0; i < tasks; ++i) fn(i);
+    return;
+  }
+
+  auto job = std::make_shared<batch>(tasks);
+  const void *context = std::addressof(fn);
+  job->context = const_cast<void *>(context);
+  job->invoke = [](void *context, size_type i) {
+    (*static_cast<std::remove_reference_t<Fn> *>(context))(i);
+  };
+  size_type helpers = std::min(tasks - 1, workers_.size());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_type i = 0; i < helpers; ++i) queue_.push_back(job);
+  }
+  if (helpers == 1U)
+    wake_.notify_one();
+  else
+    wake_.notify_all();
+
+  job->work();
+  {
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->done.wait(lock, [&] {
+      return job->finished.load(std::memory_order_acquire) == tasks;
+    });
+  }
+  if (job->error) std::rethrow_exception(job->error);
+}
+
+// Общий пул на все потоки процесса, создаётся при первом обращении.
+inline thread_pool &default_pool() {
+  static thread_pool pool;
+  return pool;
+}
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // _S21_THREAD_POOL_H_
@@ -0,0 +1,172 @@
+#ifndef _S21_RADIX_MAP_H_
+#define _S21_RADIX_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Compressed trie over std::string keys. Every edge holds a whole run of
+// characters, so shared prefixes are stored once and a lookup touches each
+// key byte once, independent of the number of elements. Iteration visits
+// keys in std::string order.
+//
+// Keys are not stored whole, so an iterator cannot hand out a
+// pair<const key_type, mapped_type> like s21::map does: value_type is the
+// mapped value, *it refers to it, and it.key() rebuilds the key.
+template <typename V>
+class radix_map {
+ public:
+  template <bool Const>
+  class IteratorRadix;
+
+  using key_type = std::string;
+  using mapped_type = V;
+  using value_type = mapped_type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = IteratorRadix<false>;
+  using const_iterator = IteratorRadix<true>;
+  using size_type = std::size_t;
+
+ protected:
+  struct Node {
+    std::string label_;
+    Node *parent_;
+    std::vector<Node *> children_;  // по возрастанию первого символа label_
+    std::optional<V> value_;
+
+    explicit Node(const std::string &label, Node *parent)
+        : label_(label), parent_(parent) {}
+  };
+
+  Node *root_ = nullptr;
+  size_type size_ = 0;
+
+ public:
+  // Forward iterator; the full key is rebuilt while walking, so key() is
+  // available without storing keys in the nodes. iterator converts to
+  // const_iterator.
+  template <bool Const>
+  class IteratorRadix {
+    friend class radix_map<V>;
+    template <bool>
+    friend class IteratorRadix;
+
+   public:
+    using value_type = V;
+    using reference = std::conditional_t<Const, const V &, V &>;
+    using pointer = std::conditional_t<Const, const V *, V *>;
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+
+    IteratorRadix() : current_(nullptr) {}
+    IteratorRadix(Node *node, const std::string &key)
+        : current_(node), key_(key) {}
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    IteratorRadix(const IteratorRadix<OtherConst> &other)
+        : current_(other.current_), key_(other.key_) {}
+
+    reference operator*() const { return *current_->value_; }
+    pointer operator->() const { return &*current_->value_; }
+
+    const std::string &key() const { return key_; }
+    reference value() const { return *current_->value_; }
+
+    IteratorRadix &operator++() {
+      current_ = next_value(current_, key_, true);
+      return *this;
+    }
+
+    IteratorRadix operator++(int) {
+      IteratorRadix temp = *this;
+      ++(*this);
+      return temp;
+    }
+
+    friend bool operator==(const IteratorRadix &a, const IteratorRadix &b) {
+      return a.current_ == b.current_;
+    }
+
+    friend bool operator!=(const IteratorRadix &a, const IteratorRadix &b) {
+      return a.current_ != b.current_;
+    }
+
+   protected:
+    Node *current_ = nullptr;
+    std::string key_;
+  };
+
+  radix_map();
+  radix_map(std::initializer_list<std::pair<std::string, V>> const &items);
+  radix_map(const radix_map &other);
+  radix_map(radix_map &&other) noexcept;
+  ~radix_map();
+
+  radix_map &operator=(radix_map &&other) noexcept;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const;
+  size_type size() const;
+  void clear();
+  void swap(radix_map &other) noexcept;
+
+  std::pair<iterator, bool> insert(const std::string &key, const V &value);
+  std::pair<iterator, bool> insert_or_assign(const std::string &key,
+                                             const V &value);
+  V &at(const std::string &key);
+  const V &at(const std::string &key) const;
+  V &operator[](const std::string &key);
+
+  iterator find(const std::string &key);
+  const_iterator find(const std::string &key) const;
+  bool contains(const std::string &key) const;
+  size_type erase(const std::string &key);
+  void erase(const_iterator pos);
+
+  iterator lower_bound(const std::string &key);
+  const_iterator lower_bound(const std::string &key) const;
+  std::pair<iterator, iterator> prefix_range(const std::string &prefix);
+  std::pair<const_iterator, const_iterator> prefix_range(
+      const std::string &prefix) const;
+
+ private:
+  static unsigned char first_byte(const Node *node);
+  static typename std::vector<Node *>::iterator child_position(
+      Node *node, unsigned char byte);
+  static Node *child(const Node *node, unsigned char byte);
+  static Node *next_node(Node *node, std::string &key, bool descend);
+  static Node *next_value(Node *node, std::string &key, bool descend);
+  static iterator first_value(Node *node, std::string key);
+  static iterator after_subtree(Node *node, std::string key);
+
+  iterator lower_bound_of(const std::string &key) const;
+  std::pair<iterator, iterator> prefix_range_of(
+      const std::string &prefix) const;
+  Node *find_node(const std::string &key) const;
+  Node *insert_node(const std::string &key);
+  void remove_node(Node *node);
+  Node *locate_prefix(const std::string &prefix, std::string &path) const;
+
+  static Node *copy_tree(const Node *node, Node *parent);
+  static void clear(Node *node);
+};
+}  // namespace s21
+
+#include "s21_radix_map.tpp"
+
+#endif  // _S21_RADIX_MAP_H_
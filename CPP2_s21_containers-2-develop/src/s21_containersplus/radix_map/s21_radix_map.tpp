@@ -0,0 +1,428 @@
+namespace s21 {
+template <typename V>
+radix_map<V>::radix_map() : root_(nullptr), size_(0) {}
+
+template <typename V>
+radix_map<V>::radix_map(
+    std::initializer_list<std::pair<std::string, V>> const &items)
+    : radix_map() {
+  for (const auto &item : items) insert(item.first, item.second);
+}
+
+template <typename V>
+radix_map<V>::radix_map(const radix_map &other)
+    : root_(copy_tree(other.root_, nullptr)), size_(other.size_) {}
+
+template <typename V>
+radix_map<V>::radix_map(radix_map &&other) noexcept
+    : root_(other.root_), size_(other.size_) {
+  other.root_ = nullptr;
+  other.size_ = 0;
+}
+
+template <typename V>
+radix_map<V>::~radix_map() {
+  clear();
+}
+
+template <typename V>
+radix_map<V> &radix_map<V>::operator=(radix_map &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename V>
+typename radix_map<V>::iterator radix_map<V>::begin() {
+  return first_value(root_, std::string());
+}
+
+template <typename V>
+typename radix_map<V>::iterator radix_map<V>::end() {
+  return iterator();
+}
+
+template <typename V>
+typename radix_map<V>::const_iterator radix_map<V>::begin() const {
+  return first_value(root_, std::string());
+}
+
+template <typename V>
+typename radix_map<V>::const_iterator radix_map<V>::end() const {
+  return const_iterator();
+}
+
+template <typename V>
+bool radix_map<V>::empty() const {
+  return size_ == 0;
+}
+
+template <typename V>
+typename radix_map<V>::size_type radix_map<V>::size() const {
+  return size_;
+}
+
+template <typename V>
+void radix_map<V>::clear() {
+  clear(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename V>
+void radix_map<V>::swap(radix_map &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+}
+
+template <typename V>
+std::pair<typename radix_map<V>::iterator, bool> radix_map<V>::insert(
+    const std::string &key, const V &value) {
+  Node *node = insert_node(key);
+  if (node->value_) return std::make_pair(iterator(node, key), false);
+  node->value_.emplace(value);
+  ++size_;
+  return std::make_pair(iterator(node, key), true);
+}
+
+template <typename V>
+std::pair<typename radix_map<V>::iterator, bool> radix_map<V>::insert_or_assign(
+    const std::string &key, const V &value) {
+  Node *node = insert_node(key);
+  bool inserted = !node->value_;
+  node->value_ = value;
+  if (inserted) ++size_;
+  return std::make_pair(iterator(node, key), inserted);
+}
+
+template <typename V>
+V &radix_map<V>::at(const std::string &key) {
+  Node *node = find_node(key);
+  if (node == nullptr) throw std::out_of_range("radix_map: key not found");
+  return *node->value_;
+}
+
+template <typename V>
+const V &radix_map<V>::at(const std::string &key) const {
+  Node *node = find_node(key);
+  if (node == nullptr) throw std::out_of_range("radix_map: key not found");
+  return *node->value_;
+}
+
+template <typename V>
+V &radix_map<V>::operator[](const std::string &key) {
+  Node *node = insert_node(key);
+  if (!node->value_) {
+    node->value_.emplace();
+    ++size_;
+  }
+  return *node->value_;
+}
+
+template <typename V>
+typename radix_map<V>::iterator radix_map<V>::find(const std::string &key) {
+  Node *node = find_node(key);
+  return node ? iterator(node, key) : end();
+}
+
+template <typename V>
+typename radix_map<V>::const_iterator radix_map<V>::find(
+    const std::string &key) const {
+  Node *node = find_node(key);
+  return node ? const_iterator(node, key) : end();
+}
+
+template <typename V>
+bool radix_map<V>::contains(const std::string &key) const {
+  return find_node(key) != nullptr;
+}
+
+template <typename V>
+typename radix_map<V>::size_type radix_map<V>::erase(const std::string &key) {
+  Node *node = find_node(key);
+  if (node == nullptr) return 0;
+  remove_node(node);
+  return 1;
+}
+
+template <typename V>
+void radix_map<V>::erase(const_iterator pos) {
+  if (pos.current_ != nullptr) remove_node(pos.current_);
+}
+
+template <typename V>
+typename radix_map<V>::iterator radix_map<V>::lower_bound(
+    const std::string &key) {
+  return lower_bound_of(key);
+}
+
+template <typename V>
+typename radix_map<V>::const_iterator radix_map<V>::lower_bound(
+    const std::string &key) const {
+  return lower_bound_of(key);
+}
+
+template <typename V>
+std::pair<typename radix_map<V>::iterator, typename radix_map<V>::iterator>
+radix_map<V>::prefix_range(const std::string &prefix) {
+  return prefix_range_of(prefix);
+}
+
+template <typename V>
+std::pair<typename radix_map<V>::const_iterator,
+          typename radix_map<V>::const_iterator>
+radix_map<V>::prefix_range(const std::string &prefix) const {
+  return prefix_range_of(prefix);
+}
+
+// Узлы общие для обеих константностей; открытые перегрузки выше решают,
+// можно ли менять значения через результат.
+template <typename V>
+typename radix_map<V>::iterator radix_map<V>::lower_bound_of(
+    const std::string &key) const {
+  if (root_ == nullptr) return iterator();
+  Node *node = root_;
+  std::string path;
+  size_type pos = 0;
+  while (pos < key.size()) {
+    unsigned char byte = static_cast<unsigned char>(key[pos]);
+    auto it = child_position(node, byte);
+    if (it == node->children_.end()) return after_subtree(node, path);
+    Node *next = *it;
+    std::string next_path = path + next->label_;
+    if (first_byte(next) != byte) return first_value(next, next_path);
+
+    const std::string &label = next->label_;
+    size_type limit = std::min(label.size(), key.size() - pos);
+    size_type common = 0;
+    while (common < limit && label[common] == key[pos + common]) ++common;
+    if (common < label.size()) {
+      // ключ закончился внутри ребра или разошёлся с ним
+      if (pos + common == key.size() ||
+          static_cast<unsigned char>(label[common]) >
+              static_cast<unsigned char>(key[pos + common]))
+        return first_value(next, next_path);
+      return after_subtree(next, next_path);
+    }
+    node = next;
+    path = std::move(next_path);
+    pos += common;
+  }
+  return first_value(node, path);
+}
+
+template <typename V>
+std::pair<typename radix_map<V>::iterator, typename radix_map<V>::iterator>
+radix_map<V>::prefix_range_of(const std::string &prefix) const {
+  std::string path;
+  Node *node = locate_prefix(prefix, path);
+  if (node == nullptr) {
+    iterator it = lower_bound_of(prefix);
+    return std::make_pair(it, it);
+  }
+  return std::make_pair(first_value(node, path), after_subtree(node, path));
+}
+
+template <typename V>
+unsigned char radix_map<V>::first_byte(const Node *node) {
+  return static_cast<unsigned char>(node->label_[0]);
+}
+
+template <typename V>
+typename std::vector<typename radix_map<V>::Node *>::iterator
+radix_map<V>::child_position(Node *node, unsigned char byte) {
+  return std::lower_bound(
+      node->children_.begin(), node->children_.end(), byte,
+      [](const Node *child, unsigned char b) { return first_byte(child) < b; });
+}
+
+template <typename V>
+typename radix_map<V>::Node *radix_map<V>::child(const Node *node,
+                                                 unsigned char byte) {
+  Node *parent = const_cast<Node *>(node);
+  auto it = child_position(parent, byte);
+  if (it == parent->children_.end() || first_byte(*it) != byte) return nullptr;
+  return *it;
+}
+
+// Следующий узел в прямом обходе; key хранит путь до текущего узла.
+template <typename V>
+typename radix_map<V>::Node *radix_map<V>::next_node(Node *node,
+                                                     std::string &key,
+                                                     bool descend) {
+  if (descend && !node->children_.empty()) {
+    Node *first = node->children_.front();
+    key += first->label_;
+    return first;
+  }
+  while (node->parent_ != nullptr) {
+    Node *parent = node->parent_;
+    auto it = child_position(parent, first_byte(node));
+    key.resize(key.size() - node->label_.size());
+    if (++it != parent->children_.end()) {
+      key += (*it)->label_;
+      return *it;
+    }
+    node = parent;
+  }
+  return nullptr;
+}
+
+template <typename V>
+typename radix_map<V>::Node *radix_map<V>::next_value(Node *node,
+                                                      std::string &key,
+                                                      bool descend) {
+  do {
+    node = next_node(node, key, descend);
+    descend = true;
+  } while (node != nullptr && !node->value_);
+  return node;
+}
+
+template <typename V>
+typename radix_map<V>::iterator radix_map<V>::first_value(Node *node,
+                                                          std::string key) {
+  if (node == nullptr) return iterator();
+  if (node->value_) return iterator(node, key);
+  node = next_value(node, key, true);
+  return node ? iterator(node, key) : iterator();
+}
+
+template <typename V>
+typename radix_map<V>::iterator radix_map<V>::after_subtree(Node *node,
+                                                            std::string key) {
+  node = next_value(node, key, false);
+  return node ? iterator(node, key) : iterator();
+}
+
+template <typename V>
+typename radix_map<V>::Node *radix_map<V>::find_node(
+    const std::string &key) const {
+  Node *node = root_;
+  size_type pos = 0;
+  while (node != nullptr && pos < key.size()) {
+    Node *next = child(node, static_cast<unsigned char>(key[pos]));
+    if (next == nullptr ||
+        key.compare(pos, next->label_.size(), next->label_) != 0)
+      return nullptr;
+    pos += next->label_.size();
+    node = next;
+  }
+  return node && node->value_ ? node : nullptr;
+}
+
+// Возвращает узел ровно для key, при необходимости разрезая ребро.
+template <typename V>
+typename radix_map<V>::Node *radix_map<V>::insert_node(const std::string &key) {
+  if (root_ == nullptr) root_ = new Node(std::string(), nullptr);
+  Node *node = root_;
+  size_type pos = 0;
+  while (pos < key.size()) {
+    unsigned char byte = static_cast<unsigned char>(key[pos]);
+    auto it = child_position(node, byte);
+    if (it == node->children_.end() || first_byte(*it) != byte) {
+      Node *leaf = new Node(key.substr(pos), node);
+      try {
+        node->children_.insert(it, leaf);
+      } catch (...) {
+        delete leaf;
+        throw;
+      }
+      return leaf;
+    }
+
+    Node *next = *it;
+    size_type limit = std::min(next->label_.size(), key.size() - pos);
+    size_type common = 0;
+    while (common < limit && next->label_[common] == key[pos + common])
+      ++common;
+    if (common < next->label_.size()) {
+      Node *middle = new Node(next->label_.substr(0, common), node);
+      try {
+        middle->children_.push_back(next);
+      } catch (...) {
+        delete middle;
+        throw;
+      }
+      next->label_.erase(0, common);
+      next->parent_ = middle;
+      *it = middle;
+      next = middle;
+    }
+    node = next;
+    pos += common;
+  }
+  return node;
+}
+
+// Убирает значение и сжимает путь: пустые листья удаляются, узел без
+// значения с единственным ребёнком сливается с ним.
+template <typename V>
+void radix_map<V>::remove_node(Node *node) {
+  node->value_.reset();
+  --size_;
+  while (node != root_ && !node->value_) {
+    Node *parent = node->parent_;
+    auto it = child_position(parent, first_byte(node));
+    if (node->children_.empty()) {
+      parent->children_.erase(it);
+      delete node;
+      node = parent;
+      continue;
+    }
+    if (node->children_.size() == 1) {
+      Node *only = node->children_.front();
+      only->label_.insert(0, node->label_);
+      only->parent_ = parent;
+      *it = only;
+      node->children_.clear();
+      delete node;
+    }
+    break;
+  }
+}
+
+template <typename V>
+typename radix_map<V>::Node *radix_map<V>::locate_prefix(
+    const std::string &prefix, std::string &path) const {
+  Node *node = root_;
+  size_type pos = 0;
+  while (node != nullptr && pos < prefix.size()) {
+    Node *next = child(node, static_cast<unsigned char>(prefix[pos]));
+    if (next == nullptr) return nullptr;
+    size_type length = std::min(next->label_.size(), prefix.size() - pos);
+    if (prefix.compare(pos, length, next->label_, 0, length) != 0)
+      return nullptr;
+    path += next->label_;
+    pos += length;
+    node = next;
+  }
+  return node;
+}
+
+template <typename V>
+typename radix_map<V>::Node *radix_map<V>::copy_tree(const Node *node,
+                                                     Node *parent) {
+  if (node == nullptr) return nullptr;
+  Node *copy = new Node(node->label_, parent);
+  try {
+    copy->value_ = node->value_;
+    copy->children_.reserve(node->children_.size());
+    for (const Node *child : node->children_)
+      copy->children_.push_back(copy_tree(child, copy));
+  } catch (...) {
+    clear(copy);
+    throw;
+  }
+  return copy;
+}
+
+template <typename V>
+void radix_map<V>::clear(Node *node) {
+  if (node == nullptr) return;
+  for (Node *child : node->children_) clear(child);
+  delete node;
+}
+}  // namespace s21
@@ -0,0 +1,288 @@
+#ifndef _S21_ROPE_H_
+#define _S21_ROPE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/s21_checked.h"
+#include "../../s21_containers/vector/s21_vector.h"
+
+namespace s21 {
+template <typename Rope>
+class ropeIterator;
+
+// Sequence stored as a balanced (AVL) tree of contiguous chunks of up to
+// chunk_capacity elements. Indexing, insert, erase, substr and
+// concatenation walk or rebuild one root-to-leaf path, so they cost
+// O(log n) node operations plus at most a couple of chunk copies,
+// whatever the length. Nodes are reference counted and shared: copying a
+// rope or taking a substr copies no elements, and a shared node is cloned
+// only when one of its owners changes it (copy-on-write).
+//
+// Elements are read-only through references and iterators; set() writes
+// one element. push_back and append fill the last chunk in place, so
+// building a long sequence from fragments never recopies what is already
+// there. Any modification invalidates iterators.
+template <typename T, typename Allocator = std::allocator<T>>
+class rope {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = const T &;
+  using const_reference = const T &;
+  using iterator = ropeIterator<rope>;
+  using const_iterator = ropeIterator<rope>;
+
+  static constexpr size_type chunk_capacity =
+      sizeof(T) < 4096U ? 4096U / sizeof(T) : 1U;
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  rope() noexcept(noexcept(Allocator())) = default;
+  explicit rope(const allocator_type &alloc) noexcept : alloc_(alloc) {}
+  rope(size_type count, const_reference value,
+       const allocator_type &alloc = allocator_type());
+  rope(std::initializer_list<T> const &items,
+       const allocator_type &alloc = allocator_type());
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  rope(InputIt first, InputIt last,
+       const allocator_type &alloc = allocator_type());
+  rope(const rope &other)
+      : alloc_(alloc_traits::select_on_container_copy_construction(
+            other.alloc_)) {
+    if (alloc_ == other.alloc_)
+      root_ = other.root_;
+    else
+      assign_copy(other);
+  }
+  rope(rope &&other) noexcept
+      : root_(std::move(other.root_)), alloc_(std::move(other.alloc_)) {}
+  ~rope() = default;
+  rope &operator=(const rope &other);
+  rope &operator=(rope &&other) noexcept(
+      std::allocator_traits<Allocator>::is_always_equal::value ||
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value);
+
+  allocator_type get_allocator() const { return alloc_; }
+
+  const_reference at(size_type pos) const;
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+  void set(size_type pos, const_reference value);
+
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0U); }
+  const_iterator cend() const noexcept {
+    return const_iterator(this, size());
+  }
+
+  bool empty() const noexcept { return size() == 0U; }
+  size_type size() const noexcept { return root_ ? root_->size : 0U; }
+  size_type max_size() const noexcept {
+    return alloc_traits::max_size(alloc_);
+  }
+  // Высота дерева чанков: 0 для пустой строки, 1 для одного чанка.
+  size_type depth() const noexcept {
+    return root_ ? static_cast<size_type>(root_->height) + 1U : 0U;
+  }
+
+  void clear() noexcept { root_.reset(); }
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <class... Args>
+  void emplace_back(Args &&...args);
+  void pop_back();
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  rope &append(InputIt first, InputIt last);
+  rope &append(const rope &other);
+  rope &operator+=(const rope &other) { return append(other); }
+
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator insert(const_iterator pos, const rope &other);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  rope substr(size_type pos, size_type count = npos) const;
+  void swap(rope &other) noexcept;
+
+  // fn(first, last) для каждого чанка по порядку — самый быстрый проход.
+  template <typename Fn>
+  void for_each_segment(Fn fn) const;
+
+ private:
+  friend class ropeIterator<rope>;
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using chunk_type = vector<T, Allocator>;
+
+  // Лист хранит чанк, внутренний узел — двух детей (оба не пустые) и
+  // суммарный размер. Высота листа 0.
+  struct node {
+    explicit node(const Allocator &alloc) : chunk(alloc) {}
+
+    size_type size = 0;
+    int height = 0;
+    std::shared_ptr<node> left;
+    std::shared_ptr<node> right;
+    chunk_type chunk;
+  };
+  using node_ptr = std::shared_ptr<node>;
+  using node_allocator = typename alloc_traits::template rebind_alloc<node>;
+
+  static bool is_leaf(const node &n) noexcept { return !n.left; }
+  static int height_of(const node_ptr &n) noexcept {
+    return n ? n->height : -1;
+  }
+
+  node_ptr make_leaf(const T *first, const T *last) const;
+  node_ptr make_node(node_ptr left, node_ptr right) const;
+  node_ptr join(const node_ptr &a, const node_ptr &b) const;
+  node_ptr balance(const node_ptr &left, const node_ptr &right) const;
+  std::pair<node_ptr, node_ptr> split(const node_ptr &n,
+                                      size_type pos) const;
+  node_ptr build(vector<node_ptr> &leaves) const;
+  // Копирует элементы other в узлы своего аллокатора; для присваивания
+  // между неравными аллокаторами, когда делить узлы нельзя.
+  void assign_copy(const rope &other);
+  void unshare(node_ptr &n) const;
+  const node *leaf_at(size_type &pos) const noexcept;
+  bool tail_has_room() const noexcept;
+  template <typename Fill>
+  void fill_tail(Fill fill);
+  template <typename Fn>
+  static void visit_leaves(const node &n, Fn &fn);
+
+  node_ptr root_;
+  allocator_type alloc_;
+};
+
+template <typename T, typename Allocator>
+rope<T, Allocator> operator+(const rope<T, Allocator> &lhs,
+                             const rope<T, Allocator> &rhs) {
+  rope<T, Allocator> result(lhs);
+  result += rhs;
+  return result;
+}
+
+template <typename T, typename Allocator>
+bool operator==(const rope<T, Allocator> &lhs,
+                const rope<T, Allocator> &rhs) {
+  return lhs.size() == rhs.size() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, typename Allocator>
+bool operator!=(const rope<T, Allocator> &lhs,
+                const rope<T, Allocator> &rhs) {
+  return !(lhs == rhs);
+}
+
+// Итератор помнит индекс и чанк, в котором был в последний раз: внутри
+// чанка шаг — сдвиг указателя, спуск от корня нужен только при переходе
+// в другой чанк.
+template <typename Rope>
+class ropeIterator {
+ public:
+  using value_type = typename Rope::value_type;
+  using reference = const value_type &;
+  using pointer = const value_type *;
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+
+  ropeIterator() = default;
+  ropeIterator(const Rope *owner, std::size_t index)
+      : owner_(owner), index_(index) {}
+
+  reference operator*() const {
+    if (index_ - chunk_first_ >= chunk_size_) locate();
+    return chunk_[index_ - chunk_first_];
+  }
+  pointer operator->() const { return &**this; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+  std::size_t index() const noexcept { return index_; }
+
+  ropeIterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+  ropeIterator &operator-=(difference_type n) { return *this += -n; }
+  ropeIterator &operator++() { return *this += 1; }
+  ropeIterator &operator--() { return *this += -1; }
+  ropeIterator operator++(int) {
+    ropeIterator temp(*this);
+    ++*this;
+    return temp;
+  }
+  ropeIterator operator--(int) {
+    ropeIterator temp(*this);
+    --*this;
+    return temp;
+  }
+  ropeIterator operator+(difference_type n) const {
+    ropeIterator temp(*this);
+    return temp += n;
+  }
+  ropeIterator operator-(difference_type n) const {
+    ropeIterator temp(*this);
+    return temp -= n;
+  }
+  friend ropeIterator operator+(difference_type n, const ropeIterator &it) {
+    return it + n;
+  }
+  difference_type operator-(const ropeIterator &other) const {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  bool operator==(const ropeIterator &other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const ropeIterator &other) const {
+    return index_ != other.index_;
+  }
+  bool operator<(const ropeIterator &other) const {
+    return index_ < other.index_;
+  }
+  bool operator>(const ropeIterator &other) const {
+    return index_ > other.index_;
+  }
+  bool operator<=(const ropeIterator &other) const {
+    return index_ <= other.index_;
+  }
+  bool operator>=(const ropeIterator &other) const {
+    return index_ >= other.index_;
+  }
+
+ private:
+  void locate() const {
+    S21_CHECK(index_ < owner_->size(), "Index out of range");
+    std::size_t offset = index_;
+    const auto *leaf = owner_->leaf_at(offset);
+    chunk_ = leaf->chunk.data();
+    chunk_first_ = index_ - offset;
+    chunk_size_ = leaf->size;
+  }
+
+  const Rope *owner_ = nullptr;
+  std::size_t index_ = 0;
+  mutable const value_type *chunk_ = nullptr;
+  mutable std::size_t chunk_first_ = 0;
+  mutable std::size_t chunk_size_ = 0;
+};
+}  // namespace s21
+
+#include "s21_rope.tpp"
+
+#endif  // _S21_ROPE_H_
@@ -0,0 +1,465 @@
+namespace s21 {
+template <typename T, typename Allocator>
+rope<T, Allocator>::rope(size_type count, const_reference value,
+                         const allocator_type &alloc)
+    : alloc_(alloc) {
+  vector<node_ptr> leaves;
+  while (count > 0U) {
+    size_type n = std::min(count, chunk_capacity);
+    node_ptr leaf = make_leaf(nullptr, nullptr);
+    leaf->chunk.insert(leaf->chunk.cend(), n, value);
+    leaf->size = n;
+    leaves.push_back(std::move(leaf));
+    count -= n;
+  }
+  root_ = build(leaves);
+}
+
+template <typename T, typename Allocator>
+rope<T, Allocator>::rope(std::initializer_list<T> const &items,
+                         const allocator_type &alloc)
+    : rope(items.begin(), items.end(), alloc) {}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+rope<T, Allocator>::rope(InputIt first, InputIt last,
+                         const allocator_type &alloc)
+    : alloc_(alloc) {
+  append(first, last);
+}
+
+// Узлы делятся, только если аллокаторы совместимы; иначе элементы
+// копируются в узлы своего аллокатора.
+template <typename T, typename Allocator>
+rope<T, Allocator> &rope<T, Allocator>::operator=(const rope &other) {
+  if (this == &other) return *this;
+  if (!alloc_traits::propagate_on_container_copy_assignment::value &&
+      !(alloc_ == other.alloc_)) {
+    assign_copy(other);
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+    alloc_ = other.alloc_;
+  root_ = other.root_;
+  return *this;
+}
+
+// Чанки other могут делить другие верёвки, поэтому при неравных
+// аллокаторах элементы копируются, а не перемещаются.
+template <typename T, typename Allocator>
+rope<T, Allocator> &rope<T, Allocator>::operator=(rope &&other) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value) {
+  if (this == &other) return *this;
+  if (alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_ == other.alloc_) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+      alloc_ = std::move(other.alloc_);
+    root_ = std::move(other.root_);
+  } else {
+    assign_copy(other);
+  }
+  other.root_.reset();
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::const_reference rope<T, Allocator>::at(
+    size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return leaf_at(pos)->chunk[pos];
+}
+
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::const_reference rope<T, Allocator>::operator[](
+    size_type pos) const {
+  S21_CHECK(pos < size(), "Index out of range");
+  return leaf_at(pos)->chunk[pos];
+}
+
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::const_reference rope<T, Allocator>::front()
+    const {
+  if (empty()) {
+    throw std::out_of_range("FrontError: rope is empty");
+  }
+  size_type pos = 0;
+  return leaf_at(pos)->chunk[pos];
+}
+
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::const_reference rope<T, Allocator>::back()
+    const {
+  if (empty()) {
+    throw std::out_of_range("BackError: rope is empty");
+  }
+  size_type pos = size() - 1;
+  return leaf_at(pos)->chunk[pos];
+}
+
+// Узлы на пути к элементу, которыми владеет ещё кто-то, клонируются;
+// собственные меняются на месте.
+template <typename T, typename Allocator>
+void rope<T, Allocator>::set(size_type pos, const_reference value) {
+  if (pos >= size()) {
+    throw std::out_of_range("SetError: Index out of range");
+  }
+  node_ptr *slot = &root_;
+  while (true) {
+    unshare(*slot);
+    node &n = **slot;
+    if (is_leaf(n)) {
+      n.chunk[pos] = value;
+      return;
+    }
+    if (pos < n.left->size) {
+      slot = &n.left;
+    } else {
+      pos -= n.left->size;
+      slot = &n.right;
+    }
+  }
+}
+
+template <typename T, typename Allocator>
+void rope<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void rope<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// Значение собирается заранее: аргумент может ссылаться на элемент
+// последнего чанка, который переедет при reserve.
+template <typename T, typename Allocator>
+template <class... Args>
+void rope<T, Allocator>::emplace_back(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  if (tail_has_room()) {
+    fill_tail([&value](chunk_type &chunk) {
+      chunk.push_back(std::move(value));
+    });
+    return;
+  }
+  node_ptr leaf = make_leaf(nullptr, nullptr);
+  leaf->chunk.reserve(chunk_capacity);
+  leaf->chunk.push_back(std::move(value));
+  leaf->size = 1U;
+  root_ = join(root_, leaf);
+}
+
+template <typename T, typename Allocator>
+void rope<T, Allocator>::pop_back() {
+  if (!empty()) erase(cend() - 1);
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+rope<T, Allocator> &rope<T, Allocator>::append(InputIt first, InputIt last) {
+  if (first == last) return *this;
+  auto fill = [&first, last](chunk_type &chunk) {
+    for (; chunk.size() < chunk_capacity && first != last; ++first)
+      chunk.push_back(*first);
+  };
+  if (tail_has_room()) fill_tail(fill);
+  vector<node_ptr> leaves;
+  while (first != last) {
+    node_ptr leaf = make_leaf(nullptr, nullptr);
+    leaf->chunk.reserve(chunk_capacity);
+    fill(leaf->chunk);
+    leaf->size = leaf->chunk.size();
+    leaves.push_back(std::move(leaf));
+  }
+  root_ = join(root_, build(leaves));
+  return *this;
+}
+
+template <typename T, typename Allocator>
+rope<T, Allocator> &rope<T, Allocator>::append(const rope &other) {
+  root_ = join(root_, other.root_);
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::iterator rope<T, Allocator>::insert(
+    const_iterator pos, const_reference value) {
+  return insert(pos, rope(&value, &value + 1, alloc_));
+}
+
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::iterator rope<T, Allocator>::insert(
+    const_iterator pos, size_type count, const_reference value) {
+  return insert(pos, rope(count, value, alloc_));
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+typename rope<T, Allocator>::iterator rope<T, Allocator>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  size_type index = pos.index();
+  if (index == size()) {
+    append(first, last);
+    return iterator(this, index);
+  }
+  return insert(pos, rope(first, last, alloc_));
+}
+
+// Все правки ниже собирают новое дерево из кусков старого и подменяют
+// корень последним шагом: при исключении строка не меняется.
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::iterator rope<T, Allocator>::insert(
+    const_iterator pos, const rope &other) {
+  size_type index = pos.index();
+  S21_CHECK(index <= size(), "Index out of range");
+  auto [left, right] = split(root_, index);
+  root_ = join(join(left, other.root_), right);
+  return iterator(this, index);
+}
+
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::iterator rope<T, Allocator>::erase(
+    const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::iterator rope<T, Allocator>::erase(
+    const_iterator first, const_iterator last) {
+  size_type index = first.index();
+  S21_CHECK(first <= last && last.index() <= size(), "Index out of range");
+  auto [left, rest] = split(root_, index);
+  auto [removed, right] = split(rest, last.index() - index);
+  root_ = join(left, right);
+  return iterator(this, index);
+}
+
+template <typename T, typename Allocator>
+rope<T, Allocator> rope<T, Allocator>::substr(size_type pos,
+                                              size_type count) const {
+  if (pos > size()) {
+    throw std::out_of_range("SubstrError: Index out of range");
+  }
+  count = std::min(count, size() - pos);
+  rope result(alloc_);
+  result.root_ = split(split(root_, pos).second, count).first;
+  return result;
+}
+
+template <typename T, typename Allocator>
+void rope<T, Allocator>::swap(rope &other) noexcept {
+  root_.swap(other.root_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value)
+    std::swap(alloc_, other.alloc_);
+}
+
+template <typename T, typename Allocator>
+template <typename Fn>
+void rope<T, Allocator>::for_each_segment(Fn fn) const {
+  if (root_) visit_leaves(*root_, fn);
+}
+
+template <typename T, typename Allocator>
+template <typename Fn>
+void rope<T, Allocator>::visit_leaves(const node &n, Fn &fn) {
+  if (is_leaf(n)) {
+    const T *data = n.chunk.data();
+    fn(data, data + n.size);
+    return;
+  }
+  visit_leaves(*n.left, fn);
+  visit_leaves(*n.right, fn);
+}
+
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::node_ptr rope<T, Allocator>::make_leaf(
+    const T *first, const T *last) const {
+  node_ptr leaf = std::allocate_shared<node>(node_allocator(alloc_), alloc_);
+  if (first != last) {
+    leaf->chunk.reserve(static_cast<size_type>(last - first));
+    leaf->chunk.insert(leaf->chunk.cend(), first, last);
+    leaf->size = leaf->chunk.size();
+  }
+  return leaf;
+}
+
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::node_ptr rope<T, Allocator>::make_node(
+    node_ptr left, node_ptr right) const {
+  node_ptr n = std::allocate_shared<node>(node_allocator(alloc_), alloc_);
+  n->size = left->size + right->size;
+  n->height = std::max(left->height, right->height) + 1;
+  n->left = std::move(left);
+  n->right = std::move(right);
+  return n;
+}
+
+// Склейка AVL-деревьев: спускаемся по краю более высокого дерева до
+// поддерева сравнимой высоты и поднимаемся обратно с поворотами — O(разницы
+// высот). Соседние листья, которые помещаются в один чанк, сливаются,
+// чтобы вставки по одному элементу не дробили строку на мелкие чанки.
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::node_ptr rope<T, Allocator>::join(
+    const node_ptr &a, const node_ptr &b) const {
+  if (!a) return b;
+  if (!b) return a;
+  if (is_leaf(*a) && is_leaf(*b) && a->size + b->size <= chunk_capacity) {
+    node_ptr leaf = make_leaf(nullptr, nullptr);
+    leaf->chunk.reserve(a->size + b->size);
+    leaf->chunk.insert(leaf->chunk.cend(), a->chunk.data(),
+                       a->chunk.data() + a->size);
+    leaf->chunk.insert(leaf->chunk.cend(), b->chunk.data(),
+                       b->chunk.data() + b->size);
+    leaf->size = leaf->chunk.size();
+    return leaf;
+  }
+  if (a->height > b->height + 1) return balance(a->left, join(a->right, b));
+  if (b->height > a->height + 1) return balance(join(a, b->left), b->right);
+  return make_node(a, b);
+}
+
+// Разница высот до 2 исправляется одним или двумя поворотами; большая
+// бывает только после слияния листьев и снова уходит в join.
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::node_ptr rope<T, Allocator>::balance(
+    const node_ptr &left, const node_ptr &right) const {
+  int hl = left->height;
+  int hr = right->height;
+  if (hl > hr + 2 || hr > hl + 2) return join(left, right);
+  if (hl == hr + 2) {
+    if (height_of(left->left) >= height_of(left->right))
+      return make_node(left->left, make_node(left->right, right));
+    const node_ptr &middle = left->right;
+    return make_node(make_node(left->left, middle->left),
+                     make_node(middle->right, right));
+  }
+  if (hr == hl + 2) {
+    if (height_of(right->right) >= height_of(right->left))
+      return make_node(make_node(left, right->left), right->right);
+    const node_ptr &middle = right->left;
+    return make_node(make_node(left, middle->left),
+                     make_node(middle->right, right->right));
+  }
+  return make_node(left, right);
+}
+
+template <typename T, typename Allocator>
+std::pair<typename rope<T, Allocator>::node_ptr,
+          typename rope<T, Allocator>::node_ptr>
+rope<T, Allocator>::split(const node_ptr &n, size_type pos) const {
+  if (!n || pos == 0U) return {nullptr, n};
+  if (pos >= n->size) return {n, nullptr};
+  if (is_leaf(*n)) {
+    const T *data = n->chunk.data();
+    return {make_leaf(data, data + pos), make_leaf(data + pos, data + n->size)};
+  }
+  if (pos < n->left->size) {
+    auto [left, right] = split(n->left, pos);
+    return {left, join(right, n->right)};
+  }
+  auto [left, right] = split(n->right, pos - n->left->size);
+  return {join(n->left, left), right};
+}
+
+// Уровни собираются попарно, нечётный хвост уровня приклеивается через
+// join: высоты соседей отличаются не больше чем на единицу.
+template <typename T, typename Allocator>
+typename rope<T, Allocator>::node_ptr rope<T, Allocator>::build(
+    vector<node_ptr> &leaves) const {
+  while (leaves.size() > 1U) {
+    vector<node_ptr> level;
+    level.reserve(leaves.size() / 2);
+    for (size_type i = 0; i + 1 < leaves.size(); i += 2)
+      level.push_back(make_node(leaves[i], leaves[i + 1]));
+    if (leaves.size() % 2 != 0U) {
+      node_ptr last = join(level[level.size() - 1], leaves[leaves.size() - 1]);
+      level.pop_back();
+      level.push_back(std::move(last));
+    }
+    leaves.swap(level);
+  }
+  return leaves.empty() ? nullptr : leaves[0];
+}
+
+template <typename T, typename Allocator>
+void rope<T, Allocator>::assign_copy(const rope &other) {
+  vector<node_ptr> leaves;
+  other.for_each_segment([this, &leaves](const T *first, const T *last) {
+    leaves.push_back(make_leaf(first, last));
+  });
+  root_ = build(leaves);
+}
+
+// Клон строится через make_leaf с alloc_: копирующий конструктор чанка
+// взял бы аллокатор из select_on_container_copy_construction, и у pmr
+// память ушла бы в ресурс по умолчанию.
+template <typename T, typename Allocator>
+void rope<T, Allocator>::unshare(node_ptr &n) const {
+  if (n.use_count() <= 1) return;
+  const T *chunk = n->chunk.data();
+  node_ptr copy = make_leaf(chunk, chunk + n->chunk.size());
+  copy->size = n->size;
+  copy->height = n->height;
+  copy->left = n->left;
+  copy->right = n->right;
+  n = std::move(copy);
+}
+
+// Спуск к листу с элементом pos; на выходе pos — смещение внутри чанка.
+template <typename T, typename Allocator>
+const typename rope<T, Allocator>::node *rope<T, Allocator>::leaf_at(
+    size_type &pos) const noexcept {
+  const node *n = root_.get();
+  while (!is_leaf(*n)) {
+    if (pos < n->left->size) {
+      n = n->left.get();
+    } else {
+      pos -= n->left->size;
+      n = n->right.get();
+    }
+  }
+  return n;
+}
+
+template <typename T, typename Allocator>
+bool rope<T, Allocator>::tail_has_room() const noexcept {
+  if (!root_) return false;
+  const node *n = root_.get();
+  while (!is_leaf(*n)) n = n->right.get();
+  return n->size < chunk_capacity;
+}
+
+// Дописывает в последний чанк на месте. Правый край дерева сначала
+// становится собственным (разделяемые узлы клонируются), размеры на нём
+// пересчитываются и тогда, когда fill бросил исключение на середине.
+template <typename T, typename Allocator>
+template <typename Fill>
+void rope<T, Allocator>::fill_tail(Fill fill) {
+  node *spine[128];
+  size_type depth = 0;
+  for (node_ptr *slot = &root_;; slot = &(*slot)->right) {
+    unshare(*slot);
+    spine[depth++] = slot->get();
+    if (is_leaf(**slot)) break;
+  }
+  node *tail = spine[depth - 1];
+  auto refresh = [&spine, depth, tail] {
+    tail->size = tail->chunk.size();
+    for (size_type i = depth - 1; i-- > 0U;)
+      spine[i]->size = spine[i]->left->size + spine[i]->right->size;
+  };
+  try {
+    if (tail->chunk.capacity() < chunk_capacity)
+      tail->chunk.reserve(chunk_capacity);
+    fill(tail->chunk);
+  } catch (...) {
+    refresh();
+    throw;
+  }
+  refresh();
+}
+}  // namespace s21
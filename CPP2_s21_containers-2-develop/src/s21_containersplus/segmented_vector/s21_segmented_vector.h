@@ -0,0 +1,237 @@
+#ifndef _S21_SEGMENTED_VECTOR_H_
+#define _S21_SEGMENTED_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/s21_checked.h"
+
+namespace s21 {
+template <typename Vector, bool Const>
+class segmentedIterator;
+
+// Vector whose elements never move. Storage is a fixed table of segments
+// of geometrically growing size (first_segment, then 2x, 4x, ...), so
+// growth allocates one new segment instead of copying everything, and
+// references, pointers and iterators to existing elements stay valid
+// until the element is erased. Element i is found in O(1) from the
+// position of the highest set bit of i / first_segment + 1.
+template <typename T, typename Allocator = std::allocator<T>>
+class segmented_vector {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = segmentedIterator<segmented_vector, false>;
+  using const_iterator = segmentedIterator<segmented_vector, true>;
+
+ private:
+  // Первый сегмент — около 256 байт, округлённых вниз до степени двойки
+  // элементов, чтобы индекс раскладывался сдвигами.
+  static constexpr size_type first_segment_log() {
+    size_type elements = sizeof(T) < 256U ? 256U / sizeof(T) : 1U;
+    size_type log = 0;
+    while ((size_type{2} << log) <= elements) ++log;
+    return log;
+  }
+
+ public:
+  static constexpr size_type first_segment = size_type{1}
+                                             << first_segment_log();
+  static constexpr size_type max_segments =
+      std::numeric_limits<size_type>::digits - first_segment_log();
+
+  segmented_vector() noexcept(noexcept(Allocator())) = default;
+  explicit segmented_vector(const allocator_type &alloc) noexcept
+      : alloc_(alloc) {}
+  explicit segmented_vector(size_type n,
+                            const allocator_type &alloc = allocator_type());
+  segmented_vector(std::initializer_list<T> const &items,
+                   const allocator_type &alloc = allocator_type());
+  segmented_vector(const segmented_vector &other);
+  segmented_vector(segmented_vector &&other) noexcept;
+  ~segmented_vector();
+  segmented_vector &operator=(const segmented_vector &other);
+  segmented_vector &operator=(segmented_vector &&other) noexcept(
+      std::allocator_traits<Allocator>::is_always_equal::value ||
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value);
+
+  allocator_type get_allocator() const { return alloc_; }
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  iterator begin() noexcept { return iterator(this, 0U); }
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0U); }
+  const_iterator cend() const noexcept { return const_iterator(this, size_); }
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_of(segments_); }
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  void shrink_to_fit() noexcept;
+
+  void clear() noexcept;
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void resize(size_type count);
+  void swap(segmented_vector &other) noexcept;
+
+  // fn(first, last) для каждого непрерывного куска элементов по порядку:
+  // внутренний цикл идёт по обычному массиву.
+  template <typename Fn>
+  void for_each_segment(Fn fn);
+  template <typename Fn>
+  void for_each_segment(Fn fn) const;
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static size_type segment_of(size_type pos) noexcept {
+    unsigned long long v = (pos >> first_segment_log()) + 1;
+    return std::numeric_limits<unsigned long long>::digits - 1 -
+           __builtin_clzll(v);
+  }
+  static size_type segment_begin(size_type k) noexcept {
+    return (first_segment << k) - first_segment;
+  }
+  static size_type segment_size(size_type k) noexcept {
+    return first_segment << k;
+  }
+  static size_type capacity_of(size_type segments) noexcept {
+    return segment_begin(segments);
+  }
+  T *slot(size_type pos) const noexcept {
+    size_type k = segment_of(pos);
+    return segments_table_[k] + (pos - segment_begin(k));
+  }
+
+  void add_segment();
+  void destroy_tail(size_type from) noexcept;
+  void release() noexcept;
+  // Забирает сегменты other; аллокаторы должны быть равны.
+  void take(segmented_vector &other) noexcept;
+
+  T *segments_table_[max_segments] = {};
+  size_type segments_ = 0;
+  size_type size_ = 0;
+  allocator_type alloc_;
+};
+
+// Итератор хранит контейнер и индекс: элемент находится заново при каждом
+// разыменовании, поэтому итератор переживает рост контейнера.
+template <typename Vector, bool Const>
+class segmentedIterator {
+ public:
+  using value_type = typename Vector::value_type;
+  using reference = std::conditional_t<Const, const value_type &,
+                                       value_type &>;
+  using pointer = std::conditional_t<Const, const value_type *,
+                                     value_type *>;
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using owner_pointer = std::conditional_t<Const, const Vector *, Vector *>;
+
+  segmentedIterator() = default;
+  segmentedIterator(owner_pointer owner, std::size_t index)
+      : owner_(owner), index_(index) {}
+  template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+  segmentedIterator(const segmentedIterator<Vector, OtherConst> &other)
+      : owner_(other.owner_), index_(other.index_) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+  pointer operator->() const { return &(*owner_)[index_]; }
+  reference operator[](difference_type n) const {
+    return (*owner_)[index_ + n];
+  }
+  std::size_t index() const noexcept { return index_; }
+
+  segmentedIterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+  segmentedIterator &operator-=(difference_type n) { return *this += -n; }
+  segmentedIterator &operator++() { return *this += 1; }
+  segmentedIterator &operator--() { return *this += -1; }
+  segmentedIterator operator++(int) {
+    segmentedIterator temp(*this);
+    ++*this;
+    return temp;
+  }
+  segmentedIterator operator--(int) {
+    segmentedIterator temp(*this);
+    --*this;
+    return temp;
+  }
+  segmentedIterator operator+(difference_type n) const {
+    segmentedIterator temp(*this);
+    return temp += n;
+  }
+  segmentedIterator operator-(difference_type n) const {
+    segmentedIterator temp(*this);
+    return temp -= n;
+  }
+  friend segmentedIterator operator+(difference_type n,
+                                     const segmentedIterator &it) {
+    return it + n;
+  }
+  difference_type operator-(const segmentedIterator &other) const {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  bool operator==(const segmentedIterator &other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const segmentedIterator &other) const {
+    return index_ != other.index_;
+  }
+  bool operator<(const segmentedIterator &other) const {
+    return index_ < other.index_;
+  }
+  bool operator>(const segmentedIterator &other) const {
+    return index_ > other.index_;
+  }
+  bool operator<=(const segmentedIterator &other) const {
+    return index_ <= other.index_;
+  }
+  bool operator>=(const segmentedIterator &other) const {
+    return index_ >= other.index_;
+  }
+
+ private:
+  template <typename, bool>
+  friend class segmentedIterator;
+
+  owner_pointer owner_ = nullptr;
+  std::size_t index_ = 0;
+};
+}  // namespace s21
+
+#include "s21_segmented_vector.tpp"
+
+#endif  // _S21_SEGMENTED_VECTOR_H_
@@ -0,0 +1,307 @@
+namespace s21 {
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::segmented_vector(size_type n,
+                                                 const allocator_type &alloc)
+    : alloc_(alloc) {
+  try {
+    resize(n);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::segmented_vector(
+    std::initializer_list<T> const &items, const allocator_type &alloc)
+    : alloc_(alloc) {
+  try {
+    reserve(items.size());
+    for (const T &item : items) push_back(item);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::segmented_vector(const segmented_vector &other)
+    : alloc_(alloc_traits::select_on_container_copy_construction(
+          other.alloc_)) {
+  try {
+    reserve(other.size_);
+    other.for_each_segment(
+        [this](const T *first, const T *last) {
+          for (; first != last; ++first) push_back(*first);
+        });
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::segmented_vector(
+    segmented_vector &&other) noexcept
+    : alloc_(std::move(other.alloc_)) {
+  take(other);
+}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::~segmented_vector() {
+  release();
+}
+
+// Копия строится аллокатором, который будет у *this после присваивания,
+// и только потом забирается: сегменты всегда освобождает тот аллокатор,
+// что их выделил.
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator> &segmented_vector<T, Allocator>::operator=(
+    const segmented_vector &other) {
+  if (this == &other) return *this;
+  segmented_vector copy(
+      alloc_traits::propagate_on_container_copy_assignment::value
+          ? other.alloc_
+          : alloc_);
+  copy.reserve(other.size_);
+  other.for_each_segment([&copy](const T *first, const T *last) {
+    for (; first != last; ++first) copy.push_back(*first);
+  });
+  release();
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+    alloc_ = other.alloc_;
+  take(copy);
+  return *this;
+}
+
+// Сегменты забираются целиком, только если аллокаторы совместимы; иначе
+// элементы перемещаются поштучно в память своего аллокатора.
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator> &segmented_vector<T, Allocator>::operator=(
+    segmented_vector &&other) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value) {
+  if (this == &other) return *this;
+  if (alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_ == other.alloc_) {
+    release();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+      alloc_ = std::move(other.alloc_);
+    take(other);
+  } else {
+    clear();
+    reserve(other.size_);
+    other.for_each_segment([this](T *first, T *last) {
+      for (; first != last; ++first) push_back(std::move(*first));
+    });
+    other.release();
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::reference
+segmented_vector<T, Allocator>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_reference
+segmented_vector<T, Allocator>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::reference
+segmented_vector<T, Allocator>::operator[](size_type pos) {
+  S21_CHECK(pos < size_, "Index out of range");
+  return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_reference
+segmented_vector<T, Allocator>::operator[](size_type pos) const {
+  S21_CHECK(pos < size_, "Index out of range");
+  return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::reference
+segmented_vector<T, Allocator>::front() {
+  if (empty()) {
+    throw std::out_of_range("FrontError: segmented_vector is empty");
+  }
+  return *slot(0U);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_reference
+segmented_vector<T, Allocator>::front() const {
+  if (empty()) {
+    throw std::out_of_range("FrontError: segmented_vector is empty");
+  }
+  return *slot(0U);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::reference
+segmented_vector<T, Allocator>::back() {
+  if (empty()) {
+    throw std::out_of_range("BackError: segmented_vector is empty");
+  }
+  return *slot(size_ - 1);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_reference
+segmented_vector<T, Allocator>::back() const {
+  if (empty()) {
+    throw std::out_of_range("BackError: segmented_vector is empty");
+  }
+  return *slot(size_ - 1);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::size_type
+segmented_vector<T, Allocator>::max_size() const noexcept {
+  return std::min(capacity_of(max_segments - 1),
+                  alloc_traits::max_size(alloc_));
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("ReserveError: new capacity exceeds max_size");
+  }
+  while (capacity() < size) add_segment();
+}
+
+// Освобождает пустые сегменты в конце таблицы; элементы не двигаются.
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::shrink_to_fit() noexcept {
+  while (segments_ > 0U && segment_begin(segments_ - 1) >= size_) {
+    --segments_;
+    alloc_traits::deallocate(alloc_, segments_table_[segments_],
+                             segment_size(segments_));
+    segments_table_[segments_] = nullptr;
+  }
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::clear() noexcept {
+  destroy_tail(0U);
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// Существующие элементы не переносятся никогда, поэтому аргумент может
+// ссылаться на элемент самого контейнера.
+template <typename T, typename Allocator>
+template <class... Args>
+typename segmented_vector<T, Allocator>::reference
+segmented_vector<T, Allocator>::emplace_back(Args &&...args) {
+  if (size_ == capacity()) {
+    if (size_ == max_size()) {
+      throw std::length_error("s21::segmented_vector exceeds max_size()");
+    }
+    add_segment();
+  }
+  T *p = slot(size_);
+  alloc_traits::construct(alloc_, p, std::forward<Args>(args)...);
+  ++size_;
+  return *p;
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::pop_back() {
+  if (size_ > 0U) destroy_tail(size_ - 1);
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::resize(size_type count) {
+  if (count <= size_) {
+    destroy_tail(count);
+    return;
+  }
+  reserve(count);
+  while (size_ < count) emplace_back();
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::swap(segmented_vector &other) noexcept {
+  std::swap_ranges(segments_table_, segments_table_ + max_segments,
+                   other.segments_table_);
+  std::swap(segments_, other.segments_);
+  std::swap(size_, other.size_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value)
+    std::swap(alloc_, other.alloc_);
+}
+
+template <typename T, typename Allocator>
+template <typename Fn>
+void segmented_vector<T, Allocator>::for_each_segment(Fn fn) {
+  for (size_type k = 0; k < segments_ && segment_begin(k) < size_; ++k) {
+    size_type count = std::min(segment_size(k), size_ - segment_begin(k));
+    fn(segments_table_[k], segments_table_[k] + count);
+  }
+}
+
+template <typename T, typename Allocator>
+template <typename Fn>
+void segmented_vector<T, Allocator>::for_each_segment(Fn fn) const {
+  for (size_type k = 0; k < segments_ && segment_begin(k) < size_; ++k) {
+    size_type count = std::min(segment_size(k), size_ - segment_begin(k));
+    const T *first = segments_table_[k];
+    fn(first, first + count);
+  }
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::add_segment() {
+  segments_table_[segments_] =
+      alloc_traits::allocate(alloc_, segment_size(segments_));
+  ++segments_;
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::destroy_tail(size_type from) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_type i = from; i < size_; ++i)
+      alloc_traits::destroy(alloc_, slot(i));
+  }
+  size_ = from;
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::release() noexcept {
+  destroy_tail(0U);
+  shrink_to_fit();
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::take(segmented_vector &other) noexcept {
+  std::copy(other.segments_table_, other.segments_table_ + max_segments,
+            segments_table_);
+  segments_ = other.segments_;
+  size_ = other.size_;
+  std::fill(other.segments_table_, other.segments_table_ + max_segments,
+            nullptr);
+  other.segments_ = 0U;
+  other.size_ = 0U;
+}
+}  // namespace s21
@@ -0,0 +1,166 @@
+#ifndef _S21_SHARED_VECTOR_H_
+#define _S21_SHARED_VECTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "../../s21_containers/s21_checked.h"
+#include "../../s21_containers/vector/s21_vector.h"
+
+namespace s21 {
+// Vector whose copies share one buffer. The buffer is an s21::vector
+// owned through an atomically reference-counted pointer, so copying a
+// shared_vector — even into another thread — is a single counter
+// increment, and slice() is a view into the same buffer. The first
+// modification through a copy that is not the sole owner copies its
+// elements into a private buffer (copy-on-write); later ones work in
+// place, as in s21::vector.
+//
+//   s21::shared_vector<Rule> rules(load_rules());  // adopts, no copy
+//   for (auto &worker : workers) worker.rules = rules;
+//
+// Elements are read-only through references and iterators (plain
+// pointers, so a shared_vector converts to s21::span<const T>); set() and
+// mutable_data() write. Distinct shared_vector objects may be used from
+// different threads; one object is not synchronized. Any modification
+// invalidates iterators.
+template <typename T, typename Allocator = std::allocator<T>>
+class shared_vector {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = const T &;
+  using const_reference = const T &;
+  using iterator = const T *;
+  using const_iterator = const T *;
+  using vector_type = vector<T, Allocator>;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  shared_vector() noexcept(noexcept(Allocator())) = default;
+  explicit shared_vector(const allocator_type &alloc) noexcept
+      : alloc_(alloc) {}
+  shared_vector(size_type count, const_reference value,
+                const allocator_type &alloc = allocator_type());
+  shared_vector(std::initializer_list<T> const &items,
+                const allocator_type &alloc = allocator_type());
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  shared_vector(InputIt first, InputIt last,
+                const allocator_type &alloc = allocator_type());
+  // Забирает буфер items без копирования элементов.
+  explicit shared_vector(vector_type &&items);
+  shared_vector(const shared_vector &other)
+      : buffer_(other.buffer_),
+        offset_(other.offset_),
+        size_(other.size_),
+        alloc_(alloc_traits::select_on_container_copy_construction(
+            other.alloc_)) {}
+  shared_vector(shared_vector &&other) noexcept;
+  ~shared_vector() = default;
+  shared_vector &operator=(const shared_vector &other);
+  shared_vector &operator=(shared_vector &&other) noexcept(
+      std::allocator_traits<Allocator>::is_always_equal::value ||
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value);
+
+  allocator_type get_allocator() const { return alloc_; }
+
+  const_reference at(size_type pos) const;
+  const_reference operator[](size_type pos) const {
+    S21_CHECK(pos < size_, "Index out of range");
+    return data()[pos];
+  }
+  const_reference front() const;
+  const_reference back() const;
+  const T *data() const noexcept {
+    return buffer_ ? buffer_->data() + offset_ : nullptr;
+  }
+  // Указатель для записи: сначала делает буфер собственным.
+  T *mutable_data();
+  void set(size_type pos, const_reference value);
+
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator end() const noexcept { return data() + size_; }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return alloc_traits::max_size(alloc_);
+  }
+  // Сколько shared_vector (включая срезы) держат этот буфер; 0 у пустого
+  // вектора без буфера.
+  long use_count() const noexcept { return buffer_.use_count(); }
+  bool unique() const noexcept { return use_count() == 1; }
+  void reserve(size_type size);
+  // Переносит элементы в собственный буфер ровно по размеру, отпуская
+  // общий или лишнюю память большого буфера, из которого взят срез.
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <class... Args>
+  void emplace_back(Args &&...args);
+  void pop_back();
+  iterator insert(const_iterator pos, const_reference value);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  // Срез [pos, pos + count) над тем же буфером; элементы не копируются.
+  shared_vector slice(size_type pos, size_type count = npos) const;
+  void swap(shared_vector &other) noexcept;
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  // Обёртка без allocator_type: иначе std::pmr::polymorphic_allocator при
+  // allocate_shared строил бы vector_type по протоколу uses-allocator.
+  struct buffer {
+    explicit buffer(const Allocator &alloc) : items(alloc) {}
+    vector_type items;
+  };
+  using buffer_allocator =
+      typename alloc_traits::template rebind_alloc<buffer>;
+
+  std::shared_ptr<vector_type> make_buffer() const;
+  // Собственный буфер из элементов [first, last), перемещённых или
+  // скопированных; для присваивания между неравными аллокаторами.
+  template <typename InputIt>
+  void assign_buffer(InputIt first, InputIt last, size_type count);
+  // Делает буфер собственным и обрезает его по концу среза; при
+  // копировании резервирует ещё extra мест.
+  void unshare(size_type extra = 0);
+
+  std::shared_ptr<vector_type> buffer_;
+  size_type offset_ = 0;
+  size_type size_ = 0;
+  allocator_type alloc_;
+};
+
+template <typename T, typename Allocator>
+bool operator==(const shared_vector<T, Allocator> &lhs,
+                const shared_vector<T, Allocator> &rhs) {
+  return lhs.size() == rhs.size() &&
+         (lhs.data() == rhs.data() ||
+          std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template <typename T, typename Allocator>
+bool operator!=(const shared_vector<T, Allocator> &lhs,
+                const shared_vector<T, Allocator> &rhs) {
+  return !(lhs == rhs);
+}
+}  // namespace s21
+
+#include "s21_shared_vector.tpp"
+
+#endif  // _S21_SHARED_VECTOR_H_
@@ -0,0 +1,303 @@
+namespace s21 {
+template <typename T, typename Allocator>
+shared_vector<T, Allocator>::shared_vector(size_type count,
+                                           const_reference value,
+                                           const allocator_type &alloc)
+    : alloc_(alloc) {
+  if (count == 0U) return;
+  buffer_ = make_buffer();
+  buffer_->insert(buffer_->cbegin(), count, value);
+  size_ = count;
+}
+
+template <typename T, typename Allocator>
+shared_vector<T, Allocator>::shared_vector(
+    std::initializer_list<T> const &items, const allocator_type &alloc)
+    : shared_vector(items.begin(), items.end(), alloc) {}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+shared_vector<T, Allocator>::shared_vector(InputIt first, InputIt last,
+                                           const allocator_type &alloc)
+    : alloc_(alloc) {
+  buffer_ = make_buffer();
+  buffer_->insert(buffer_->cbegin(), first, last);
+  size_ = buffer_->size();
+}
+
+template <typename T, typename Allocator>
+shared_vector<T, Allocator>::shared_vector(vector_type &&items)
+    : alloc_(items.get_allocator()) {
+  buffer_ = make_buffer();
+  buffer_->swap(items);
+  size_ = buffer_->size();
+}
+
+template <typename T, typename Allocator>
+shared_vector<T, Allocator>::shared_vector(shared_vector &&other) noexcept
+    : buffer_(std::move(other.buffer_)),
+      offset_(other.offset_),
+      size_(other.size_),
+      alloc_(std::move(other.alloc_)) {
+  other.offset_ = other.size_ = 0U;
+}
+
+// Буфер делится, только если аллокаторы после присваивания равны; иначе
+// элементы переносятся в буфер своего аллокатора, как в s21::vector.
+template <typename T, typename Allocator>
+shared_vector<T, Allocator> &shared_vector<T, Allocator>::operator=(
+    const shared_vector &other) {
+  if (this == &other) return *this;
+  if (!alloc_traits::propagate_on_container_copy_assignment::value &&
+      !(alloc_ == other.alloc_)) {
+    assign_buffer(other.begin(), other.end(), other.size_);
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+    alloc_ = other.alloc_;
+  buffer_ = other.buffer_;
+  offset_ = other.offset_;
+  size_ = other.size_;
+  return *this;
+}
+
+template <typename T, typename Allocator>
+shared_vector<T, Allocator> &shared_vector<T, Allocator>::operator=(
+    shared_vector &&other) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value) {
+  if (this == &other) return *this;
+  if (alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_ == other.alloc_) {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+      alloc_ = std::move(other.alloc_);
+    buffer_ = std::move(other.buffer_);
+    offset_ = other.offset_;
+    size_ = other.size_;
+  } else if (other.unique()) {
+    T *first = other.buffer_->data() + other.offset_;
+    assign_buffer(std::make_move_iterator(first),
+                  std::make_move_iterator(first + other.size_), other.size_);
+  } else {
+    assign_buffer(other.begin(), other.end(), other.size_);
+  }
+  other.clear();
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename shared_vector<T, Allocator>::const_reference
+shared_vector<T, Allocator>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return data()[pos];
+}
+
+template <typename T, typename Allocator>
+typename shared_vector<T, Allocator>::const_reference
+shared_vector<T, Allocator>::front() const {
+  if (empty()) {
+    throw std::out_of_range("FrontError: shared_vector is empty");
+  }
+  return data()[0];
+}
+
+template <typename T, typename Allocator>
+typename shared_vector<T, Allocator>::const_reference
+shared_vector<T, Allocator>::back() const {
+  if (empty()) {
+    throw std::out_of_range("BackError: shared_vector is empty");
+  }
+  return data()[size_ - 1];
+}
+
+template <typename T, typename Allocator>
+T *shared_vector<T, Allocator>::mutable_data() {
+  if (empty()) return nullptr;
+  unshare();
+  return buffer_->data() + offset_;
+}
+
+template <typename T, typename Allocator>
+void shared_vector<T, Allocator>::set(size_type pos, const_reference value) {
+  if (pos >= size_) {
+    throw std::out_of_range("SetError: Index out of range");
+  }
+  mutable_data()[pos] = value;
+}
+
+template <typename T, typename Allocator>
+void shared_vector<T, Allocator>::reserve(size_type size) {
+  if (size <= size_) return;
+  unshare(size - size_);
+  buffer_->reserve(offset_ + size);
+}
+
+template <typename T, typename Allocator>
+void shared_vector<T, Allocator>::shrink_to_fit() {
+  if (empty()) {
+    clear();
+    return;
+  }
+  if (unique() && offset_ == 0U && buffer_->size() == size_ &&
+      buffer_->capacity() == size_)
+    return;
+  std::shared_ptr<vector_type> copy = make_buffer();
+  copy->reserve(size_);
+  copy->insert(copy->cbegin(), begin(), end());
+  buffer_ = std::move(copy);
+  offset_ = 0U;
+}
+
+template <typename T, typename Allocator>
+void shared_vector<T, Allocator>::clear() noexcept {
+  buffer_.reset();
+  offset_ = size_ = 0U;
+}
+
+template <typename T, typename Allocator>
+void shared_vector<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void shared_vector<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+void shared_vector<T, Allocator>::emplace_back(Args &&...args) {
+  unshare(1U);
+  buffer_->emplace_back(std::forward<Args>(args)...);
+  ++size_;
+}
+
+template <typename T, typename Allocator>
+void shared_vector<T, Allocator>::pop_back() {
+  if (empty()) return;
+  if (!unique()) {
+    // Копировать ради того, чтобы выбросить последний элемент, незачем:
+    // срез на один короче видит тот же буфер.
+    --size_;
+    return;
+  }
+  unshare();
+  buffer_->pop_back();
+  --size_;
+}
+
+template <typename T, typename Allocator>
+typename shared_vector<T, Allocator>::iterator
+shared_vector<T, Allocator>::insert(const_iterator pos,
+                                    const_reference value) {
+  return insert(pos, &value, &value + 1);
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+typename shared_vector<T, Allocator>::iterator
+shared_vector<T, Allocator>::insert(const_iterator pos, InputIt first,
+                                    InputIt last) {
+  size_type index = static_cast<size_type>(pos - begin());
+  S21_CHECK(index <= size_, "Index out of range");
+  // first может указывать в этот же буфер: unshare и вставка в
+  // s21::vector не должны его испортить, поэтому сначала — копия.
+  vector_type items(alloc_);
+  items.insert(items.cbegin(), first, last);
+  unshare(items.size());
+  buffer_->insert(buffer_->cbegin() + (offset_ + index),
+                  std::make_move_iterator(items.begin()),
+                  std::make_move_iterator(items.end()));
+  size_ += items.size();
+  return begin() + index;
+}
+
+template <typename T, typename Allocator>
+typename shared_vector<T, Allocator>::iterator
+shared_vector<T, Allocator>::erase(const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename T, typename Allocator>
+typename shared_vector<T, Allocator>::iterator
+shared_vector<T, Allocator>::erase(const_iterator first,
+                                   const_iterator last) {
+  size_type from = static_cast<size_type>(first - begin());
+  size_type to = static_cast<size_type>(last - begin());
+  S21_CHECK(from <= to && to <= size_, "Index out of range");
+  if (from == to) return begin() + from;
+  if (!unique() && (from == 0U || to == size_)) {
+    // Обрезка общего буфера с края — тот же буфер, только другой срез.
+    if (from == 0U) offset_ += to;
+    size_ -= to - from;
+    return begin() + from;
+  }
+  unshare();
+  buffer_->erase(buffer_->cbegin() + (offset_ + from),
+                 buffer_->cbegin() + (offset_ + to));
+  size_ -= to - from;
+  return begin() + from;
+}
+
+template <typename T, typename Allocator>
+shared_vector<T, Allocator> shared_vector<T, Allocator>::slice(
+    size_type pos, size_type count) const {
+  if (pos > size_) {
+    throw std::out_of_range("SliceError: Index out of range");
+  }
+  shared_vector result(*this);
+  result.offset_ += pos;
+  result.size_ = std::min(count, size_ - pos);
+  return result;
+}
+
+template <typename T, typename Allocator>
+void shared_vector<T, Allocator>::swap(shared_vector &other) noexcept {
+  buffer_.swap(other.buffer_);
+  std::swap(offset_, other.offset_);
+  std::swap(size_, other.size_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value)
+    std::swap(alloc_, other.alloc_);
+}
+
+template <typename T, typename Allocator>
+std::shared_ptr<typename shared_vector<T, Allocator>::vector_type>
+shared_vector<T, Allocator>::make_buffer() const {
+  std::shared_ptr<buffer> owner =
+      std::allocate_shared<buffer>(buffer_allocator(alloc_), alloc_);
+  return std::shared_ptr<vector_type>(owner, &owner->items);
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt>
+void shared_vector<T, Allocator>::assign_buffer(InputIt first, InputIt last,
+                                                size_type count) {
+  std::shared_ptr<vector_type> fresh = make_buffer();
+  fresh->reserve(count);
+  fresh->insert(fresh->cbegin(), first, last);
+  buffer_ = std::move(fresh);
+  offset_ = 0U;
+  size_ = count;
+}
+
+// use_count() == 1 значит, что других владельцев нет и новых взять
+// неоткуда. Барьер acquire связывает запись с уменьшением счётчика в
+// потоке, который только что отпустил свою копию.
+template <typename T, typename Allocator>
+void shared_vector<T, Allocator>::unshare(size_type extra) {
+  if (buffer_ && unique()) {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (offset_ + size_ != buffer_->size())
+      buffer_->erase(buffer_->cbegin() + (offset_ + size_), buffer_->cend());
+    return;
+  }
+  std::shared_ptr<vector_type> copy = make_buffer();
+  copy->reserve(size_ + extra);
+  copy->insert(copy->cbegin(), begin(), end());
+  buffer_ = std::move(copy);
+  offset_ = 0U;
+}
+}  // namespace s21
@@ -0,0 +1,381 @@
+#ifndef _S21_SIMD_H_
+#define _S21_SIMD_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+// Векторные линейные алгоритмы для непрерывных диапазонов int32_t, float и
+// double: find, count, min_element, max_element, equal, fill. На x86 набор
+// инструкций выбирается при первом вызове: AVX2, если процессор его
+// поддерживает, иначе SSE2. Прочие типы и платформы получают скалярные
+// std-алгоритмы. Результаты совпадают с std, в том числе для NaN и -0.0.
+//
+//   s21::vector<float> samples = ...;
+//   std::size_t hits = s21::simd::count(samples, 0.0f);
+//   auto peak = s21::simd::max_element(samples);
+namespace simd {
+namespace detail {
+template <typename T>
+struct is_vectorizable
+    : std::bool_constant<std::is_same_v<T, std::int32_t> ||
+                         std::is_same_v<T, float> ||
+                         std::is_same_v<T, double>> {};
+
+#if S21_SIMD_X86
+inline bool has_avx2() noexcept {
+  static const bool supported = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  }();
+  return supported;
+}
+
+template <typename Lane, std::size_t N>
+std::size_t sum_lanes(const Lane (&lanes)[N]) {
+  std::size_t total = 0;
+  for (Lane lane : lanes) total += lane;
+  return total;
+}
+
+namespace sse2 {
+template <typename T>
+struct Ops;
+
+template <>
+struct Ops<std::int32_t> {
+  using reg = __m128i;
+  using counter = __m128i;
+  static constexpr std::size_t kWidth = 4;
+  static reg load(const std::int32_t *p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  }
+  static void store(std::int32_t *p, reg v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+  }
+  static reg set1(std::int32_t v) { return _mm_set1_epi32(v); }
+  static reg cmpeq(reg a, reg b) { return _mm_cmpeq_epi32(a, b); }
+  static int mask(reg v) { return _mm_movemask_ps(_mm_castsi128_ps(v)); }
+  static reg bit_or(reg a, reg b) { return _mm_or_si128(a, b); }
+  static reg unordered(reg) { return _mm_setzero_si128(); }
+  // в SSE2 нет pminsd/pmaxsd: выбор по маске сравнения
+  static reg min(reg a, reg b) {
+    reg gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+  }
+  static reg max(reg a, reg b) {
+    reg gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+  }
+  static counter counter_zero() { return _mm_setzero_si128(); }
+  static counter counter_add(counter c, reg eq) { return _mm_sub_epi32(c, eq); }
+  static std::size_t counter_sum(counter c) {
+    alignas(32) std::uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), c);
+    return sum_lanes(lanes);
+  }
+};
+
+template <>
+struct Ops<float> {
+  using reg = __m128;
+  using counter = __m128i;
+  static constexpr std::size_t kWidth = 4;
+  static reg load(const float *p) { return _mm_loadu_ps(p); }
+  static void store(float *p, reg v) { _mm_storeu_ps(p, v); }
+  static reg set1(float v) { return _mm_set1_ps(v); }
+  static reg cmpeq(reg a, reg b) { return _mm_cmpeq_ps(a, b); }
+  static int mask(reg v) { return _mm_movemask_ps(v); }
+  static reg bit_or(reg a, reg b) { return _mm_or_ps(a, b); }
+  static reg unordered(reg v) { return _mm_cmpunord_ps(v, v); }
+  static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+  static counter counter_zero() { return _mm_setzero_si128(); }
+  static counter counter_add(counter c, reg eq) {
+    return _mm_sub_epi32(c, _mm_castps_si128(eq));
+  }
+  static std::size_t counter_sum(counter c) {
+    return Ops<std::int32_t>::counter_sum(c);
+  }
+};
+
+template <>
+struct Ops<double> {
+  using reg = __m128d;
+  using counter = __m128i;
+  static constexpr std::size_t kWidth = 2;
+  static reg load(const double *p) { return _mm_loadu_pd(p); }
+  static void store(double *p, reg v) { _mm_storeu_pd(p, v); }
+  static reg set1(double v) { return _mm_set1_pd(v); }
+  static reg cmpeq(reg a, reg b) { return _mm_cmpeq_pd(a, b); }
+  static int mask(reg v) { return _mm_movemask_pd(v); }
+  static reg bit_or(reg a, reg b) { return _mm_or_pd(a, b); }
+  static reg unordered(reg v) { return _mm_cmpunord_pd(v, v); }
+  static reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+  static counter counter_zero() { return _mm_setzero_si128(); }
+  static counter counter_add(counter c, reg eq) {
+    return _mm_sub_epi64(c, _mm_castpd_si128(eq));
+  }
+  static std::size_t counter_sum(counter c) {
+    alignas(32) std::uint64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), c);
+    return sum_lanes(lanes);
+  }
+};
+
+#include "s21_simd_kernels.inc"
+}  // namespace sse2
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), \
+                             apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+namespace avx2 {
+template <typename T>
+struct Ops;
+
+template <>
+struct Ops<std::int32_t> {
+  using reg = __m256i;
+  using counter = __m256i;
+  static constexpr std::size_t kWidth = 8;
+  static reg load(const std::int32_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  static void store(std::int32_t *p, reg v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+  }
+  static reg set1(std::int32_t v) { return _mm256_set1_epi32(v); }
+  static reg cmpeq(reg a, reg b) { return _mm256_cmpeq_epi32(a, b); }
+  static int mask(reg v) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(v));
+  }
+  static reg bit_or(reg a, reg b) { return _mm256_or_si256(a, b); }
+  static reg unordered(reg) { return _mm256_setzero_si256(); }
+  static reg min(reg a, reg b) { return _mm256_min_epi32(a, b); }
+  static reg max(reg a, reg b) { return _mm256_max_epi32(a, b); }
+  static counter counter_zero() { return _mm256_setzero_si256(); }
+  static counter counter_add(counter c, reg eq) {
+    return _mm256_sub_epi32(c, eq);
+  }
+  static std::size_t counter_sum(counter c) {
+    alignas(32) std::uint32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), c);
+    return sum_lanes(lanes);
+  }
+};
+
+template <>
+struct Ops<float> {
+  using reg = __m256;
+  using counter = __m256i;
+  static constexpr std::size_t kWidth = 8;
+  static reg load(const float *p) { return _mm256_loadu_ps(p); }
+  static void store(float *p, reg v) { _mm256_storeu_ps(p, v); }
+  static reg set1(float v) { return _mm256_set1_ps(v); }
+  static reg cmpeq(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+  static int mask(reg v) { return _mm256_movemask_ps(v); }
+  static reg bit_or(reg a, reg b) { return _mm256_or_ps(a, b); }
+  static reg unordered(reg v) { return _mm256_cmp_ps(v, v, _CMP_UNORD_Q); }
+  static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+  static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+  static counter counter_zero() { return _mm256_setzero_si256(); }
+  static counter counter_add(counter c, reg eq) {
+    return _mm256_sub_epi32(c, _mm256_castps_si256(eq));
+  }
+  static std::size_t counter_sum(counter c) {
+    return Ops<std::int32_t>::counter_sum(c);
+  }
+};
+
+template <>
+struct Ops<double> {
+  using reg = __m256d;
+  using counter = __m256i;
+  static constexpr std::size_t kWidth = 4;
+  static reg load(const double *p) { return _mm256_loadu_pd(p); }
+  static void store(double *p, reg v) { _mm256_storeu_pd(p, v); }
+  static reg set1(double v) { return _mm256_set1_pd(v); }
+  static reg cmpeq(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+  static int mask(reg v) { return _mm256_movemask_pd(v); }
+  static reg bit_or(reg a, reg b) { return _mm256_or_pd(a, b); }
+  static reg unordered(reg v) { return _mm256_cmp_pd(v, v, _CMP_UNORD_Q); }
+  static reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+  static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+  static counter counter_zero() { return _mm256_setzero_si256(); }
+  static counter counter_add(counter c, reg eq) {
+    return _mm256_sub_epi64(c, _mm256_castpd_si256(eq));
+  }
+  static std::size_t counter_sum(counter c) {
+    alignas(32) std::uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), c);
+    return sum_lanes(lanes);
+  }
+};
+
+#include "s21_simd_kernels.inc"
+}  // namespace avx2
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+// Вызывает call(kernels<T>{}) для лучшего доступного набора инструкций.
+template <typename T, typename Call>
+decltype(auto) dispatch(Call call) {
+  if (has_avx2()) return call(avx2::kernels<T>());
+  return call(sse2::kernels<T>());
+}
+#endif  // S21_SIMD_X86
+
+template <typename T>
+constexpr bool use_simd() {
+  return S21_SIMD_X86 && is_vectorizable<std::remove_cv_t<T>>::value;
+}
+}  // namespace detail
+
+template <typename T>
+const T *find(const T *first, const T *last, const T &value) {
+#if S21_SIMD_X86
+  if constexpr (detail::use_simd<T>())
+    return detail::dispatch<T>(
+        [&](auto k) { return decltype(k)::find(first, last, value); });
+#endif
+  return std::find(first, last, value);
+}
+
+template <typename T>
+T *find(T *first, T *last, const T &value) {
+  return const_cast<T *>(
+      find(static_cast<const T *>(first), static_cast<const T *>(last), value));
+}
+
+template <typename T>
+std::size_t count(const T *first, const T *last, const T &value) {
+#if S21_SIMD_X86
+  if constexpr (detail::use_simd<T>())
+    return detail::dispatch<T>(
+        [&](auto k) { return decltype(k)::count(first, last, value); });
+#endif
+  return std::count(first, last, value);
+}
+
+// Первый наименьший элемент, как std::min_element. Значение ищется
+// векторно, затем find находит его первое вхождение.
+template <typename T>
+const T *min_element(const T *first, const T *last) {
+#if S21_SIMD_X86
+  if constexpr (detail::use_simd<T>()) {
+    T value{};
+    bool found = detail::dispatch<T>([&](auto k) {
+      return static_cast<std::size_t>(last - first) >= decltype(k)::kWidth &&
+             decltype(k)::min_value(first, last, value);
+    });
+    if (found) return find(first, last, value);
+  }
+#endif
+  return std::min_element(first, last);
+}
+
+template <typename T>
+const T *max_element(const T *first, const T *last) {
+#if S21_SIMD_X86
+  if constexpr (detail::use_simd<T>()) {
+    T value{};
+    bool found = detail::dispatch<T>([&](auto k) {
+      return static_cast<std::size_t>(last - first) >= decltype(k)::kWidth &&
+             decltype(k)::max_value(first, last, value);
+    });
+    if (found) return find(first, last, value);
+  }
+#endif
+  return std::max_element(first, last);
+}
+
+// Целые std::equal и так сравнивает через memcmp; векторное ядро нужно
+// числам с плавающей точкой, где NaN != NaN и -0.0 == 0.0.
+template <typename T>
+bool equal(const T *first1, const T *last1, const T *first2) {
+#if S21_SIMD_X86
+  if constexpr (detail::use_simd<T>() && std::is_floating_point_v<T>)
+    return detail::dispatch<T>(
+        [&](auto k) { return decltype(k)::equal(first1, last1, first2); });
+#endif
+  return std::equal(first1, last1, first2);
+}
+
+template <typename T>
+void fill(T *first, T *last, const T &value) {
+#if S21_SIMD_X86
+  if constexpr (detail::use_simd<T>()) {
+    detail::dispatch<T>(
+        [&](auto k) { return decltype(k)::fill(first, last, value); });
+    return;
+  }
+#endif
+  std::fill(first, last, value);
+}
+
+// Перегрузки для непрерывных контейнеров (s21::vector, s21::array,
+// s21::small_vector, s21::span): возвращают итераторы самого контейнера.
+// Временным объектом можно передать невладеющее представление, например
+// s21::simd::fill(s21::span(v).last(4), 0); итераторы временного
+// владеющего контейнера после вызова недействительны.
+template <class Container>
+auto find(Container &&c,
+          const typename std::remove_reference_t<Container>::value_type &value)
+    -> decltype(c.begin()) {
+  auto *p = find(c.data(), c.data() + c.size(), value);
+  return c.begin() + (p - c.data());
+}
+
+template <class Container>
+std::size_t count(const Container &c,
+                  const typename Container::value_type &value) {
+  return count(c.data(), c.data() + c.size(), value);
+}
+
+template <class Container>
+auto min_element(Container &&c) -> decltype(c.begin()) {
+  auto *p = min_element(c.data(), c.data() + c.size());
+  return c.begin() + (p - c.data());
+}
+
+template <class Container>
+auto max_element(Container &&c) -> decltype(c.begin()) {
+  auto *p = max_element(c.data(), c.data() + c.size());
+  return c.begin() + (p - c.data());
+}
+
+template <class Container>
+bool equal(const Container &a, const Container &b) {
+  return a.size() == b.size() &&
+         equal(a.data(), a.data() + a.size(), b.data());
+}
+
+template <class Container>
+void fill(
+    Container &&c,
+    const typename std::remove_reference_t<Container>::value_type &value) {
+  fill(c.data(), c.data() + c.size(), value);
+}
+}  // namespace simd
+}  // namespace s21
+
+#endif  // _S21_SIMD_H_
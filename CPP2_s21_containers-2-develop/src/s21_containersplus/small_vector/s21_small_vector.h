@@ -0,0 +1,133 @@
+#ifndef _S21_SMALL_VECTOR_H_
+#define _S21_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/vector/s21_vector.h"
+
+namespace s21 {
+// s21::vector with room for N elements inside the object itself. Short
+// sequences never touch the allocator; past N the elements move to the heap
+// and growth is geometric as in s21::vector. Moving a heap-backed
+// small_vector steals the buffer, moving an inline one moves at most N
+// elements.
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class small_vector {
+  static_assert(N > 0, "small_vector needs a non-empty inline buffer");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = vectorIterator<T, false>;
+  using const_iterator = vectorIterator<T, true>;
+  using iterator_pointer = T *;
+
+  static constexpr size_type inline_capacity = N;
+
+  small_vector();
+  explicit small_vector(const allocator_type &alloc);
+  explicit small_vector(size_type n,
+                        const allocator_type &alloc = allocator_type());
+  small_vector(std::initializer_list<T> const &items,
+               const allocator_type &alloc = allocator_type());
+  small_vector(const small_vector &other);
+  small_vector(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~small_vector();
+  small_vector &operator=(small_vector &&other);
+
+  allocator_type get_allocator() const;
+
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+  iterator_pointer data() noexcept;
+  const T *data() const noexcept;
+
+  iterator begin();
+  iterator end();
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  bool is_inline() const noexcept;
+
+  void clear() noexcept;
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator erase(iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  void assign(InputIt first, InputIt last);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void pop_back();
+  void swap(small_vector &other);
+
+  template <class... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+  template <class... Args>
+  void insert_many_back(Args &&...args);
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+
+  template <typename Pred>
+  size_type erase_if(Pred pred);
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using ops = detail::vector_ops<T, Allocator>;
+
+  iterator_pointer inline_data() noexcept;
+  void release_storage() noexcept;
+  void take_from(small_vector &other);
+
+  template <class... Args>
+  void construct(iterator_pointer p, Args &&...args);
+  void reallocate(size_type new_capacity);
+  template <class... Args>
+  void emplace_reallocate(size_type index, Args &&...args);
+  size_type grown_capacity(size_type count) const;
+  size_type open_gap(size_type index, size_type count);
+
+  iterator_pointer data_;
+  size_type size_;
+  size_type capacity_;
+  allocator_type alloc_;
+  alignas(T) unsigned char inline_[N * sizeof(T)];
+};
+
+template <typename T, std::size_t N, typename Allocator, typename Pred>
+typename small_vector<T, N, Allocator>::size_type erase_if(
+    small_vector<T, N, Allocator> &v, Pred pred) {
+  return v.erase_if(pred);
+}
+}  // namespace s21
+
+#include "s21_small_vector.tpp"
+
+#endif  // _S21_SMALL_VECTOR_H_
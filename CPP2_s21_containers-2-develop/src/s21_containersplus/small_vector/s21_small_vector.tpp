@@ -0,0 +1,562 @@
+namespace s21 {
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector()
+    : data_(inline_data()), size_(0U), capacity_(N), alloc_() {}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(const allocator_type &alloc)
+    : data_(inline_data()), size_(0U), capacity_(N), alloc_(alloc) {}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(size_type n,
+                                            const allocator_type &alloc)
+    : small_vector(alloc) {
+  reserve(n);
+  for (; size_ < n; ++size_) construct(data_ + size_);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(
+    std::initializer_list<T> const &items, const allocator_type &alloc)
+    : small_vector(alloc) {
+  reserve(items.size());
+  ops::construct_range(alloc_, items.begin(), items.size(), data_);
+  size_ = items.size();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(const small_vector &other)
+    : small_vector(
+          alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+  reserve(other.size_);
+  ops::construct_range(alloc_, other.data_, other.size_, data_);
+  size_ = other.size_;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(small_vector &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : small_vector(other.alloc_) {
+  take_from(other);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::~small_vector() {
+  release_storage();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(
+    small_vector &&other) {
+  if (this != &other) {
+    release_storage();
+    if (!other.is_inline() &&
+        !alloc_traits::propagate_on_container_move_assignment::value &&
+        !(alloc_ == other.alloc_)) {
+      // чужой буфер забрать нельзя — переносим элементы
+      reserve(other.size_);
+      ops::construct_range(alloc_, std::make_move_iterator(other.data_),
+                           other.size_, data_);
+      size_ = other.size_;
+      other.clear();
+      return *this;
+    }
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+      alloc_ = std::move(other.alloc_);
+    take_from(other);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::allocator_type
+small_vector<T, N, Allocator>::get_allocator() const {
+  return alloc_;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::reference
+small_vector<T, N, Allocator>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return data_[pos];
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::reference
+small_vector<T, N, Allocator>::operator[](size_type pos) {
+  S21_CHECK(pos < size_, "Index out of range");
+  return data_[pos];
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::const_reference
+small_vector<T, N, Allocator>::operator[](size_type pos) const {
+  S21_CHECK(pos < size_, "Index out of range");
+  return data_[pos];
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::const_reference
+small_vector<T, N, Allocator>::front() const {
+  if (empty()) {
+    throw std::out_of_range("FrontError: small_vector is empty");
+  }
+  return data_[0U];
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::const_reference
+small_vector<T, N, Allocator>::back() const {
+  if (empty()) {
+    throw std::out_of_range("BackError: small_vector is empty");
+  }
+  return data_[size_ - 1];
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::iterator_pointer
+small_vector<T, N, Allocator>::data() noexcept {
+  return data_;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+const T *small_vector<T, N, Allocator>::data() const noexcept {
+  return data_;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::begin() {
+  return iterator(data_, data_, data_ + size_);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::end() {
+  return iterator(data_ + size_, data_, data_ + size_);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::const_iterator
+small_vector<T, N, Allocator>::cbegin() const {
+  return const_iterator(data_, data_, data_ + size_);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::const_iterator
+small_vector<T, N, Allocator>::cend() const {
+  return const_iterator(data_ + size_, data_, data_ + size_);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+bool small_vector<T, N, Allocator>::empty() const {
+  return size_ == 0U;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::size() const {
+  return size_;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::max_size() const {
+  return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::reserve(size_type new_capacity) {
+  if (new_capacity <= capacity_) return;
+  if (new_capacity > max_size()) {
+    throw std::out_of_range("ReserveError: new capacity exceeds max_size");
+  }
+  reallocate(new_capacity);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::capacity() const {
+  return capacity_;
+}
+
+// Возвращает элементы во встроенный буфер, если они в нём помещаются.
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::shrink_to_fit() {
+  if (!is_inline() && size_ < capacity_) reallocate(std::max(size_, N));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+bool small_vector<T, N, Allocator>::is_inline() const noexcept {
+  return data_ == reinterpret_cast<const T *>(inline_);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::clear() noexcept {
+  ops::destroy(alloc_, data_, data_ + size_);
+  size_ = 0U;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::insert(iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::insert(iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::insert(const_iterator pos, size_type count,
+                                      const_reference value) {
+  size_type index = pos - cbegin();
+  if (index > size_) {
+    throw std::out_of_range("InsertError: Index out of range");
+  }
+  if (count == 0U) return begin() + index;
+
+  // value может ссылаться на элемент этого же контейнера
+  value_type item(value);
+  size_type assigned = open_gap(index, count);
+  ops::fill_gap(alloc_, data_, size_, index, count, assigned,
+                [&item, count](auto &put) {
+                  for (size_type i = 0; i < count; ++i) put(item);
+                });
+  return begin() + index;
+}
+
+// Как vector::insert: forward-диапазон сдвигает хвост один раз,
+// однопроходный дописывается в конец и поворачивается на место.
+template <typename T, std::size_t N, typename Allocator>
+template <typename InputIt, typename>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::insert(const_iterator pos, InputIt first,
+                                      InputIt last) {
+  size_type index = pos - cbegin();
+  if (index > size_) {
+    throw std::out_of_range("InsertError: Index out of range");
+  }
+
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_convertible_v<category, std::forward_iterator_tag>) {
+    size_type count = std::distance(first, last);
+    if (count == 0U) return begin() + index;
+    size_type assigned = open_gap(index, count);
+    ops::fill_gap(alloc_, data_, size_, index, count, assigned,
+                  [&first, count](auto &put) {
+                    for (size_type i = 0; i < count; ++i, ++first) put(*first);
+                  });
+  } else {
+    size_type old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(data_ + index, data_ + old_size, data_ + size_);
+  }
+  return begin() + index;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::erase(iterator pos) {
+  size_type index = pos - iterator(data_);
+  if (index >= size_) {
+    throw std::out_of_range("Index out ot range");
+  }
+  return erase(pos, pos + 1);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::erase(const_iterator first,
+                                     const_iterator last) {
+  size_type index = first - cbegin();
+  size_type stop = last - cbegin();
+  if (index > stop || stop > size_) {
+    throw std::out_of_range("EraseError: invalid range");
+  }
+  size_type count = stop - index;
+  if (count == 0U) return begin() + index;
+
+  if constexpr (is_trivially_relocatable<T>::value) {
+    ops::destroy(alloc_, data_ + index, data_ + stop);
+    std::memmove(static_cast<void *>(data_ + index),
+                 static_cast<const void *>(data_ + stop),
+                 (size_ - stop) * sizeof(T));
+  } else {
+    std::move(data_ + stop, data_ + size_, data_ + index);
+    ops::destroy(alloc_, data_ + size_ - count, data_ + size_);
+  }
+  size_ -= count;
+  return begin() + index;
+}
+
+// Диапазон, не помещающийся в текущий буфер, строится в новой куче до
+// освобождения старых элементов: при исключении контейнер не меняется.
+template <typename T, std::size_t N, typename Allocator>
+template <typename InputIt, typename>
+void small_vector<T, N, Allocator>::assign(InputIt first, InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_convertible_v<category, std::forward_iterator_tag>) {
+    size_type count = std::distance(first, last);
+    if (count > capacity_) {
+      if (count > max_size()) {
+        throw std::length_error("AssignError: range exceeds max_size");
+      }
+      iterator_pointer new_data = alloc_traits::allocate(alloc_, count);
+      try {
+        ops::construct_range(alloc_, first, count, new_data);
+      } catch (...) {
+        alloc_traits::deallocate(alloc_, new_data, count);
+        throw;
+      }
+      release_storage();
+      data_ = new_data;
+      size_ = count;
+      capacity_ = count;
+    } else if (count > size_) {
+      InputIt middle = std::next(first, size_);
+      std::copy(first, middle, data_);
+      ops::construct_range(alloc_, middle, count - size_, data_ + size_);
+      size_ = count;
+    } else {
+      std::copy(first, last, data_);
+      ops::destroy(alloc_, data_ + count, data_ + size_);
+      size_ = count;
+    }
+  } else {
+    clear();
+    for (; first != last; ++first) emplace_back(*first);
+  }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::pop_back() {
+  if (size_ > 0U) {
+    --size_;
+    ops::destroy(alloc_, data_ + size_, data_ + size_ + 1);
+  }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::swap(small_vector &other) {
+  if (this == &other) return;
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    if constexpr (alloc_traits::propagate_on_container_swap::value)
+      std::swap(alloc_, other.alloc_);
+    return;
+  }
+  small_vector temp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(temp);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <class... Args>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::insert_many(const_iterator pos,
+                                           Args &&...args) {
+  size_type index = pos - cbegin();
+  size_type count = sizeof...(args);
+  if (count == 0U) return begin() + index;
+
+  size_type assigned = open_gap(index, count);
+  ops::fill_gap(alloc_, data_, size_, index, count, assigned,
+                [&](auto &put) { (put(std::forward<Args>(args)), ...); });
+  return begin() + index;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <class... Args>
+void small_vector<T, N, Allocator>::insert_many_back(Args &&...args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <class... Args>
+typename small_vector<T, N, Allocator>::iterator
+small_vector<T, N, Allocator>::emplace(const_iterator pos, Args &&...args) {
+  size_type index = pos - cbegin();
+  if (index > size_) {
+    throw std::out_of_range("Index out ot range");
+  }
+
+  if (size_ == capacity_) {
+    emplace_reallocate(index, std::forward<Args>(args)...);
+  } else if (index == size_) {
+    construct(data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  } else {
+    // аргументы могут ссылаться на сдвигаемые элементы
+    value_type item(std::forward<Args>(args)...);
+    if (open_gap(index, 1U) != 0U)
+      data_[index] = std::move(item);
+    else
+      construct(data_ + index, std::move(item));
+    ++size_;
+  }
+  return begin() + index;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <class... Args>
+typename small_vector<T, N, Allocator>::reference
+small_vector<T, N, Allocator>::emplace_back(Args &&...args) {
+  if (size_ == capacity_) {
+    emplace_reallocate(size_, std::forward<Args>(args)...);
+  } else {
+    construct(data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  }
+  return data_[size_ - 1];
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <typename Pred>
+typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::erase_if(Pred pred) {
+  size_type kept = 0U;
+  for (size_type i = 0U; i < size_; ++i) {
+    if (!pred(static_cast<const_reference>(data_[i]))) {
+      if (kept != i) data_[kept] = std::move(data_[i]);
+      ++kept;
+    }
+  }
+  size_type removed = size_ - kept;
+  ops::destroy(alloc_, data_ + kept, data_ + size_);
+  size_ = kept;
+  return removed;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::iterator_pointer
+small_vector<T, N, Allocator>::inline_data() noexcept {
+  return reinterpret_cast<T *>(inline_);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::release_storage() noexcept {
+  ops::destroy(alloc_, data_, data_ + size_);
+  if (!is_inline()) alloc_traits::deallocate(alloc_, data_, capacity_);
+  data_ = inline_data();
+  size_ = 0U;
+  capacity_ = N;
+}
+
+// *this пуст и во встроенном буфере. Кучу other забираем целиком,
+// встроенные элементы переносим поштучно.
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::take_from(small_vector &other) {
+  if (other.is_inline()) {
+    ops::relocate(alloc_, other.data_, other.size_, data_);
+    ops::destroy_relocated(other.alloc_, other.data_,
+                           other.data_ + other.size_);
+    size_ = other.size_;
+    other.size_ = 0U;
+  } else {
+    data_ = other.data_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    other.data_ = other.inline_data();
+    other.size_ = 0U;
+    other.capacity_ = N;
+  }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <class... Args>
+void small_vector<T, N, Allocator>::construct(iterator_pointer p,
+                                              Args &&...args) {
+  alloc_traits::construct(alloc_, p, std::forward<Args>(args)...);
+}
+
+// new_capacity не больше N означает возврат во встроенный буфер.
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::reallocate(size_type new_capacity) {
+  bool to_inline = new_capacity <= N;
+  iterator_pointer new_data =
+      to_inline ? inline_data() : alloc_traits::allocate(alloc_, new_capacity);
+  try {
+    ops::relocate(alloc_, data_, size_, new_data);
+  } catch (...) {
+    if (!to_inline) alloc_traits::deallocate(alloc_, new_data, new_capacity);
+    throw;
+  }
+  ops::destroy_relocated(alloc_, data_, data_ + size_);
+  if (!is_inline()) alloc_traits::deallocate(alloc_, data_, capacity_);
+  data_ = new_data;
+  capacity_ = to_inline ? N : new_capacity;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <class... Args>
+void small_vector<T, N, Allocator>::emplace_reallocate(size_type index,
+                                                       Args &&...args) {
+  size_type new_capacity = grown_capacity(1U);
+  iterator_pointer new_data = alloc_traits::allocate(alloc_, new_capacity);
+  try {
+    construct(new_data + index, std::forward<Args>(args)...);
+  } catch (...) {
+    alloc_traits::deallocate(alloc_, new_data, new_capacity);
+    throw;
+  }
+  try {
+    ops::relocate_around(alloc_, data_, size_, index, 1U, new_data);
+  } catch (...) {
+    ops::destroy(alloc_, new_data + index, new_data + index + 1);
+    alloc_traits::deallocate(alloc_, new_data, new_capacity);
+    throw;
+  }
+  ops::destroy_relocated(alloc_, data_, data_ + size_);
+  if (!is_inline()) alloc_traits::deallocate(alloc_, data_, capacity_);
+  data_ = new_data;
+  capacity_ = new_capacity;
+  ++size_;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::grown_capacity(size_type count) const {
+  return ops::grown_capacity(size_, capacity_, max_size(), count,
+                             "s21::small_vector exceeds max_size()");
+}
+
+// Как vector::open_gap: при росте хвост сразу ложится за разрывом в новом
+// буфере, иначе сдвигается на месте.
+template <typename T, std::size_t N, typename Allocator>
+typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::open_gap(size_type index, size_type count) {
+  if (size_ + count <= capacity_)
+    return ops::shift_tail(alloc_, data_, size_, index, count);
+  size_type new_capacity = grown_capacity(count);
+  iterator_pointer new_data = alloc_traits::allocate(alloc_, new_capacity);
+  try {
+    ops::relocate_around(alloc_, data_, size_, index, count, new_data);
+  } catch (...) {
+    alloc_traits::deallocate(alloc_, new_data, new_capacity);
+    throw;
+  }
+  ops::destroy_relocated(alloc_, data_, data_ + size_);
+  if (!is_inline()) alloc_traits::deallocate(alloc_, data_, capacity_);
+  data_ = new_data;
+  capacity_ = new_capacity;
+  return 0U;
+}
+}  // namespace s21
@@ -0,0 +1,250 @@
+#ifndef _S21_SOA_VECTOR_H_
+#define _S21_SOA_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/s21_checked.h"
+
+namespace s21 {
+// Непрерывный участок одного столбца soa_vector: указатель и длина.
+// Итераторы — обычные указатели, так что столбец можно отдавать
+// std-алгоритмам и s21::simd как есть.
+template <typename T>
+class soa_column {
+ public:
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using iterator = T *;
+
+  soa_column() noexcept = default;
+  soa_column(T *data, size_type size) noexcept : data_(data), size_(size) {}
+
+  T *data() const noexcept { return data_; }
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0U; }
+  T &operator[](size_type pos) const {
+    S21_CHECK(pos < size_, "Index out of range");
+    return data_[pos];
+  }
+  iterator begin() const noexcept { return data_; }
+  iterator end() const noexcept { return data_ + size_; }
+
+ private:
+  T *data_ = nullptr;
+  size_type size_ = 0;
+};
+
+// Итератор по строкам soa_vector. Строка собирается на лету как кортеж
+// ссылок на поля, поэтому работает structured binding
+// (auto [x, v] = *it), но не std::sort: переставлять строки через прокси
+// стандартные алгоритмы не умеют.
+template <typename Vector, bool Const>
+class soaIterator {
+ public:
+  using value_type = typename Vector::value_type;
+  using reference = std::conditional_t<Const, typename Vector::const_reference,
+                                       typename Vector::reference>;
+  using pointer = void;
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using owner_pointer = std::conditional_t<Const, const Vector *, Vector *>;
+
+  soaIterator() = default;
+  soaIterator(owner_pointer owner, std::size_t index)
+      : owner_(owner), index_(index) {}
+  template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+  soaIterator(const soaIterator<Vector, OtherConst> &other)
+      : owner_(other.owner_), index_(other.index_) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+  reference operator[](difference_type n) const {
+    return (*owner_)[index_ + n];
+  }
+  std::size_t index() const noexcept { return index_; }
+
+  soaIterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+  soaIterator &operator-=(difference_type n) { return *this += -n; }
+  soaIterator &operator++() { return *this += 1; }
+  soaIterator &operator--() { return *this += -1; }
+  soaIterator operator++(int) {
+    soaIterator temp(*this);
+    ++*this;
+    return temp;
+  }
+  soaIterator operator--(int) {
+    soaIterator temp(*this);
+    --*this;
+    return temp;
+  }
+  soaIterator operator+(difference_type n) const {
+    soaIterator temp(*this);
+    return temp += n;
+  }
+  soaIterator operator-(difference_type n) const {
+    soaIterator temp(*this);
+    return temp -= n;
+  }
+  friend soaIterator operator+(difference_type n, const soaIterator &it) {
+    return it + n;
+  }
+  difference_type operator-(const soaIterator &other) const {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  bool operator==(const soaIterator &other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const soaIterator &other) const {
+    return index_ != other.index_;
+  }
+  bool operator<(const soaIterator &other) const {
+    return index_ < other.index_;
+  }
+  bool operator>(const soaIterator &other) const {
+    return index_ > other.index_;
+  }
+  bool operator<=(const soaIterator &other) const {
+    return index_ <= other.index_;
+  }
+  bool operator>=(const soaIterator &other) const {
+    return index_ >= other.index_;
+  }
+
+ private:
+  template <typename, bool>
+  friend class soaIterator;
+
+  owner_pointer owner_ = nullptr;
+  std::size_t index_ = 0;
+};
+
+// Structure of arrays: каждое поле строки хранится в своём непрерывном
+// столбце, выровненном на 64 байта. Проход по одному полю читает только
+// его байты и векторизуется как цикл по обычному массиву:
+//
+//   s21::soa_vector<float, float, int> particles;  // x, vx, id
+//   particles.push_back(0.0f, 1.5f, 7);
+//   for (float &x : particles.column<0>()) x += dt;
+//
+// Все столбцы растут вместе; строка доступна как кортеж ссылок через
+// operator[] и итераторы.
+template <typename... Fields>
+class soa_vector {
+  static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+  static_assert((std::is_nothrow_move_constructible_v<Fields> && ...),
+                "soa_vector relocates columns with noexcept moves");
+
+ public:
+  using value_type = std::tuple<Fields...>;
+  using size_type = std::size_t;
+  using reference = std::tuple<Fields &...>;
+  using const_reference = std::tuple<const Fields &...>;
+  using iterator = soaIterator<soa_vector, false>;
+  using const_iterator = soaIterator<soa_vector, true>;
+  template <std::size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  static constexpr size_type column_count = sizeof...(Fields);
+  static constexpr std::size_t column_alignment = 64;
+
+  soa_vector() noexcept = default;
+  explicit soa_vector(size_type n);
+  soa_vector(std::initializer_list<value_type> const &rows);
+  soa_vector(const soa_vector &other);
+  soa_vector(soa_vector &&other) noexcept;
+  ~soa_vector();
+  soa_vector &operator=(const soa_vector &other);
+  soa_vector &operator=(soa_vector &&other) noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  template <std::size_t I>
+  field_type<I> *data() noexcept;
+  template <std::size_t I>
+  const field_type<I> *data() const noexcept;
+  template <std::size_t I>
+  soa_column<field_type<I>> column() noexcept;
+  template <std::size_t I>
+  soa_column<const field_type<I>> column() const noexcept;
+
+  iterator begin() noexcept { return iterator(this, 0U); }
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0U); }
+  const_iterator cend() const noexcept { return const_iterator(this, size_); }
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void push_back(const Fields &...values);
+  void push_back(const value_type &row);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  void resize(size_type count);
+  void swap(soa_vector &other) noexcept;
+
+ private:
+  using columns = std::tuple<Fields *...>;
+
+  template <std::size_t I>
+  static constexpr std::size_t alignment_of =
+      std::max(column_alignment, alignof(field_type<I>));
+
+  template <typename Fn>
+  static void for_each_index(Fn &&fn);
+  template <typename Fn, std::size_t... I>
+  static void for_each_index(Fn &fn, std::index_sequence<I...>);
+  template <std::size_t I>
+  static field_type<I> *allocate(size_type n);
+  template <std::size_t I>
+  static void deallocate(field_type<I> *p) noexcept;
+
+  template <class... Args>
+  void construct_row(size_type row, Args &&...args);
+  template <std::size_t... I, class... Args>
+  void construct_fields(std::index_sequence<I...>, size_type row,
+                        Args &&...args);
+  void destroy_rows(size_type first, size_type last) noexcept;
+  void release() noexcept;
+  void reallocate(size_type new_capacity);
+  size_type grown_capacity(size_type count) const;
+
+  columns columns_{};
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+};
+}  // namespace s21
+
+#include "s21_soa_vector.tpp"
+
+#endif  // _S21_SOA_VECTOR_H_
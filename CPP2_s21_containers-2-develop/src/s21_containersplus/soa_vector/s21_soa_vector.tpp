@@ -0,0 +1,410 @@
+namespace s21 {
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(size_type n) {
+  try {
+    resize(n);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(
+    std::initializer_list<value_type> const &rows) {
+  try {
+    reserve(rows.size());
+    for (const value_type &row : rows) push_back(row);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(const soa_vector &other) {
+  try {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) {
+      std::apply([&](const auto &...fields) { construct_row(i, fields...); },
+                 other[i]);
+      ++size_;
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(soa_vector &&other) noexcept {
+  swap(other);
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::~soa_vector() {
+  release();
+}
+
+template <typename... Fields>
+soa_vector<Fields...> &soa_vector<Fields...>::operator=(
+    const soa_vector &other) {
+  if (this != &other) {
+    soa_vector copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename... Fields>
+soa_vector<Fields...> &soa_vector<Fields...>::operator=(
+    soa_vector &&other) noexcept {
+  if (this != &other) {
+    release();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::at(
+    size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return (*this)[pos];
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::at(
+    size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return (*this)[pos];
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::operator[](
+    size_type pos) {
+  S21_CHECK(pos < size_, "Index out of range");
+  return std::apply(
+      [pos](Fields *...column) { return reference(column[pos]...); },
+      columns_);
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_reference
+soa_vector<Fields...>::operator[](size_type pos) const {
+  S21_CHECK(pos < size_, "Index out of range");
+  return std::apply(
+      [pos](Fields *...column) { return const_reference(column[pos]...); },
+      columns_);
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::front() {
+  if (empty()) {
+    throw std::out_of_range("FrontError: soa_vector is empty");
+  }
+  return (*this)[0U];
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::front()
+    const {
+  if (empty()) {
+    throw std::out_of_range("FrontError: soa_vector is empty");
+  }
+  return (*this)[0U];
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::back() {
+  if (empty()) {
+    throw std::out_of_range("BackError: soa_vector is empty");
+  }
+  return (*this)[size_ - 1];
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::back()
+    const {
+  if (empty()) {
+    throw std::out_of_range("BackError: soa_vector is empty");
+  }
+  return (*this)[size_ - 1];
+}
+
+template <typename... Fields>
+template <std::size_t I>
+typename soa_vector<Fields...>::template field_type<I> *
+soa_vector<Fields...>::data() noexcept {
+  return std::get<I>(columns_);
+}
+
+template <typename... Fields>
+template <std::size_t I>
+const typename soa_vector<Fields...>::template field_type<I> *
+soa_vector<Fields...>::data() const noexcept {
+  return std::get<I>(columns_);
+}
+
+template <typename... Fields>
+template <std::size_t I>
+soa_column<typename soa_vector<Fields...>::template field_type<I>>
+soa_vector<Fields...>::column() noexcept {
+  return {std::get<I>(columns_), size_};
+}
+
+template <typename... Fields>
+template <std::size_t I>
+soa_column<const typename soa_vector<Fields...>::template field_type<I>>
+soa_vector<Fields...>::column() const noexcept {
+  return {std::get<I>(columns_), size_};
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::size_type soa_vector<Fields...>::max_size()
+    const noexcept {
+  return std::numeric_limits<size_type>::max() / (sizeof(Fields) + ...);
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("ReserveError: new capacity exceeds max_size");
+  }
+  if (size > capacity_) reallocate(size);
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::shrink_to_fit() {
+  if (capacity_ > size_) reallocate(size_);
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::clear() noexcept {
+  destroy_rows(0U, size_);
+  size_ = 0U;
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::push_back(const Fields &...values) {
+  emplace_back(values...);
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::push_back(const value_type &row) {
+  std::apply([this](const Fields &...values) { emplace_back(values...); },
+             row);
+}
+
+template <typename... Fields>
+template <class... Args>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::emplace_back(
+    Args &&...args) {
+  static_assert(sizeof...(Args) == sizeof...(Fields),
+                "emplace_back takes one argument per field");
+  if (size_ == capacity_) {
+    // аргументы могут ссылаться на собственные столбцы: сначала копия
+    value_type row(std::forward<Args>(args)...);
+    reallocate(grown_capacity(size_ + 1));
+    std::apply([this](Fields &...fields) {
+      construct_row(size_, std::move(fields)...);
+    }, row);
+  } else {
+    construct_row(size_, std::forward<Args>(args)...);
+  }
+  ++size_;
+  return back();
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::pop_back() {
+  if (size_ > 0U) {
+    --size_;
+    destroy_rows(size_, size_ + 1);
+  }
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::iterator soa_vector<Fields...>::erase(
+    const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::iterator soa_vector<Fields...>::erase(
+    const_iterator first, const_iterator last) {
+  const size_type from = first.index();
+  const size_type to = last.index();
+  if (from > to || to > size_) {
+    throw std::out_of_range("EraseError: invalid range");
+  }
+  if (from != to) {
+    for_each_index([&](auto index) {
+      constexpr std::size_t I = decltype(index)::value;
+      field_type<I> *column = std::get<I>(columns_);
+      std::move(column + to, column + size_, column + from);
+    });
+    destroy_rows(size_ - (to - from), size_);
+    size_ -= to - from;
+  }
+  return iterator(this, from);
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::resize(size_type count) {
+  if (count <= size_) {
+    destroy_rows(count, size_);
+    size_ = count;
+    return;
+  }
+  if (count > capacity_) reallocate(grown_capacity(count));
+  std::size_t done = 0;
+  try {
+    for_each_index([&](auto index) {
+      constexpr std::size_t I = decltype(index)::value;
+      field_type<I> *column = std::get<I>(columns_);
+      std::uninitialized_value_construct(column + size_, column + count);
+      ++done;
+    });
+  } catch (...) {
+    for_each_index([&](auto index) {
+      constexpr std::size_t I = decltype(index)::value;
+      field_type<I> *column = std::get<I>(columns_);
+      if (I < done) std::destroy(column + size_, column + count);
+    });
+    throw;
+  }
+  size_ = count;
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::swap(soa_vector &other) noexcept {
+  std::swap(columns_, other.columns_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+// fn(std::integral_constant<std::size_t, I>) для каждого столбца I.
+template <typename... Fields>
+template <typename Fn>
+void soa_vector<Fields...>::for_each_index(Fn &&fn) {
+  for_each_index(fn, std::index_sequence_for<Fields...>());
+}
+
+template <typename... Fields>
+template <typename Fn, std::size_t... I>
+void soa_vector<Fields...>::for_each_index(Fn &fn, std::index_sequence<I...>) {
+  (fn(std::integral_constant<std::size_t, I>{}), ...);
+}
+
+template <typename... Fields>
+template <std::size_t I>
+typename soa_vector<Fields...>::template field_type<I> *
+soa_vector<Fields...>::allocate(size_type n) {
+  if (n == 0U) return nullptr;
+  void *p = ::operator new(n * sizeof(field_type<I>),
+                           std::align_val_t(alignment_of<I>));
+  return static_cast<field_type<I> *>(p);
+}
+
+template <typename... Fields>
+template <std::size_t I>
+void soa_vector<Fields...>::deallocate(field_type<I> *p) noexcept {
+  if (p != nullptr) ::operator delete(p, std::align_val_t(alignment_of<I>));
+}
+
+template <typename... Fields>
+template <class... Args>
+void soa_vector<Fields...>::construct_row(size_type row, Args &&...args) {
+  construct_fields(std::index_sequence_for<Fields...>(), row,
+                   std::forward<Args>(args)...);
+}
+
+// Поля строки создаются по порядку; если конструктор поля бросил, уже
+// созданные поля этой строки разрушаются.
+template <typename... Fields>
+template <std::size_t... I, class... Args>
+void soa_vector<Fields...>::construct_fields(std::index_sequence<I...>,
+                                             size_type row, Args &&...args) {
+  std::size_t done = 0;
+  try {
+    ((::new (static_cast<void *>(std::get<I>(columns_) + row))
+          field_type<I>(std::forward<Args>(args)),
+      ++done),
+     ...);
+  } catch (...) {
+    for_each_index([&](auto index) {
+      constexpr std::size_t J = decltype(index)::value;
+      if (J < done) std::destroy_at(std::get<J>(columns_) + row);
+    });
+    throw;
+  }
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::destroy_rows(size_type first,
+                                         size_type last) noexcept {
+  for_each_index([&](auto index) {
+    constexpr std::size_t I = decltype(index)::value;
+    field_type<I> *column = std::get<I>(columns_);
+    std::destroy(column + first, column + last);
+  });
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::release() noexcept {
+  destroy_rows(0U, size_);
+  for_each_index([&](auto index) {
+    constexpr std::size_t I = decltype(index)::value;
+    deallocate<I>(std::get<I>(columns_));
+  });
+  columns_ = columns{};
+  size_ = 0U;
+  capacity_ = 0U;
+}
+
+// Сначала выделяются все новые столбцы, потом элементы переносятся
+// noexcept-перемещением: нехватка памяти не трогает старое содержимое.
+template <typename... Fields>
+void soa_vector<Fields...>::reallocate(size_type new_capacity) {
+  columns fresh{};
+  std::size_t allocated = 0;
+  try {
+    for_each_index([&](auto index) {
+      constexpr std::size_t I = decltype(index)::value;
+      std::get<I>(fresh) = allocate<I>(new_capacity);
+      ++allocated;
+    });
+  } catch (...) {
+    for_each_index([&](auto index) {
+      constexpr std::size_t I = decltype(index)::value;
+      if (I < allocated) deallocate<I>(std::get<I>(fresh));
+    });
+    throw;
+  }
+  for_each_index([&](auto index) {
+    constexpr std::size_t I = decltype(index)::value;
+    field_type<I> *old = std::get<I>(columns_);
+    std::uninitialized_move(old, old + size_, std::get<I>(fresh));
+    std::destroy(old, old + size_);
+    deallocate<I>(old);
+  });
+  columns_ = fresh;
+  capacity_ = new_capacity;
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::size_type
+soa_vector<Fields...>::grown_capacity(size_type count) const {
+  if (count > max_size()) {
+    throw std::length_error("s21::soa_vector exceeds max_size()");
+  }
+  size_type doubled =
+      capacity_ < max_size() / 2 ? capacity_ * 2 : max_size();
+  return std::max(count, doubled);
+}
+}  // namespace s21
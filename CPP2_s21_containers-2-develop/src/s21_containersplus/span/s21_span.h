@@ -0,0 +1,300 @@
+#ifndef _S21_SPAN_H_
+#define _S21_SPAN_H_
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../../s21_containers/s21_checked.h"
+#include "../array/s21_array.h"
+
+namespace s21 {
+inline constexpr std::size_t dynamic_extent =
+    std::numeric_limits<std::size_t>::max();
+
+template <typename T, std::size_t Extent = dynamic_extent>
+class span;
+
+namespace detail {
+template <typename T>
+struct is_span : std::false_type {};
+template <typename T, std::size_t Extent>
+struct is_span<span<T, Extent>> : std::true_type {};
+
+template <typename T>
+struct is_s21_array : std::false_type {};
+template <typename T, std::size_t N, std::size_t Alignment>
+struct is_s21_array<array<T, N, Alignment>> : std::true_type {};
+
+// Непрерывный контейнер, чьи элементы можно видеть как T: есть data() и
+// size(), а U(*)[] приводится к T(*)[] (так отсекаются производные типы
+// и снятие const).
+template <typename Container, typename T, typename = void>
+struct is_compatible_container : std::false_type {};
+template <typename Container, typename T>
+struct is_compatible_container<
+    Container, T,
+    std::void_t<decltype(std::declval<Container &>().data()),
+                decltype(std::declval<Container &>().size())>>
+    : std::bool_constant<
+          !is_span<std::remove_cv_t<Container>>::value &&
+          !is_s21_array<std::remove_cv_t<Container>>::value &&
+          !std::is_array_v<Container> &&
+          std::is_convertible_v<
+              std::remove_pointer_t<
+                  decltype(std::declval<Container &>().data())> (*)[],
+              T (*)[]>> {};
+
+// У span с фиксированным размером он не хранится: пустая база
+// схлопывается, и span<T, N> занимает один указатель.
+template <std::size_t Extent>
+class span_size {
+ public:
+  constexpr explicit span_size(std::size_t) noexcept {}
+  constexpr std::size_t size() const noexcept { return Extent; }
+};
+
+template <>
+class span_size<dynamic_extent> {
+ public:
+  constexpr explicit span_size(std::size_t size) noexcept : size_(size) {}
+  constexpr std::size_t size() const noexcept { return size_; }
+
+ private:
+  std::size_t size_;
+};
+}  // namespace detail
+
+// Non-owning view of a contiguous range: a pointer and a size, copied by
+// value. A function taking s21::span<const T> accepts an s21::vector,
+// s21::array, small_vector, mmap_vector, soa_vector column, C array or
+// any sub-range of them without copying:
+//
+//   double mean(s21::span<const double> xs);
+//   mean(samples);                          // s21::vector<double>
+//   mean(s21::span(samples).subspan(8, 64));
+//
+// Extent fixes the size at compile time (span<float, 8>); the default
+// dynamic_extent keeps it at run time. The viewed elements must outlive
+// the span, and growing the owning container invalidates it.
+template <typename T, std::size_t Extent>
+class span : private detail::span_size<Extent> {
+  using size_base = detail::span_size<Extent>;
+
+  template <typename U>
+  static constexpr bool convertible_from = std::is_convertible_v<U (*)[],
+                                                                 T (*)[]>;
+
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+
+  static constexpr size_type extent = Extent;
+
+  template <std::size_t E = Extent,
+            typename = std::enable_if_t<E == 0 || E == dynamic_extent>>
+  constexpr span() noexcept : size_base(0) {}
+  constexpr span(pointer first, size_type count)
+      : size_base(count), data_(first) {
+    S21_CHECK(Extent == dynamic_extent || count == Extent,
+              "span size does not match its extent");
+  }
+  // Шаблон, как у std::span: иначе span(p, 0) неоднозначен — 0 подходит
+  // и как размер, и как нулевой указатель.
+  template <typename End,
+            typename = std::enable_if_t<std::is_convertible_v<End, pointer> &&
+                                        !std::is_convertible_v<End, size_type>>>
+  constexpr span(pointer first, End last)
+      : span(first,
+             static_cast<size_type>(static_cast<pointer>(last) - first)) {}
+  template <std::size_t N, typename = std::enable_if_t<
+                               Extent == dynamic_extent || N == Extent>>
+  constexpr span(element_type (&items)[N]) noexcept
+      : size_base(N), data_(items) {}
+  template <typename U, std::size_t N, std::size_t Alignment,
+            typename = std::enable_if_t<(Extent == dynamic_extent ||
+                                         N == Extent) &&
+                                        convertible_from<U>>>
+  constexpr span(array<U, N, Alignment> &items) noexcept
+      : size_base(N), data_(items.data()) {}
+  template <typename U, std::size_t N, std::size_t Alignment,
+            typename = std::enable_if_t<(Extent == dynamic_extent ||
+                                         N == Extent) &&
+                                        convertible_from<const U>>>
+  constexpr span(const array<U, N, Alignment> &items) noexcept
+      : size_base(N), data_(items.data()) {}
+  template <typename U, std::size_t N,
+            typename = std::enable_if_t<(Extent == dynamic_extent ||
+                                         N == Extent) &&
+                                        convertible_from<U>>>
+  constexpr span(std::array<U, N> &items) noexcept
+      : size_base(N), data_(items.data()) {}
+  template <typename U, std::size_t N,
+            typename = std::enable_if_t<(Extent == dynamic_extent ||
+                                         N == Extent) &&
+                                        convertible_from<const U>>>
+  constexpr span(const std::array<U, N> &items) noexcept
+      : size_base(N), data_(items.data()) {}
+  // Контейнеры с размером во время выполнения; для span с фиксированным
+  // размером его совпадение проверяет S21_CHECK.
+  template <typename Container,
+            typename = std::enable_if_t<
+                detail::is_compatible_container<Container, T>::value>>
+  constexpr span(Container &items) : span(items.data(), items.size()) {}
+  template <typename Container,
+            typename = std::enable_if_t<
+                detail::is_compatible_container<const Container, T>::value>>
+  constexpr span(const Container &items) : span(items.data(), items.size()) {}
+  template <typename U, std::size_t N,
+            typename = std::enable_if_t<(Extent == dynamic_extent ||
+                                         N == Extent) &&
+                                        convertible_from<U>>>
+  constexpr span(const span<U, N> &other) noexcept
+      : size_base(other.size()), data_(other.data()) {}
+  constexpr span(const span &other) noexcept = default;
+  constexpr span &operator=(const span &other) noexcept = default;
+
+  constexpr pointer data() const noexcept { return data_; }
+  constexpr size_type size() const noexcept { return size_base::size(); }
+  constexpr size_type size_bytes() const noexcept {
+    return size() * sizeof(T);
+  }
+  [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0U; }
+
+  constexpr reference operator[](size_type pos) const {
+    S21_CHECK(pos < size(), "Index out of range");
+    return data_[pos];
+  }
+  constexpr reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("AtError: Index out of range");
+    }
+    return data_[pos];
+  }
+  constexpr reference front() const {
+    if (empty()) {
+      throw std::out_of_range("FrontError: span is empty");
+    }
+    return data_[0];
+  }
+  constexpr reference back() const {
+    if (empty()) {
+      throw std::out_of_range("BackError: span is empty");
+    }
+    return data_[size() - 1];
+  }
+
+  constexpr iterator begin() const noexcept { return data_; }
+  constexpr iterator end() const noexcept { return data_ + size(); }
+  constexpr reverse_iterator rbegin() const noexcept {
+    return reverse_iterator(end());
+  }
+  constexpr reverse_iterator rend() const noexcept {
+    return reverse_iterator(begin());
+  }
+
+  // Подотрезки того же буфера; копирования нет. Вариант с параметрами
+  // шаблона даёт span с фиксированным размером.
+  template <std::size_t Count>
+  constexpr span<T, Count> first() const {
+    static_assert(Extent == dynamic_extent || Count <= Extent,
+                  "span::first is longer than the span");
+    S21_CHECK(Count <= size(), "Index out of range");
+    return span<T, Count>(data_, Count);
+  }
+  constexpr span<T> first(size_type count) const {
+    S21_CHECK(count <= size(), "Index out of range");
+    return span<T>(data_, count);
+  }
+  template <std::size_t Count>
+  constexpr span<T, Count> last() const {
+    static_assert(Extent == dynamic_extent || Count <= Extent,
+                  "span::last is longer than the span");
+    S21_CHECK(Count <= size(), "Index out of range");
+    return span<T, Count>(data_ + (size() - Count), Count);
+  }
+  constexpr span<T> last(size_type count) const {
+    S21_CHECK(count <= size(), "Index out of range");
+    return span<T>(data_ + (size() - count), count);
+  }
+  template <std::size_t Offset, std::size_t Count = dynamic_extent>
+  constexpr auto subspan() const {
+    static_assert(Extent == dynamic_extent || Offset <= Extent,
+                  "span::subspan starts past the end");
+    static_assert(Extent == dynamic_extent || Count == dynamic_extent ||
+                      Count <= Extent - Offset,
+                  "span::subspan is longer than the span");
+    constexpr std::size_t kExtent =
+        Count != dynamic_extent
+            ? Count
+            : (Extent != dynamic_extent ? Extent - Offset : dynamic_extent);
+    S21_CHECK(Offset <= size(), "Index out of range");
+    S21_CHECK(Count == dynamic_extent || Count <= size() - Offset,
+              "Index out of range");
+    return span<T, kExtent>(
+        data_ + Offset, Count != dynamic_extent ? Count : size() - Offset);
+  }
+  constexpr span<T> subspan(size_type offset,
+                            size_type count = dynamic_extent) const {
+    S21_CHECK(offset <= size(), "Index out of range");
+    S21_CHECK(count == dynamic_extent || count <= size() - offset,
+              "Index out of range");
+    return span<T>(data_ + offset,
+                   count == dynamic_extent ? size() - offset : count);
+  }
+
+ private:
+  pointer data_ = nullptr;
+};
+
+template <typename T, std::size_t N>
+span(T (&)[N]) -> span<T, N>;
+template <typename T, std::size_t N, std::size_t Alignment>
+span(array<T, N, Alignment> &) -> span<T, N>;
+template <typename T, std::size_t N, std::size_t Alignment>
+span(const array<T, N, Alignment> &) -> span<const T, N>;
+template <typename T, std::size_t N>
+span(std::array<T, N> &) -> span<T, N>;
+template <typename T, std::size_t N>
+span(const std::array<T, N> &) -> span<const T, N>;
+template <typename T>
+span(T *, std::size_t) -> span<T>;
+template <typename T>
+span(T *, T *) -> span<T>;
+template <typename Container>
+span(Container &) -> span<std::remove_pointer_t<
+    decltype(std::declval<Container &>().data())>>;
+template <typename Container>
+span(const Container &) -> span<std::remove_pointer_t<
+    decltype(std::declval<const Container &>().data())>>;
+
+// Байтовое представление тех же элементов.
+template <typename T, std::size_t Extent>
+span<const std::byte, Extent == dynamic_extent ? dynamic_extent
+                                               : Extent * sizeof(T)>
+as_bytes(span<T, Extent> items) noexcept {
+  return {reinterpret_cast<const std::byte *>(items.data()),
+          items.size_bytes()};
+}
+
+template <typename T, std::size_t Extent,
+          typename = std::enable_if_t<!std::is_const_v<T>>>
+span<std::byte, Extent == dynamic_extent ? dynamic_extent
+                                         : Extent * sizeof(T)>
+as_writable_bytes(span<T, Extent> items) noexcept {
+  return {reinterpret_cast<std::byte *>(items.data()), items.size_bytes()};
+}
+}  // namespace s21
+
+#endif  // _S21_SPAN_H_
@@ -1,11 +1,20 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <list>
 #include <map>
+#include <numeric>
 #include <queue>
 #include <set>
+#include <sstream>
 #include <stack>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "s21_containers.h"
@@ -2896,6 +2905,2825 @@ TEST(MultisetTest, InsertManySameElementMultipleTimes) {
   EXPECT_TRUE(result[0].second);
 }
 
+TEST(IntervalMapTest, InsertAndIterateInStartOrder) {
+  s21::interval_map<int, char> im;
+  im.insert(10, 20, 'a');
+  im.insert(1, 5, 'b');
+  im.insert(7, 8, 'c');
+  im.insert(1, 3, 'd');
+
+  std::vector<char> expected = {'d', 'b', 'c', 'a'};
+  auto it = im.begin();
+  for (char value : expected) {
+    EXPECT_EQ(it->second, value);
+    ++it;
+  }
+  EXPECT_EQ(it, im.end());
+  EXPECT_EQ(im.size(), 4U);
+}
+
+TEST(IntervalMapTest, OverlapQuery) {
+  s21::interval_map<int, int> im{{{15, 20}, 0}, {{10, 30}, 1}, {{17, 19}, 2},
+                                 {{5, 20}, 3},  {{12, 15}, 4}, {{30, 40}, 5}};
+  std::vector<int> found;
+  for (const auto &item : im.overlaps(14, 16)) found.push_back(item.second);
+  EXPECT_EQ(found, std::vector<int>({3, 1, 4, 0}));
+
+  EXPECT_TRUE(im.overlaps(41, 50).empty());
+  EXPECT_FALSE(im.any_overlap(41, 50));
+  EXPECT_TRUE(im.any_overlap(40, 50));
+  EXPECT_EQ(im.count_overlaps(30, 30), 2U);
+}
+
+TEST(IntervalMapTest, StabQuery) {
+  s21::interval_map<int, int> im;
+  im.insert(1, 4, 1);
+  im.insert(3, 3, 2);
+  im.insert(5, 9, 3);
+  std::vector<int> found;
+  for (auto it = im.stab(3).begin(); it != im.stab(3).end(); ++it)
+    found.push_back(it.value());
+  EXPECT_EQ(found, std::vector<int>({1, 2}));
+  EXPECT_TRUE(im.stab(0).empty());
+}
+
+TEST(IntervalMapTest, EraseKeepsQueriesCorrect) {
+  s21::interval_map<int, int> im;
+  for (int i = 0; i < 100; ++i) im.insert(i, i + 2, i);
+  for (auto it = im.begin(); it != im.end();) {
+    auto victim = it++;
+    if (victim.value() % 3 != 0) im.erase(victim);
+  }
+  EXPECT_EQ(im.size(), 34U);
+  std::vector<int> found;
+  for (const auto &item : im.overlaps(10, 13)) found.push_back(item.second);
+  EXPECT_EQ(found, std::vector<int>({9, 12}));
+}
+
+TEST(IntervalMapTest, BulkLoadMatchesBruteForce) {
+  std::vector<std::pair<std::pair<int, int>, int>> items;
+  unsigned seed = 12345;
+  for (int i = 0; i < 500; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    int low = static_cast<int>(seed % 1000);
+    int len = static_cast<int>((seed >> 10) % 50);
+    items.push_back({{low, low + len}, i});
+  }
+  s21::interval_map<int, int> im;
+  im.insert(2000, 2001, -1);
+  im.bulk_load(items.begin(), items.end());
+  EXPECT_EQ(im.size(), items.size() + 1);
+
+  for (int low = 0; low < 1100; low += 37) {
+    int high = low + 20;
+    std::multiset<int> expected;
+    for (const auto &item : items)
+      if (item.first.first <= high && low <= item.first.second)
+        expected.insert(item.second);
+    std::multiset<int> actual;
+    for (const auto &item : im.overlaps(low, high)) actual.insert(item.second);
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST(IntervalMapTest, CopyAndMove) {
+  s21::interval_map<int, int> im{{{1, 2}, 1}, {{3, 4}, 2}};
+  s21::interval_map<int, int> copy(im);
+  s21::interval_map<int, int> moved(std::move(im));
+  EXPECT_EQ(copy.size(), 2U);
+  EXPECT_EQ(moved.size(), 2U);
+  EXPECT_TRUE(im.empty());
+  EXPECT_EQ(copy.count_overlaps(2, 3), 2U);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+
+  // через константную карту значения не меняются
+  const s21::interval_map<int, int> &view = copy;
+  using view_iterator = decltype(view.begin());
+  static_assert(std::is_same_v<view_iterator,
+                               s21::interval_map<int, int>::const_iterator>);
+  static_assert(std::is_same_v<decltype(view.begin().value()), const int &>);
+  static_assert(std::is_same_v<
+                std::iterator_traits<view_iterator>::reference,
+                s21::interval_map<int, int>::const_reference>);
+  s21::interval_map<int, int>::iterator it = copy.begin();
+  it.value() = 10;
+  it->second += 1;
+  view_iterator read = it;
+  EXPECT_EQ(read.value(), 11);
+  EXPECT_TRUE(read == it && it == read);
+  EXPECT_EQ((--view.end()).low(), 3);
+  copy.erase(read);
+  EXPECT_EQ(copy.size(), 1U);
+  EXPECT_EQ(view.cbegin().value(), 2);
+}
+
+TEST(MapFunctions, SplitAtKey) {
+  s21::map<int, int> our_map;
+  for (int i = 0; i < 1000; ++i) our_map.insert(i, i * 10);
+  auto parts = our_map.split(300);
+  EXPECT_TRUE(our_map.empty());
+  EXPECT_EQ(parts.first.size(), 300U);
+  EXPECT_EQ(parts.second.size(), 700U);
+  EXPECT_EQ(*parts.first.begin(), 0);
+  EXPECT_EQ(*parts.second.begin(), 3000);
+  EXPECT_FALSE(parts.first.contains(300));
+  EXPECT_TRUE(parts.second.contains(300));
+  EXPECT_EQ(parts.second.at(999), 9990);
+}
+
+TEST(MapFunctions, JoinDisjointRanges) {
+  s21::map<int, int> left({{1, 10}, {2, 20}});
+  s21::map<int, int> right({{5, 50}, {7, 70}, {9, 90}});
+  s21::map<int, int> joined =
+      s21::map<int, int>::join(std::move(left), std::move(right));
+  EXPECT_EQ(joined.size(), 5U);
+  EXPECT_TRUE(left.empty());
+  EXPECT_TRUE(right.empty());
+  std::vector<int> expected = {10, 20, 50, 70, 90};
+  auto it = joined.begin();
+  for (int value : expected) EXPECT_EQ(*it++, value);
+  EXPECT_EQ(it, joined.end());
+}
+
+TEST(MapFunctions, JoinOverlappingThrows) {
+  s21::map<int, int> left({{1, 10}, {5, 50}});
+  s21::map<int, int> right({{5, 51}, {7, 70}});
+  using map_type = s21::map<int, int>;
+  EXPECT_THROW(map_type::join(std::move(left), std::move(right)),
+               std::invalid_argument);
+  EXPECT_EQ(left.size(), 2U);
+  EXPECT_EQ(right.size(), 2U);
+}
+
+TEST(SetFunctions, SplitThenJoinRoundTrip) {
+  s21::set<int> our_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 500; ++i) {
+    int value = (i * 7919) % 1009;
+    our_set.insert(value);
+    std_set.insert(value);
+  }
+  for (int cut : {-5, 0, 250, 600, 2000}) {
+    auto parts = our_set.split(cut);
+    EXPECT_EQ(parts.first.size(),
+              static_cast<size_t>(std::distance(std_set.begin(),
+                                                std_set.lower_bound(cut))));
+    our_set = s21::set<int>::join(std::move(parts.first),
+                                  std::move(parts.second));
+    EXPECT_EQ(our_set.size(), std_set.size());
+    auto our_it = our_set.begin();
+    for (int value : std_set) EXPECT_EQ(*our_it++, value);
+    EXPECT_EQ(our_it, our_set.end());
+  }
+  EXPECT_EQ(our_set.count(our_set.size() ? *our_set.begin() : 0), 1U);
+}
+
+TEST(MultisetFunctions, SplitAndJoinWithDuplicates) {
+  s21::multiset<int> our_multiset({1, 2, 2, 3, 3, 3, 4});
+  auto parts = our_multiset.split(3);
+  EXPECT_EQ(parts.first.size(), 3U);
+  EXPECT_EQ(parts.second.size(), 4U);
+  EXPECT_EQ(parts.second.count(3), 3U);
+  EXPECT_EQ(parts.first.count(3), 0U);
+
+  s21::multiset<int> tail({4, 4});
+  s21::multiset<int> joined =
+      s21::multiset<int>::join(std::move(parts.second), std::move(tail));
+  EXPECT_EQ(joined.size(), 6U);
+  EXPECT_EQ(joined.count(4), 3U);
+}
+
+TEST(EraseIfTest, MapRebuildAndPiecewise) {
+  s21::map<int, int> our_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 1000; ++i) {
+    our_map.insert(i, i * 2);
+    std_map.insert({i, i * 2});
+  }
+  auto removed = s21::erase_if(
+      our_map, [](const std::pair<const int, int> &item) {
+        return item.first % 5 < 2;
+      });
+  EXPECT_EQ(removed, 400U);
+  removed = s21::erase_if(our_map,
+                          [](const int &key, const int &) { return key < 10; });
+  EXPECT_EQ(removed, 6U);
+  for (auto it = std_map.begin(); it != std_map.end();)
+    it = (it->first % 5 < 2 || it->first < 10) ? std_map.erase(it) : ++it;
+
+  EXPECT_EQ(our_map.size(), std_map.size());
+  auto our_it = our_map.begin();
+  for (const auto &item : std_map) EXPECT_EQ(*our_it++, item.second);
+  EXPECT_EQ(our_it, our_map.end());
+  our_map.insert(1, 1);
+  EXPECT_TRUE(our_map.contains(1));
+}
+
+TEST(EraseIfTest, SetRebuildRatioIsConfigurable) {
+  s21::set<int> rebuilt;
+  s21::set<int> piecewise;
+  for (int i = 0; i < 200; ++i) {
+    rebuilt.insert(i);
+    piecewise.insert(i);
+  }
+  auto odd = [](int value) { return value % 2 != 0; };
+  EXPECT_EQ(s21::erase_if(rebuilt, odd, 0.0), 100U);
+  EXPECT_EQ(s21::erase_if(piecewise, odd, 1.0), 100U);
+  EXPECT_EQ(rebuilt.size(), piecewise.size());
+  auto it = piecewise.begin();
+  for (int value : rebuilt) EXPECT_EQ(value, *it++);
+}
+
+TEST(EraseIfTest, MultisetKeepsDuplicates) {
+  s21::multiset<int> our_multiset({1, 2, 2, 3, 3, 3, 4});
+  EXPECT_EQ(s21::erase_if(our_multiset, [](int v) { return v == 3; }), 3U);
+  EXPECT_EQ(our_multiset.size(), 4U);
+  EXPECT_EQ(our_multiset.count(2), 2U);
+  EXPECT_EQ(our_multiset.count(3), 0U);
+}
+
+TEST(EraseIfTest, TreeEraseKeepsOtherIteratorsValid) {
+  s21::set<int> our_set({1, 2, 3, 4, 5});
+  auto keep = our_set.find(4);
+  our_set.erase(our_set.find(3));
+  our_set.erase(our_set.find(2));
+  EXPECT_EQ(*keep, 4);
+  EXPECT_EQ(our_set.size(), 3U);
+  EXPECT_FALSE(our_set.contains(3));
+}
+
+TEST(EraseIfTest, SequenceContainers) {
+  auto even = [](int value) { return value % 2 == 0; };
+
+  s21::vector<int> our_vector = {1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(s21::erase_if(our_vector, even), 3U);
+  EXPECT_EQ(our_vector.size(), 3U);
+  EXPECT_EQ(our_vector[0], 1);
+  EXPECT_EQ(our_vector[2], 5);
+
+  s21::list<int> our_list = {2, 1, 4, 3, 6};
+  EXPECT_EQ(s21::erase_if(our_list, even), 3U);
+  EXPECT_EQ(our_list.size(), 2U);
+  EXPECT_EQ(our_list.front(), 1);
+  EXPECT_EQ(our_list.back(), 3);
+
+  s21::deque<int> our_deque = {2, 1, 4, 3, 6};
+  EXPECT_EQ(s21::erase_if(our_deque, even), 3U);
+  EXPECT_EQ(our_deque.size(), 2U);
+  EXPECT_EQ(our_deque.front(), 1);
+  EXPECT_EQ(our_deque.back(), 3);
+  EXPECT_EQ(s21::erase_if(our_deque, [](int) { return true; }), 2U);
+  EXPECT_TRUE(our_deque.empty());
+}
+
+TEST(EraseIfTest, ThrowingPredicateKeepsSizeConsistent) {
+  // предикат падает на 5: удалённые до него узлы уже не входят в size()
+  auto even_until_five = [](int value) {
+    if (value == 5) throw std::runtime_error("predicate failed");
+    return value % 2 == 0;
+  };
+
+  s21::list<int> our_list = {2, 1, 4, 5, 6, 8};
+  EXPECT_THROW(s21::erase_if(our_list, even_until_five), std::runtime_error);
+  EXPECT_EQ(our_list.size(), 4U);
+  EXPECT_EQ(our_list.front(), 1);
+  EXPECT_EQ(our_list.back(), 8);
+  our_list.clear();
+  EXPECT_TRUE(our_list.empty());
+
+  s21::deque<int> our_deque = {2, 1, 4, 5, 6, 8};
+  EXPECT_THROW(s21::erase_if(our_deque, even_until_five), std::runtime_error);
+  EXPECT_EQ(our_deque.size(), 4U);
+  EXPECT_EQ(our_deque.front(), 1);
+  our_deque.clear();
+  EXPECT_EQ(our_deque.size(), 0U);
+}
+
+TEST(RadixMapTest, InsertFindAndOrderedIteration) {
+  s21::radix_map<int> rm{{"/api/users", 1}, {"/api", 2}, {"/api/user", 3},
+                         {"/static/app.js", 4}, {"", 5}};
+  EXPECT_EQ(rm.size(), 5U);
+  EXPECT_EQ(rm.at("/api/user"), 3);
+  EXPECT_EQ(rm.at(""), 5);
+  EXPECT_FALSE(rm.contains("/api/use"));
+  EXPECT_THROW(rm.at("/missing"), std::out_of_range);
+  EXPECT_FALSE(rm.insert("/api", 20).second);
+  EXPECT_EQ(rm["/api"], 2);
+
+  std::vector<std::string> keys;
+  for (auto it = rm.begin(); it != rm.end(); ++it) keys.push_back(it.key());
+  EXPECT_EQ(keys, std::vector<std::string>({"", "/api", "/api/user",
+                                            "/api/users", "/static/app.js"}));
+}
+
+TEST(RadixMapTest, EraseCompactsAndKeepsOrder) {
+  s21::radix_map<int> rm;
+  rm["romane"] = 1;
+  rm["romanus"] = 2;
+  rm["romulus"] = 3;
+  rm["rubens"] = 4;
+  rm["ruber"] = 5;
+  EXPECT_EQ(rm.erase("romanus"), 1U);
+  EXPECT_EQ(rm.erase("romanus"), 0U);
+  rm.erase(rm.find("rubens"));
+  EXPECT_EQ(rm.size(), 3U);
+  std::vector<int> values;
+  for (int value : rm) values.push_back(value);
+  EXPECT_EQ(values, std::vector<int>({1, 3, 5}));
+  EXPECT_EQ(rm.find("ruber").value(), 5);
+}
+
+TEST(RadixMapTest, LowerBoundAndPrefixRangeMatchStdMap) {
+  s21::radix_map<int> rm;
+  std::map<std::string, int> std_map;
+  const char *parts[] = {"a", "ab", "b", "ba", "/", "x"};
+  unsigned seed = 7;
+  for (int i = 0; i < 400; ++i) {
+    std::string key;
+    int length = static_cast<int>(seed % 6);
+    for (int j = 0; j < length; ++j) {
+      seed = seed * 1103515245U + 12345U;
+      key += parts[(seed >> 8) % 6];
+    }
+    seed = seed * 1103515245U + 12345U;
+    rm.insert(key, i);
+    std_map.insert({key, i});
+  }
+  EXPECT_EQ(rm.size(), std_map.size());
+
+  auto our_it = rm.begin();
+  for (const auto &item : std_map) {
+    EXPECT_EQ(our_it.key(), item.first);
+    EXPECT_EQ(*our_it, item.second);
+    ++our_it;
+  }
+  EXPECT_EQ(our_it, rm.end());
+
+  for (const std::string probe : {"", "a", "aa", "ab/", "b", "baa", "c", "/x",
+                                  "ababab", "zz", "x/"}) {
+    auto std_lower = std_map.lower_bound(probe);
+    auto our_lower = rm.lower_bound(probe);
+    if (std_lower == std_map.end()) {
+      EXPECT_EQ(our_lower, rm.end());
+    } else {
+      EXPECT_EQ(our_lower.key(), std_lower->first);
+    }
+
+    std::vector<std::string> expected;
+    for (auto it = std_lower; it != std_map.end() &&
+                              it->first.compare(0, probe.size(), probe) == 0;
+         ++it)
+      expected.push_back(it->first);
+    std::vector<std::string> actual;
+    auto range = rm.prefix_range(probe);
+    for (auto it = range.first; it != range.second; ++it)
+      actual.push_back(it.key());
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST(RadixMapTest, CopyMoveAndClear) {
+  s21::radix_map<std::string> rm{{"tag:red", "r"}, {"tag:green", "g"}};
+  s21::radix_map<std::string> copy(rm);
+  s21::radix_map<std::string> moved(std::move(rm));
+  EXPECT_TRUE(rm.empty());
+  EXPECT_EQ(copy.at("tag:red"), "r");
+  EXPECT_EQ(moved.at("tag:green"), "g");
+  copy.insert_or_assign("tag:red", "R");
+  EXPECT_EQ(copy.at("tag:red"), "R");
+  EXPECT_EQ(moved.at("tag:red"), "r");
+  moved.clear();
+  EXPECT_EQ(moved.begin(), moved.end());
+
+  // через константную карту значения не меняются
+  const s21::radix_map<std::string> &view = copy;
+  using view_iterator = decltype(view.find("tag:red"));
+  static_assert(std::is_same_v<view_iterator,
+                               s21::radix_map<std::string>::const_iterator>);
+  static_assert(std::is_same_v<decltype(*view.begin()), const std::string &>);
+  static_assert(std::is_same_v<
+                std::iterator_traits<view_iterator>::reference,
+                s21::radix_map<std::string>::const_reference>);
+  s21::radix_map<std::string>::iterator it = copy.find("tag:green");
+  *it = "G";
+  view_iterator read = it;
+  EXPECT_EQ(*read, "G");
+  EXPECT_TRUE(read == it && it == read);
+  EXPECT_EQ(view.lower_bound("tag:h").key(), "tag:red");
+  copy.erase(read);
+  EXPECT_FALSE(copy.contains("tag:green"));
+}
+
+TEST(BitmapSetTest, InsertEraseContainsAcrossContainerKinds) {
+  s21::bitmap_set<> bs;
+  std::set<std::uint32_t> ref;
+  unsigned seed = 99;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    std::uint32_t value = (seed >> 4) % 9000 + ((seed & 1) ? 0x30000U : 0U);
+    EXPECT_EQ(bs.insert(value), ref.insert(value).second);
+  }
+  for (std::uint32_t value = 0; value < 3000; value += 3) {
+    EXPECT_EQ(bs.erase(value), ref.erase(value));
+    EXPECT_EQ(bs.erase(value + 0x30000U), ref.erase(value + 0x30000U));
+  }
+  EXPECT_EQ(bs.size(), ref.size());
+  EXPECT_TRUE(bs.contains(*ref.begin()));
+  EXPECT_FALSE(bs.contains(0x20000U));
+
+  auto it = bs.begin();
+  for (std::uint32_t value : ref) EXPECT_EQ(*it++, value);
+  EXPECT_EQ(it, bs.end());
+}
+
+TEST(BitmapSetTest, RankMatchesStdSet) {
+  s21::bitmap_set<> bs;
+  std::set<std::uint32_t> ref;
+  for (std::uint32_t value = 5; value < 200000; value += 7) {
+    bs.insert(value);
+    ref.insert(value);
+  }
+  bs.insert_range(70000, 80000);
+  for (std::uint32_t value = 70000; value <= 80000; ++value) ref.insert(value);
+  for (std::uint32_t probe : {0U, 5U, 6U, 65535U, 70001U, 80000U, 150000U}) {
+    EXPECT_EQ(bs.rank(probe),
+              static_cast<size_t>(std::distance(ref.begin(),
+                                                ref.upper_bound(probe))));
+  }
+  bs.run_optimize();
+  EXPECT_EQ(bs.rank(75000), static_cast<size_t>(std::distance(
+                                ref.begin(), ref.upper_bound(75000))));
+}
+
+TEST(BitmapSetTest, UnionAndIntersection) {
+  s21::bitmap_set<> evens;
+  s21::bitmap_set<> thirds;
+  std::set<std::uint32_t> ref_evens;
+  std::set<std::uint32_t> ref_thirds;
+  for (std::uint32_t value = 0; value < 150000; value += 2) {
+    evens.insert(value);
+    ref_evens.insert(value);
+  }
+  for (std::uint32_t value = 0; value < 300000; value += 3) {
+    thirds.insert(value);
+    ref_thirds.insert(value);
+  }
+  thirds.insert_range(250000, 260000);
+  for (std::uint32_t value = 250000; value <= 260000; ++value)
+    ref_thirds.insert(value);
+  thirds.run_optimize();
+
+  std::vector<std::uint32_t> expected_union;
+  std::set_union(ref_evens.begin(), ref_evens.end(), ref_thirds.begin(),
+                 ref_thirds.end(), std::back_inserter(expected_union));
+  std::vector<std::uint32_t> expected_common;
+  std::set_intersection(ref_evens.begin(), ref_evens.end(), ref_thirds.begin(),
+                        ref_thirds.end(), std::back_inserter(expected_common));
+
+  s21::bitmap_set<> both = evens | thirds;
+  s21::bitmap_set<> common = evens & thirds;
+  EXPECT_EQ(std::vector<std::uint32_t>(both.begin(), both.end()),
+            expected_union);
+  EXPECT_EQ(std::vector<std::uint32_t>(common.begin(), common.end()),
+            expected_common);
+  EXPECT_EQ(both.size(), expected_union.size());
+  EXPECT_EQ(common.size(), expected_common.size());
+}
+
+TEST(BitmapSetTest, DenseRangeIsCompact) {
+  s21::bitmap_set<> bs;
+  bs.insert_range(1000, 1000999);
+  EXPECT_EQ(bs.size(), 1000000U);
+  EXPECT_TRUE(bs.contains(1000));
+  EXPECT_TRUE(bs.contains(1000999));
+  EXPECT_FALSE(bs.contains(1001000));
+  EXPECT_LT(bs.memory_usage(), 200000U);
+  bs.run_optimize();
+  EXPECT_LT(bs.memory_usage(), 5000U);
+  EXPECT_EQ(bs.rank(1000999), 1000000U);
+  EXPECT_EQ(bs.erase(500000), 1U);
+  EXPECT_EQ(bs.size(), 999999U);
+  EXPECT_FALSE(bs.contains(500000));
+}
+
+TEST(BitmapSetTest, ConversionWithSet) {
+  s21::set<std::uint32_t> source({7, 3, 70000, 1});
+  s21::bitmap_set<> bs(source.begin(), source.end());
+  EXPECT_EQ(bs.size(), 4U);
+  s21::set<std::uint32_t> back = bs.to_set();
+  EXPECT_EQ(back.size(), 4U);
+  auto it = back.begin();
+  for (std::uint32_t value : {1U, 3U, 7U, 70000U}) EXPECT_EQ(*it++, value);
+}
+
+namespace {
+struct LifetimeCounter {
+  static int constructed;
+  static int destroyed;
+  int value;
+  LifetimeCounter() : value(0) { ++constructed; }
+  explicit LifetimeCounter(int v) : value(v) { ++constructed; }
+  LifetimeCounter(const LifetimeCounter &other) : value(other.value) {
+    ++constructed;
+  }
+  LifetimeCounter(LifetimeCounter &&other) noexcept : value(other.value) {
+    ++constructed;
+  }
+  LifetimeCounter &operator=(const LifetimeCounter &) = default;
+  LifetimeCounter &operator=(LifetimeCounter &&) = default;
+  ~LifetimeCounter() { ++destroyed; }
+  static void reset() { constructed = destroyed = 0; }
+};
+int LifetimeCounter::constructed = 0;
+int LifetimeCounter::destroyed = 0;
+}  // namespace
+
+TEST(VectorLifetimeTest, ReserveConstructsNothing) {
+  LifetimeCounter::reset();
+  {
+    s21::vector<LifetimeCounter> our_vector;
+    our_vector.reserve(1000);
+    EXPECT_EQ(LifetimeCounter::constructed, 0);
+    EXPECT_EQ(our_vector.capacity(), 1000U);
+    EXPECT_EQ(our_vector.size(), 0U);
+  }
+  EXPECT_EQ(LifetimeCounter::destroyed, 0);
+}
+
+TEST(VectorLifetimeTest, SizeConstructorBuildsEachElementOnce) {
+  LifetimeCounter::reset();
+  { s21::vector<LifetimeCounter> our_vector(10); }
+  EXPECT_EQ(LifetimeCounter::constructed, 10);
+  EXPECT_EQ(LifetimeCounter::destroyed, 10);
+}
+
+TEST(VectorLifetimeTest, DestructorsRunExactlyOnce) {
+  LifetimeCounter::reset();
+  {
+    s21::vector<LifetimeCounter> our_vector;
+    for (int i = 0; i < 20; ++i) our_vector.push_back(LifetimeCounter(i));
+    our_vector.insert(our_vector.begin() + 3, LifetimeCounter(100));
+    our_vector.erase(our_vector.begin());
+    our_vector.pop_back();
+    our_vector.shrink_to_fit();
+    EXPECT_EQ(our_vector[2].value, 100);
+    EXPECT_EQ(LifetimeCounter::constructed - LifetimeCounter::destroyed, 19);
+    our_vector.clear();
+    EXPECT_EQ(LifetimeCounter::constructed, LifetimeCounter::destroyed);
+    our_vector.push_back(LifetimeCounter(1));
+  }
+  EXPECT_EQ(LifetimeCounter::constructed, LifetimeCounter::destroyed);
+}
+
+TEST(VectorLifetimeTest, InsertManyConstructsIntoSpareCapacity) {
+  s21::vector<std::string> our_vector = {"a", "b", "c"};
+  our_vector.insert_many(our_vector.cbegin() + 1, std::string("x"),
+                         std::string("y"), std::string("z"),
+                         std::string("w"));
+  std::vector<std::string> expected = {"a", "x", "y", "z", "w", "b", "c"};
+  ASSERT_EQ(our_vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(our_vector[i], expected[i]);
+}
+
+namespace {
+template <bool kNoexceptMove>
+struct MoveCounter {
+  static int copies;
+  static int moves;
+  int value;
+  explicit MoveCounter(int v = 0) : value(v) {}
+  MoveCounter(const MoveCounter &other) : value(other.value) { ++copies; }
+  MoveCounter(MoveCounter &&other) noexcept(kNoexceptMove)
+      : value(other.value) {
+    ++moves;
+  }
+  MoveCounter &operator=(const MoveCounter &) = default;
+  MoveCounter &operator=(MoveCounter &&) = default;
+  ~MoveCounter() {}
+  static void reset() { copies = moves = 0; }
+};
+template <bool kNoexceptMove>
+int MoveCounter<kNoexceptMove>::copies = 0;
+template <bool kNoexceptMove>
+int MoveCounter<kNoexceptMove>::moves = 0;
+
+struct RelocatableCounter : MoveCounter<true> {
+  using MoveCounter<true>::MoveCounter;
+};
+}  // namespace
+
+namespace s21 {
+template <>
+struct is_trivially_relocatable<RelocatableCounter> : std::true_type {};
+}  // namespace s21
+
+TEST(VectorRelocationTest, GrowthMovesNoexceptElements) {
+  using counter = MoveCounter<true>;
+  counter::reset();
+  s21::vector<counter> our_vector;
+  for (int i = 0; i < 100; ++i) our_vector.push_back(counter(i));
+  int pushed_copies = counter::copies;
+  our_vector.reserve(1000);
+  our_vector.shrink_to_fit();
+  EXPECT_EQ(counter::copies, pushed_copies);
+  EXPECT_GE(counter::moves, 200);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(our_vector[i].value, i);
+}
+
+TEST(VectorRelocationTest, GrowthCopiesThrowingMoveElements) {
+  using counter = MoveCounter<false>;
+  counter::reset();
+  s21::vector<counter> our_vector(10);
+  our_vector.reserve(100);
+  EXPECT_EQ(counter::moves, 0);
+  EXPECT_EQ(counter::copies, 10);
+}
+
+TEST(VectorRelocationTest, TriviallyRelocatableSkipsConstructors) {
+  RelocatableCounter::reset();
+  s21::vector<RelocatableCounter> our_vector(50);
+  for (int i = 0; i < 50; ++i) our_vector[i].value = i;
+  our_vector.reserve(5000);
+  our_vector.shrink_to_fit();
+  EXPECT_EQ(RelocatableCounter::moves, 0);
+  EXPECT_EQ(RelocatableCounter::copies, 0);
+  for (int i = 0; i < 50; ++i) EXPECT_EQ(our_vector[i].value, i);
+}
+
+TEST(VectorRelocationTest, TrivialElementsSurviveLargeGrowth) {
+  s21::vector<int> our_vector;
+  for (int i = 0; i < 1 << 20; ++i) our_vector.push_back(i);
+  our_vector.reserve(1 << 22);
+  EXPECT_EQ(our_vector.capacity(), static_cast<size_t>(1 << 22));
+  our_vector.shrink_to_fit();
+  EXPECT_EQ(our_vector.capacity(), our_vector.size());
+  bool intact = true;
+  for (int i = 0; i < 1 << 20; ++i) intact = intact && our_vector[i] == i;
+  EXPECT_TRUE(intact);
+  our_vector.clear();
+  our_vector.shrink_to_fit();
+  EXPECT_EQ(our_vector.capacity(), 0U);
+  EXPECT_EQ(our_vector.data(), nullptr);
+}
+
+namespace {
+struct Record {
+  static int defaults;
+  static int copies;
+  static int moves;
+  std::string name;
+  std::vector<int> payload;
+  Record() { ++defaults; }
+  Record(std::string n, int size) : name(std::move(n)), payload(size, 1) {}
+  Record(const Record &other) : name(other.name), payload(other.payload) {
+    ++copies;
+  }
+  Record(Record &&other) noexcept
+      : name(std::move(other.name)), payload(std::move(other.payload)) {
+    ++moves;
+  }
+  Record &operator=(const Record &other) {
+    name = other.name;
+    payload = other.payload;
+    ++copies;
+    return *this;
+  }
+  Record &operator=(Record &&other) noexcept {
+    name = std::move(other.name);
+    payload = std::move(other.payload);
+    ++moves;
+    return *this;
+  }
+  static void reset() { defaults = copies = moves = 0; }
+};
+int Record::defaults = 0;
+int Record::copies = 0;
+int Record::moves = 0;
+}  // namespace
+
+TEST(VectorEmplaceTest, EmplaceBackConstructsInPlace) {
+  Record::reset();
+  s21::vector<Record> our_vector;
+  our_vector.reserve(100);
+  Record *storage = our_vector.data();
+  for (int i = 0; i < 100; ++i)
+    our_vector.emplace_back("record" + std::to_string(i), 16);
+  EXPECT_EQ(our_vector.data(), storage);
+  EXPECT_EQ(Record::defaults, 0);
+  EXPECT_EQ(Record::copies, 0);
+  EXPECT_EQ(Record::moves, 0);
+  Record &last = our_vector.emplace_back("tail", 1);
+  EXPECT_EQ(&last, &our_vector[100]);
+  EXPECT_EQ(Record::copies, 0);
+  EXPECT_EQ(our_vector[7].name, "record7");
+}
+
+TEST(VectorEmplaceTest, PushBackRvalueMovesOnly) {
+  Record::reset();
+  s21::vector<Record> our_vector;
+  for (int i = 0; i < 50; ++i) our_vector.push_back(Record("r", 4));
+  our_vector.insert(our_vector.begin(), Record("head", 2));
+  EXPECT_EQ(Record::copies, 0);
+  EXPECT_EQ(Record::defaults, 0);
+  EXPECT_EQ(our_vector.size(), 51U);
+  EXPECT_EQ(our_vector[0].name, "head");
+  EXPECT_EQ(our_vector[1].payload.size(), 4U);
+}
+
+TEST(VectorEmplaceTest, EmplaceInsertsAtPosition) {
+  s21::vector<std::string> our_vector = {"a", "d"};
+  our_vector.emplace(our_vector.cbegin() + 1, 2, 'c');
+  our_vector.emplace(our_vector.cbegin() + 1, "b");
+  our_vector.emplace(our_vector.cend(), "e");
+  std::vector<std::string> expected = {"a", "b", "cc", "d", "e"};
+  ASSERT_EQ(our_vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(our_vector[i], expected[i]);
+  EXPECT_THROW(our_vector.emplace(our_vector.cend() + 1, "x"),
+               std::out_of_range);
+}
+
+TEST(VectorEmplaceTest, ArgumentsMayAliasElements) {
+  s21::vector<std::string> our_vector = {"first", "second"};
+  ASSERT_EQ(our_vector.size(), our_vector.capacity());
+  our_vector.emplace_back(our_vector[0]);
+  our_vector.insert(our_vector.begin(), our_vector[2]);
+  our_vector.emplace(our_vector.cbegin() + 1, our_vector[3]);
+  std::vector<std::string> expected = {"first", "first", "first", "second",
+                                       "first"};
+  ASSERT_EQ(our_vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(our_vector[i], expected[i]);
+}
+
+namespace {
+struct AllocationStats {
+  int allocations = 0;
+  int deallocations = 0;
+};
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  AllocationStats *stats;
+
+  explicit CountingAllocator(AllocationStats *s) : stats(s) {}
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &other) : stats(other.stats) {}
+
+  T *allocate(size_t n) {
+    ++stats->allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    ++stats->deallocations;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U> &other) const {
+    return stats == other.stats;
+  }
+  template <typename U>
+  bool operator!=(const CountingAllocator<U> &other) const {
+    return stats != other.stats;
+  }
+};
+}  // namespace
+
+TEST(AllocatorTest, SequenceContainersUseAllocator) {
+  AllocationStats stats;
+  {
+    s21::vector<int, CountingAllocator<int>> our_vector{
+        CountingAllocator<int>(&stats)};
+    for (int i = 0; i < 100; ++i) our_vector.push_back(i);
+    EXPECT_GT(stats.allocations, 0);
+    s21::vector<int, CountingAllocator<int>> copy(our_vector);
+    EXPECT_EQ(copy.get_allocator(), our_vector.get_allocator());
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+
+  stats = AllocationStats();
+  {
+    s21::list<int, CountingAllocator<int>> our_list(
+        {1, 2, 3}, CountingAllocator<int>(&stats));
+    s21::deque<int, CountingAllocator<int>> our_deque(
+        {1, 2, 3}, CountingAllocator<int>(&stats));
+    EXPECT_EQ(stats.allocations, 7);  // 3 + сторожевой узел списка, 3
+    our_list.pop_front();
+    our_deque.pop_back();
+    EXPECT_EQ(stats.deallocations, 2);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+}
+
+TEST(AllocatorTest, TreeContainersUseAllocator) {
+  AllocationStats stats;
+  {
+    using pair_allocator = CountingAllocator<std::pair<const int, int>>;
+    s21::map<int, int, pair_allocator> our_map({{1, 1}, {2, 2}, {3, 3}},
+                                               pair_allocator(&stats));
+    s21::set<int, CountingAllocator<int>> our_set(
+        {5, 1, 3}, CountingAllocator<int>(&stats));
+    s21::multiset<int, CountingAllocator<int>> our_multiset(
+        {2, 2}, CountingAllocator<int>(&stats));
+    EXPECT_EQ(stats.allocations, 8);
+    auto parts = our_map.split(2);
+    EXPECT_EQ(parts.first.size(), 1U);
+    EXPECT_EQ(parts.second.size(), 2U);
+    EXPECT_EQ(stats.allocations, 8);
+    our_set.erase(our_set.find(3));
+    EXPECT_EQ(stats.deallocations, 1);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+}
+
+namespace {
+// Ресурс, который помнит свои блоки: освобождение чужого блока
+// считается в foreign_frees и в upstream не передаётся.
+class TrackingResource : public std::pmr::memory_resource {
+ public:
+  int foreign_frees = 0;
+  std::size_t live() const { return blocks_.size(); }
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override {
+    void *p = std::pmr::new_delete_resource()->allocate(bytes, align);
+    blocks_.insert(p);
+    return p;
+  }
+  void do_deallocate(void *p, std::size_t bytes, std::size_t align) override {
+    if (blocks_.erase(p) == 0U) {
+      ++foreign_frees;
+      return;
+    }
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  std::set<void *> blocks_;
+};
+}  // namespace
+
+TEST(ArenaTest, ContainersAllocateOnlyFromArena) {
+  std::pmr::memory_resource *previous =
+      std::pmr::set_default_resource(std::pmr::null_memory_resource());
+  {
+    s21::monotonic_arena arena;
+    s21::pmr::vector<int> our_vector(&arena);
+    s21::pmr::list<int> our_list(&arena);
+    s21::pmr::deque<int> our_deque(&arena);
+    s21::pmr::map<int, int> our_map(&arena);
+    s21::pmr::set<int> our_set(&arena);
+    s21::pmr::multiset<int> our_multiset(&arena);
+    std::pmr::polymorphic_allocator<int> arena_allocator(&arena);
+    s21::pmr::stack<int> our_stack(arena_allocator);
+    s21::pmr::queue<int> our_queue(arena_allocator);
+    for (int i = 0; i < 1000; ++i) {
+      our_vector.push_back(i);
+      our_list.push_back(i);
+      our_deque.push_front(i);
+      our_map.insert(i, i);
+      our_set.insert(i);
+      our_multiset.insert(i % 10);
+      our_stack.push(i);
+      our_queue.push(i);
+    }
+    EXPECT_EQ(our_map.size(), 1000U);
+    EXPECT_EQ(our_multiset.count(3), 100U);
+    EXPECT_GT(arena.bytes_used(), 1000 * 8 * sizeof(int));
+    EXPECT_GE(arena.bytes_reserved(), arena.bytes_used());
+    EXPECT_EQ(our_vector.get_allocator().resource(), &arena);
+  }
+  std::pmr::set_default_resource(previous);
+}
+
+TEST(ArenaTest, ReleaseReturnsBlocksAndReusesBuffer) {
+  alignas(std::max_align_t) char buffer[512];
+  s21::monotonic_arena arena(buffer, sizeof(buffer));
+  void *first = arena.allocate(64, 64);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first) % 64, 0U);
+  EXPECT_GE(first, static_cast<void *>(buffer));
+  EXPECT_EQ(arena.block_count(), 0U);
+  {
+    s21::pmr::vector<long> our_vector(&arena);
+    for (long i = 0; i < 1000; ++i) our_vector.push_back(i);
+    EXPECT_EQ(our_vector[999], 999);
+  }
+  EXPECT_GT(arena.block_count(), 0U);
+  arena.release();
+  EXPECT_EQ(arena.block_count(), 0U);
+  EXPECT_EQ(arena.bytes_used(), 0U);
+  EXPECT_EQ(arena.bytes_reserved(), 0U);
+  EXPECT_EQ(arena.allocate(16, 16), static_cast<void *>(buffer));
+}
+
+TEST(ArenaTest, MoveAcrossArenasCopiesIntoTarget) {
+  s21::monotonic_arena source_arena;
+  s21::monotonic_arena target_arena;
+  s21::pmr::vector<int> source_vector({1, 2, 3}, &source_arena);
+  s21::pmr::vector<int> target_vector(&target_arena);
+  s21::pmr::list<int> source_list({4, 5}, &source_arena);
+  s21::pmr::list<int> target_list(&target_arena);
+  s21::pmr::set<int> source_set({6, 7}, &source_arena);
+  s21::pmr::set<int> target_set(&target_arena);
+
+  size_t used = target_arena.bytes_used();
+  target_vector = std::move(source_vector);
+  target_list = std::move(source_list);
+  target_set = std::move(source_set);
+  EXPECT_GT(target_arena.bytes_used(), used);
+  EXPECT_EQ(target_vector.get_allocator().resource(), &target_arena);
+  EXPECT_EQ(target_vector.size(), 3U);
+  EXPECT_EQ(target_vector[2], 3);
+  EXPECT_EQ(target_list.back(), 5);
+  EXPECT_TRUE(target_set.contains(7));
+  EXPECT_TRUE(source_vector.empty());
+  EXPECT_TRUE(source_list.empty());
+  EXPECT_TRUE(source_set.empty());
+  EXPECT_THROW(s21::pmr::set<int>::join(std::move(target_set),
+                                        s21::pmr::set<int>({9}, &source_arena)),
+               std::invalid_argument);
+}
+
+TEST(ArenaTest, MoveAcrossResourcesMovesElements) {
+  static_assert(std::is_nothrow_move_assignable_v<s21::deque<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::list<int>>);
+  static_assert(!std::is_nothrow_move_assignable_v<s21::pmr::deque<int>>);
+  static_assert(!std::is_nothrow_move_assignable_v<s21::pmr::list<int>>);
+
+  TrackingResource source_resource;
+  TrackingResource target_resource;
+  {
+    using record_allocator = std::pmr::polymorphic_allocator<Record>;
+    s21::deque<Record, record_allocator> source_deque(&source_resource);
+    s21::deque<Record, record_allocator> target_deque(&target_resource);
+    s21::list<Record, record_allocator> source_list(&source_resource);
+    s21::list<Record, record_allocator> target_list(&target_resource);
+    for (int i = 0; i < 10; ++i) {
+      source_deque.push_back(Record("deque", i + 1));
+      source_list.insert_many_back(Record("list", i + 1));
+    }
+
+    Record::reset();
+    target_deque = std::move(source_deque);
+    target_list = std::move(source_list);
+    EXPECT_EQ(Record::copies, 0);
+    EXPECT_EQ(target_deque.size(), 10U);
+    EXPECT_EQ(target_deque.back().payload.size(), 10U);
+    EXPECT_EQ(target_list.front().name, "list");
+    EXPECT_EQ(target_list.back().payload.size(), 10U);
+    EXPECT_TRUE(source_deque.empty());
+    EXPECT_TRUE(source_list.empty());
+  }
+  EXPECT_EQ(source_resource.foreign_frees + target_resource.foreign_frees, 0);
+  EXPECT_EQ(source_resource.live() + target_resource.live(), 0U);
+}
+
+namespace {
+template <typename T>
+struct PropagatingAllocator : CountingAllocator<T> {
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  using CountingAllocator<T>::CountingAllocator;
+  template <typename U>
+  PropagatingAllocator(const PropagatingAllocator<U> &other)
+      : CountingAllocator<T>(other) {}
+};
+}  // namespace
+
+TEST(ArenaTest, SwapAndMovePropagateAllocators) {
+  AllocationStats first_stats;
+  AllocationStats second_stats;
+  {
+    PropagatingAllocator<int> first(&first_stats);
+    PropagatingAllocator<int> second(&second_stats);
+    s21::deque<int, PropagatingAllocator<int>> deque_a({1, 2}, first);
+    s21::deque<int, PropagatingAllocator<int>> deque_b({3}, second);
+    s21::list<int, PropagatingAllocator<int>> list_a({1, 2}, first);
+    s21::list<int, PropagatingAllocator<int>> list_b({3}, second);
+    using pair_allocator = PropagatingAllocator<std::pair<const int, int>>;
+    s21::map<int, int, pair_allocator> map_a({{1, 1}}, pair_allocator(first));
+    s21::map<int, int, pair_allocator> map_b({{3, 3}},
+                                             pair_allocator(second));
+
+    deque_a.swap(deque_b);
+    list_a.swap(list_b);
+    map_a.swap(map_b);
+    EXPECT_EQ(deque_a.get_allocator().stats, &second_stats);
+    EXPECT_EQ(list_a.get_allocator().stats, &second_stats);
+    EXPECT_EQ(map_a.get_allocator().stats, &second_stats);
+    EXPECT_EQ(deque_a.front(), 3);
+    EXPECT_EQ(list_b.back(), 2);
+
+    s21::list<int, PropagatingAllocator<int>> list_c({7}, first);
+    list_c = std::move(list_a);
+    EXPECT_EQ(list_c.get_allocator().stats, &second_stats);
+    EXPECT_EQ(list_c.front(), 3);
+    s21::deque<int, PropagatingAllocator<int>> deque_c({7}, first);
+    deque_c = std::move(deque_a);
+    EXPECT_EQ(deque_c.get_allocator().stats, &second_stats);
+    EXPECT_EQ(deque_c.size(), 1U);
+  }
+  EXPECT_EQ(first_stats.allocations, first_stats.deallocations);
+  EXPECT_EQ(second_stats.allocations, second_stats.deallocations);
+}
+
+TEST(SmallVectorTest, StaysInlineUpToCapacity) {
+  AllocationStats stats;
+  {
+    s21::small_vector<int, 8, CountingAllocator<int>> our_vector{
+        CountingAllocator<int>(&stats)};
+    for (int i = 0; i < 8; ++i) our_vector.push_back(i);
+    EXPECT_TRUE(our_vector.is_inline());
+    EXPECT_EQ(our_vector.capacity(), 8U);
+    EXPECT_EQ(stats.allocations, 0);
+
+    our_vector.push_back(8);
+    EXPECT_FALSE(our_vector.is_inline());
+    EXPECT_EQ(stats.allocations, 1);
+    EXPECT_EQ(our_vector.capacity(), 16U);
+    for (int i = 0; i < 9; ++i) EXPECT_EQ(our_vector[i], i);
+
+    our_vector.pop_back();
+    our_vector.shrink_to_fit();
+    EXPECT_TRUE(our_vector.is_inline());
+    EXPECT_EQ(our_vector.back(), 7);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+}
+
+TEST(SmallVectorTest, MovesStealHeapAndCopyInline) {
+  s21::small_vector<std::string, 2> heap_vector = {"a", "b", "c"};
+  std::string *buffer = heap_vector.data();
+  s21::small_vector<std::string, 2> moved(std::move(heap_vector));
+  EXPECT_EQ(moved.data(), buffer);
+  EXPECT_TRUE(heap_vector.empty());
+  EXPECT_TRUE(heap_vector.is_inline());
+
+  s21::small_vector<std::string, 2> inline_vector = {"x"};
+  moved = std::move(inline_vector);
+  EXPECT_TRUE(moved.is_inline());
+  ASSERT_EQ(moved.size(), 1U);
+  EXPECT_EQ(moved[0], "x");
+  EXPECT_TRUE(inline_vector.empty());
+
+  s21::small_vector<std::string, 2> copy(moved);
+  copy.swap(heap_vector);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(heap_vector.front(), "x");
+}
+
+TEST(SmallVectorTest, MatchesVectorOperations) {
+  s21::small_vector<std::string, 4> ours = {"b", "d"};
+  s21::vector<std::string> expected = {"b", "d"};
+  auto apply = [](auto &v) {
+    v.insert(v.begin(), "a");
+    v.emplace(v.cbegin() + 2, 1, 'c');
+    v.insert_many(v.cbegin() + 4, std::string("e"), std::string("f"));
+    v.insert_many_back(std::string("g"));
+    v.emplace_back("h");
+    v.erase(v.begin() + 1);
+    s21::erase_if(v, [](const std::string &s) { return s == "f"; });
+  };
+  apply(ours);
+  apply(expected);
+  ASSERT_EQ(ours.size(), expected.size());
+  for (size_t i = 0; i < ours.size(); ++i) EXPECT_EQ(ours.at(i), expected[i]);
+  EXPECT_THROW(ours.at(ours.size()), std::out_of_range);
+}
+
+TEST(SmallVectorTest, RangeOperationsMatchVector) {
+  s21::small_vector<std::string, 4> ours = {"a", "z"};
+  s21::vector<std::string> expected = {"a", "z"};
+  auto apply = [](auto &v) {
+    std::list<std::string> words = {"p", "q", "r"};
+    v.insert(v.cbegin() + 1, 3, std::string("x"));
+    v.insert(v.cbegin() + 2, words.begin(), words.end());
+    std::istringstream stream("s t");
+    v.insert(v.cbegin(), std::istream_iterator<std::string>(stream),
+             std::istream_iterator<std::string>());
+    v.insert(v.cbegin() + 3, 2, v[0]);
+    return *v.erase(v.cbegin() + 1, v.cbegin() + 4);
+  };
+  EXPECT_EQ(apply(ours), apply(expected));
+  ASSERT_EQ(ours.size(), expected.size());
+  for (size_t i = 0; i < ours.size(); ++i) EXPECT_EQ(ours[i], expected[i]);
+  EXPECT_EQ(*ours.erase(ours.begin()), expected[1]);
+  EXPECT_THROW(ours.erase(ours.cbegin() + 2, ours.cbegin() + 1),
+               std::out_of_range);
+
+  std::vector<std::string> few = {"1", "2"};
+  ours.assign(few.begin(), few.end());
+  ours.shrink_to_fit();
+  EXPECT_TRUE(ours.is_inline());
+  ASSERT_EQ(ours.size(), 2U);
+  EXPECT_EQ(ours[1], "2");
+  std::vector<std::string> many(9, "m");
+  ours.assign(many.begin(), many.end());
+  EXPECT_EQ(ours.size(), 9U);
+  EXPECT_FALSE(ours.is_inline());
+  std::istringstream stream("u v w");
+  ours.assign(std::istream_iterator<std::string>(stream),
+              std::istream_iterator<std::string>());
+  ASSERT_EQ(ours.size(), 3U);
+  EXPECT_EQ(ours.back(), "w");
+}
+
+TEST(SmallVectorTest, ReleasesEveryElement) {
+  LifetimeCounter::reset();
+  {
+    s21::small_vector<LifetimeCounter, 3> our_vector(2);
+    for (int i = 0; i < 10; ++i) our_vector.emplace_back(i);
+    our_vector.erase(our_vector.begin());
+    s21::small_vector<LifetimeCounter, 3> copy(our_vector);
+    copy.shrink_to_fit();
+  }
+  EXPECT_EQ(LifetimeCounter::constructed, LifetimeCounter::destroyed);
+}
+
+TEST(VectorRangeTest, EraseRangeShiftsTailOnce) {
+  s21::vector<int> our_vector = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::vector<int> std_vector = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto it = our_vector.erase(our_vector.cbegin() + 2, our_vector.cbegin() + 5);
+  auto it1 = std_vector.erase(std_vector.cbegin() + 2, std_vector.cbegin() + 5);
+  EXPECT_EQ(*it, *it1);
+  it = our_vector.erase(our_vector.cbegin() + 1, our_vector.cbegin() + 1);
+  EXPECT_EQ(*it, 1);
+  our_vector.erase(our_vector.cbegin() + 4, our_vector.cend());
+  std_vector.erase(std_vector.cbegin() + 4, std_vector.cend());
+  ASSERT_EQ(our_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i)
+    EXPECT_EQ(our_vector[i], std_vector[i]);
+  EXPECT_THROW(our_vector.erase(our_vector.cbegin() + 3, our_vector.cbegin()),
+               std::out_of_range);
+
+  LifetimeCounter::reset();
+  {
+    s21::vector<LifetimeCounter> counters(100);
+    counters.erase(std::remove_if(counters.begin(), counters.end(),
+                                  [](const LifetimeCounter &) { return true; }),
+                   counters.end());
+    EXPECT_TRUE(counters.empty());
+    EXPECT_EQ(LifetimeCounter::constructed, LifetimeCounter::destroyed);
+  }
+}
+
+TEST(VectorRangeTest, InsertCountAndRange) {
+  s21::vector<std::string> our_vector = {"a", "b", "c"};
+  std::vector<std::string> std_vector = {"a", "b", "c"};
+  our_vector.insert(our_vector.cbegin() + 1, 2, our_vector[2]);
+  std_vector.insert(std_vector.cbegin() + 1, 2, std_vector[2]);
+  std::list<std::string> source = {"x", "y", "z", "w", "v"};
+  auto it = our_vector.insert(our_vector.cbegin() + 4, source.begin(),
+                              source.end());
+  std_vector.insert(std_vector.cbegin() + 4, source.begin(), source.end());
+  EXPECT_EQ(*it, "x");
+  std::istringstream words("p q");
+  our_vector.insert(our_vector.cbegin(),
+                    std::istream_iterator<std::string>(words),
+                    std::istream_iterator<std::string>());
+  std_vector.insert(std_vector.cbegin(), {"p", "q"});
+  ASSERT_EQ(our_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i)
+    EXPECT_EQ(our_vector[i], std_vector[i]);
+
+  s21::vector<int> numbers;
+  numbers.insert(numbers.cbegin(), 3, 5);
+  EXPECT_EQ(numbers.size(), 3U);
+  EXPECT_EQ(numbers[2], 5);
+  EXPECT_THROW(numbers.insert(numbers.cbegin() + 4, 1, 0), std::out_of_range);
+}
+
+TEST(VectorRangeTest, RepeatedRangeInsertGrowsGeometrically) {
+  s21::vector<std::string> our_vector;
+  std::vector<std::string> chunk = {"a", "b", "c"};
+  size_t reallocations = 0;
+  for (int i = 0; i < 1000; ++i) {
+    size_t capacity = our_vector.capacity();
+    our_vector.insert(our_vector.cbegin(), chunk.begin(), chunk.end());
+    if (our_vector.capacity() != capacity) ++reallocations;
+  }
+  EXPECT_EQ(our_vector.size(), 3000U);
+  EXPECT_LT(reallocations, 16U);
+  EXPECT_EQ(our_vector[2999], "c");
+}
+
+TEST(VectorRangeTest, AssignReusesStorage) {
+  s21::vector<std::string> our_vector = {"a", "b", "c", "d"};
+  std::list<std::string> shorter = {"x", "y"};
+  our_vector.assign(shorter.begin(), shorter.end());
+  EXPECT_EQ(our_vector.size(), 2U);
+  EXPECT_EQ(our_vector.capacity(), 4U);
+  EXPECT_EQ(our_vector[1], "y");
+
+  std::vector<std::string> longer = {"1", "2", "3", "4", "5", "6"};
+  our_vector.assign(longer.begin() + 1, longer.begin() + 4);
+  EXPECT_EQ(our_vector.size(), 3U);
+  EXPECT_EQ(our_vector[2], "4");
+  our_vector.assign(longer.begin(), longer.end());
+  ASSERT_EQ(our_vector.size(), 6U);
+  EXPECT_EQ(our_vector[5], "6");
+
+  std::istringstream words("k l m");
+  our_vector.assign(std::istream_iterator<std::string>(words),
+                    std::istream_iterator<std::string>());
+  ASSERT_EQ(our_vector.size(), 3U);
+  EXPECT_EQ(our_vector[0], "k");
+}
+
+namespace {
+struct ThrowingCopy {
+  static int live;
+  static int copies_left;
+  int value;
+  explicit ThrowingCopy(int v = 0) : value(v) { ++live; }
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++live;
+  }
+  ThrowingCopy(ThrowingCopy &&other) noexcept : value(other.value) { ++live; }
+  ThrowingCopy &operator=(const ThrowingCopy &) = default;
+  ThrowingCopy &operator=(ThrowingCopy &&) = default;
+  ~ThrowingCopy() { --live; }
+};
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = 0;
+}  // namespace
+
+TEST(VectorRangeTest, FailedInsertLeavesValidVector) {
+  {
+    s21::vector<ThrowingCopy> our_vector;
+    for (int i = 0; i < 8; ++i) our_vector.emplace_back(i);
+    ThrowingCopy::copies_left = 3;
+    EXPECT_THROW(our_vector.insert(our_vector.cbegin() + 2, 10,
+                                   ThrowingCopy(42)),
+                 std::runtime_error);
+    EXPECT_EQ(our_vector.size(), 2U);
+    EXPECT_EQ(our_vector[1].value, 1);
+    EXPECT_EQ(ThrowingCopy::live, 2);
+  }
+  EXPECT_EQ(ThrowingCopy::live, 0);
+}
+
+namespace {
+// Перемещающее присваивание бросает исключение после заданного числа
+// вызовов; конструкторы не бросают, поэтому сбой приходится на сдвиг
+// хвоста внутри буфера.
+struct ThrowingMoveAssign {
+  static int live;
+  static int moves_left;
+  int value;
+  explicit ThrowingMoveAssign(int v = 0) : value(v) { ++live; }
+  ThrowingMoveAssign(const ThrowingMoveAssign &other) : value(other.value) {
+    ++live;
+  }
+  ThrowingMoveAssign(ThrowingMoveAssign &&other) noexcept
+      : value(other.value) {
+    ++live;
+  }
+  ThrowingMoveAssign &operator=(const ThrowingMoveAssign &) = default;
+  ThrowingMoveAssign &operator=(ThrowingMoveAssign &&other) {
+    if (moves_left-- == 0) throw std::runtime_error("move failed");
+    value = other.value;
+    return *this;
+  }
+  ~ThrowingMoveAssign() { --live; }
+};
+int ThrowingMoveAssign::live = 0;
+int ThrowingMoveAssign::moves_left = 0;
+
+template <typename Container>
+void CheckFailedShiftTail() {
+  {
+    Container items;
+    items.reserve(16);
+    for (int i = 0; i < 8; ++i) items.emplace_back(i);
+    ThrowingMoveAssign::moves_left = 2;
+    EXPECT_THROW(items.insert(items.cbegin() + 1, 2, ThrowingMoveAssign(9)),
+                 std::runtime_error);
+    EXPECT_EQ(items.size(), 8U);
+    EXPECT_EQ(ThrowingMoveAssign::live, 8);
+  }
+  EXPECT_EQ(ThrowingMoveAssign::live, 0);
+}
+}  // namespace
+
+namespace {
+// Ключ, сравнение которого бросает исключение после заданного числа вызовов.
+struct ThrowingKey {
+  static int compares_left;
+  int value = 0;
+  friend bool operator<(const ThrowingKey &a, const ThrowingKey &b) {
+    if (compares_left-- == 0) throw std::runtime_error("compare failed");
+    return a.value < b.value;
+  }
+};
+int ThrowingKey::compares_left = 0;
+}  // namespace
+
+TEST(IntervalMapTest, FailedBulkLoadLeaksNothing) {
+  ThrowingKey::compares_left = 1000;
+  ThrowingCopy::copies_left = 1000;
+  {
+    s21::interval_map<ThrowingKey, ThrowingCopy> im;
+    im.insert({1}, {3}, ThrowingCopy(1));
+    std::vector<std::pair<std::pair<ThrowingKey, ThrowingKey>, ThrowingCopy>>
+        items;
+    for (int i = 10; i > 0; --i)
+      items.push_back({{{i}, {i + 1}}, ThrowingCopy(i)});
+    ThrowingKey::compares_left = 3;
+    EXPECT_THROW(im.bulk_load(items.begin(), items.end()),
+                 std::runtime_error);
+    ThrowingKey::compares_left = 1000;
+    EXPECT_EQ(im.size(), 1U);
+    EXPECT_EQ(ThrowingCopy::live, 11);
+    im.bulk_load(items.begin(), items.end());
+    EXPECT_EQ(im.size(), 11U);
+    EXPECT_EQ(im.count_overlaps({3}, {3}), 3U);
+  }
+  EXPECT_EQ(ThrowingCopy::live, 0);
+}
+
+TEST(VectorRangeTest, FailedShiftDestroysBuiltTail) {
+  CheckFailedShiftTail<s21::vector<ThrowingMoveAssign>>();
+  CheckFailedShiftTail<s21::small_vector<ThrowingMoveAssign, 4>>();
+}
+
+// insert_many обрезает контейнер до позиции вставки, как insert(pos, n, v):
+// ни счётчик размера, ни перенесённый хвост не теряют элементов.
+template <typename Container>
+void CheckFailedInsertMany(Container &items, size_t reserve) {
+  for (int i = 0; i < 6; ++i) items.emplace_back(i);
+  items.reserve(reserve);
+  ThrowingCopy a(10), b(11), c(12), d(13);
+  ThrowingCopy::copies_left = 1;
+  EXPECT_THROW(items.insert_many(items.cbegin() + 4, a, b, c, d),
+               std::runtime_error);
+  EXPECT_EQ(items.size(), 4U);
+  EXPECT_EQ(items[3].value, 3);
+  EXPECT_EQ(ThrowingCopy::live, 4 + 4);
+  ThrowingCopy::copies_left = 100;
+  items.insert_many(items.cbegin() + 1, a, b);
+  EXPECT_EQ(items.size(), 6U);
+  EXPECT_EQ(items[2].value, 11);
+}
+
+TEST(VectorRangeTest, FailedInsertManyLeavesValidVector) {
+  for (size_t reserve : {6U, 16U}) {
+    {
+      s21::vector<ThrowingCopy> our_vector;
+      CheckFailedInsertMany(our_vector, reserve);
+    }
+    EXPECT_EQ(ThrowingCopy::live, 0);
+    {
+      s21::small_vector<ThrowingCopy, 4> our_small;
+      CheckFailedInsertMany(our_small, reserve);
+    }
+    EXPECT_EQ(ThrowingCopy::live, 0);
+  }
+}
+
+TEST(VectorIteratorTest, DifferenceTypeArithmetic) {
+  using iterator = s21::vector<int>::iterator;
+  static_assert(std::is_same_v<std::iterator_traits<iterator>::difference_type,
+                               std::ptrdiff_t>);
+  s21::vector<int> our_vector = {5, 3, 9, 1, 7};
+  std::sort(our_vector.begin(), our_vector.end());
+  auto it = our_vector.end();
+  std::ptrdiff_t back = -2;
+  it += back;
+  EXPECT_EQ(*it, 7);
+  EXPECT_EQ(it[-1], 5);
+  it -= 2;
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(*(2 + our_vector.begin()), 5);
+  EXPECT_EQ(our_vector.end() - our_vector.begin(), 5);
+  EXPECT_TRUE(std::binary_search(our_vector.cbegin(), our_vector.cend(), 9));
+}
+
+#ifdef S21_CHECKED
+TEST(CheckedModeTest, VectorAndArrayIndexing) {
+  s21::vector<int> our_vector = {1, 2, 3};
+  EXPECT_THROW(our_vector[3], std::out_of_range);
+  EXPECT_THROW(*our_vector.end(), std::out_of_range);
+  EXPECT_THROW(our_vector.begin() + 4, std::out_of_range);
+  EXPECT_THROW(our_vector.cbegin() - 1, std::out_of_range);
+  EXPECT_NO_THROW(our_vector.begin() + 3);
+  s21::array<int, 2> arr = {1, 2};
+  EXPECT_THROW(arr[2], std::out_of_range);
+}
+
+TEST(CheckedModeTest, ListIterators) {
+  s21::list<int> our_list = {1, 2};
+  s21::list<int> other = {3};
+  EXPECT_THROW(*our_list.end(), std::out_of_range);
+  EXPECT_THROW(++our_list.end(), std::out_of_range);
+  EXPECT_THROW(our_list.insert(other.begin(), 4), std::out_of_range);
+  EXPECT_THROW(our_list.erase(other.begin()), std::out_of_range);
+  EXPECT_EQ(our_list.size(), 2U);
+}
+#endif
+
+namespace {
+template <typename T>
+void check_scans_match_std(const std::vector<T> &samples) {
+  for (size_t n = 0; n <= samples.size(); ++n) {
+    const T *first = samples.data();
+    const T *last = first + n;
+    for (size_t k = 0; k < n; k += 7) {
+      EXPECT_EQ(s21::simd::find(first, last, first[k]),
+                std::find(first, last, first[k]));
+      EXPECT_EQ(s21::simd::count(first, last, first[k]),
+                static_cast<size_t>(std::count(first, last, first[k])));
+    }
+    EXPECT_EQ(s21::simd::find(first, last, T(-1)), last);
+    EXPECT_EQ(s21::simd::min_element(first, last),
+              std::min_element(first, last));
+    EXPECT_EQ(s21::simd::max_element(first, last),
+              std::max_element(first, last));
+  }
+}
+
+template <typename T>
+std::vector<T> sensor_samples(size_t n) {
+  std::vector<T> samples(n);
+  for (size_t i = 0; i < n; ++i)
+    samples[i] = static_cast<T>((i * 7919U + 13U) % 37U);
+  return samples;
+}
+}  // namespace
+
+TEST(SimdTest, ScansMatchStdOnEveryLength) {
+  check_scans_match_std(sensor_samples<int>(70));
+  check_scans_match_std(sensor_samples<float>(70));
+  check_scans_match_std(sensor_samples<double>(70));
+  check_scans_match_std(sensor_samples<short>(20));
+
+  std::vector<int> big = sensor_samples<int>(300000);
+  EXPECT_EQ(s21::simd::count(big.data(), big.data() + big.size(), 5),
+            static_cast<size_t>(std::count(big.begin(), big.end(), 5)));
+}
+
+TEST(SimdTest, FloatEdgeCasesFollowStd) {
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<float> samples = {3.0f, 0.0f, -0.0f, 2.0f, 1.0f, -0.0f,
+                                5.0f, 4.0f, 0.0f,  nan,  6.0f, 7.0f};
+  const float *first = samples.data();
+  const float *last = first + samples.size();
+  EXPECT_EQ(s21::simd::min_element(first, last),
+            std::min_element(first, last));
+  EXPECT_EQ(s21::simd::max_element(first, last),
+            std::max_element(first, last));
+  EXPECT_EQ(s21::simd::find(first, last, nan), last);
+  EXPECT_EQ(s21::simd::count(first, last, -0.0f), 4U);
+  EXPECT_EQ(s21::simd::find(first, last, -0.0f), first + 1);
+
+  std::vector<float> copy = samples;
+  EXPECT_FALSE(s21::simd::equal(first, last, copy.data()));
+  EXPECT_TRUE(s21::simd::equal(first, first + 9, copy.data()));
+}
+
+TEST(SimdTest, ContainerOverloads) {
+  s21::vector<int> our_vector(37);
+  s21::simd::fill(our_vector, 4);
+  our_vector[20] = 9;
+  our_vector[30] = -2;
+  EXPECT_EQ(s21::simd::count(our_vector, 4), 35U);
+  EXPECT_EQ(s21::simd::find(our_vector, 9), our_vector.begin() + 20);
+  EXPECT_EQ(*s21::simd::max_element(our_vector), 9);
+  EXPECT_EQ(s21::simd::min_element(our_vector) - our_vector.begin(), 30);
+
+  s21::array<float, 10> arr;
+  s21::simd::fill(arr, 1.5f);
+  s21::array<float, 10> other = arr;
+  EXPECT_TRUE(s21::simd::equal(arr, other));
+  other[9] = 2.5f;
+  EXPECT_FALSE(s21::simd::equal(arr, other));
+  EXPECT_EQ(s21::simd::find(other, 2.5f), other.begin() + 9);
+
+  const s21::vector<double> constant = {1.0, 2.0, 2.0};
+  EXPECT_EQ(s21::simd::count(constant, 2.0), 2U);
+}
+
+namespace {
+std::vector<int> shuffled_ids(size_t n) {
+  std::vector<int> ids(n);
+  for (size_t i = 0; i < n; ++i)
+    ids[i] = static_cast<int>((i * 2654435761U) % 1000003U) % 5000;
+  return ids;
+}
+}  // namespace
+
+TEST(ParallelTest, SortMatchesStd) {
+  s21::parallel::thread_pool pool(4);
+  for (size_t n : {0U, 1U, 1000U, 100000U, 300001U}) {
+    std::vector<int> expected = shuffled_ids(n);
+    s21::vector<int> our_vector(n);
+    std::copy(expected.begin(), expected.end(), our_vector.begin());
+    std::sort(expected.begin(), expected.end());
+    s21::parallel::sort(pool, our_vector.begin(), our_vector.end());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                           our_vector.begin()));
+  }
+
+  // устойчивость: и для буферного слияния, и для inplace_merge
+  std::vector<int> keys = shuffled_ids(200000);
+  std::vector<std::pair<int, size_t>> records(keys.size());
+  std::vector<std::pair<int, std::string>> named(keys.size() / 4);
+  for (size_t i = 0; i < keys.size(); ++i) records[i] = {keys[i] % 97, i};
+  for (size_t i = 0; i < named.size(); ++i)
+    named[i] = {keys[i] % 31, std::to_string(i)};
+  auto by_key = [](const auto &a, const auto &b) { return a.first < b.first; };
+  auto expected_records = records;
+  auto expected_named = named;
+  std::stable_sort(expected_records.begin(), expected_records.end(), by_key);
+  std::stable_sort(expected_named.begin(), expected_named.end(), by_key);
+  s21::parallel::stable_sort(pool, records.begin(), records.end(), by_key);
+  s21::parallel::stable_sort(pool, named.begin(), named.end(), by_key);
+  EXPECT_EQ(records, expected_records);
+  EXPECT_EQ(named, expected_named);
+
+  std::vector<int> descending = shuffled_ids(50000);
+  s21::parallel::sort(descending, std::greater<>());
+  EXPECT_TRUE(std::is_sorted(descending.begin(), descending.end(),
+                             std::greater<>()));
+}
+
+TEST(ParallelTest, ReduceAndScanMatchStd) {
+  s21::parallel::thread_pool pool(3);
+  std::vector<int> ids = shuffled_ids(250000);
+  s21::vector<long long> readings(ids.size());
+  std::copy(ids.begin(), ids.end(), readings.begin());
+
+  EXPECT_EQ(s21::parallel::reduce(pool, readings.begin(), readings.end(), 0LL),
+            std::accumulate(ids.begin(), ids.end(), 0LL));
+  EXPECT_EQ(s21::parallel::reduce(readings, 7LL), 7LL + std::accumulate(
+                                                            ids.begin(),
+                                                            ids.end(), 0LL));
+  auto bigger = [](long long a, long long b) { return std::max(a, b); };
+  EXPECT_EQ(s21::parallel::reduce(pool, readings.begin(), readings.end(),
+                                  -1LL, bigger),
+            *std::max_element(ids.begin(), ids.end()));
+  EXPECT_EQ(s21::parallel::reduce(pool, readings.begin(), readings.begin(),
+                                  5LL),
+            5LL);
+
+  std::vector<long long> expected(ids.size());
+  std::inclusive_scan(ids.begin(), ids.end(), expected.begin(),
+                      std::plus<long long>());
+  s21::vector<long long> scanned(readings.size());
+  EXPECT_EQ(s21::parallel::inclusive_scan(pool, readings.begin(),
+                                          readings.end(), scanned.begin()),
+            scanned.end());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), scanned.begin()));
+
+  // на месте, через перегрузку для контейнеров
+  s21::parallel::inclusive_scan(readings, readings);
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), readings.begin()));
+
+  s21::vector<long long> too_short(10);
+  EXPECT_THROW(s21::parallel::inclusive_scan(readings, too_short),
+               std::invalid_argument);
+}
+
+TEST(ParallelTest, ScanKeepsChunkOffsetsOfNonTrivialTypes) {
+  // op берёт аргументы по значению: смещение куска, отданное через
+  // std::move, осталось бы пустой строкой
+  s21::parallel::thread_pool pool(4);
+  std::vector<std::string> counts(200000, "1");
+  auto add = [](std::string a, std::string b) {
+    return std::to_string(std::stoll(a) + std::stoll(b));
+  };
+  std::vector<std::string> scanned(counts.size());
+  s21::parallel::inclusive_scan(pool, counts.begin(), counts.end(),
+                                scanned.begin(), add);
+  EXPECT_EQ(scanned[0], "1");
+  EXPECT_EQ(scanned[99999], "100000");
+  EXPECT_EQ(scanned.back(), "200000");
+}
+
+TEST(ParallelTest, TransformAndForEachOverContainers) {
+  s21::parallel::thread_pool pool(4);
+  s21::vector<float> celsius(100000);
+  for (size_t i = 0; i < celsius.size(); ++i)
+    celsius[i] = static_cast<float>(i % 50);
+  s21::vector<float> fahrenheit(celsius.size());
+  auto convert = [](float c) { return c * 1.8f + 32.0f; };
+  s21::parallel::transform(pool, celsius.begin(), celsius.end(),
+                           fahrenheit.begin(), convert);
+  for (size_t i = 0; i < celsius.size(); i += 997)
+    EXPECT_FLOAT_EQ(fahrenheit[i], convert(celsius[i]));
+
+  s21::array<int, 16> small;
+  small.fill(2);
+  s21::array<int, 16> doubled;
+  s21::parallel::transform(small, doubled, [](int x) { return x * 2; });
+  EXPECT_EQ(doubled[15], 4);
+  EXPECT_THROW(s21::parallel::transform(celsius, small,
+                                        [](float c) { return int(c); }),
+               std::invalid_argument);
+
+  std::atomic<long> visited{0};
+  s21::parallel::for_each(pool, celsius.begin(), celsius.end(),
+                          [&](float &c) {
+                            c += 1.0f;
+                            visited.fetch_add(1, std::memory_order_relaxed);
+                          });
+  EXPECT_EQ(visited.load(), 100000);
+  EXPECT_FLOAT_EQ(celsius[49], 50.0f);
+  s21::parallel::for_each(small, [](int &x) { x = -x; });
+  EXPECT_EQ(small[0], -2);
+}
+
+TEST(ParallelTest, PoolRunsEveryTaskAndPropagatesErrors) {
+  s21::parallel::thread_pool single(1);
+  EXPECT_EQ(single.size(), 1U);
+  s21::parallel::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), 4U);
+
+  std::vector<int> hits(1000, 0);
+  pool.run(hits.size(), [&](size_t i) { hits[i] += 1; });
+  EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), 1000);
+
+  // вложенный run внутри задачи не должен зависать
+  std::atomic<int> inner{0};
+  pool.run(8, [&](size_t) {
+    pool.run(8, [&](size_t) { inner.fetch_add(1); });
+  });
+  EXPECT_EQ(inner.load(), 64);
+
+  EXPECT_THROW(pool.run(100,
+                        [](size_t i) {
+                          if (i == 42) throw std::runtime_error("sensor");
+                        }),
+               std::runtime_error);
+  pool.run(hits.size(), [&](size_t i) { hits[i] += 1; });
+  EXPECT_EQ(std::count(hits.begin(), hits.end(), 2), 1000);
+
+  auto throwing_less = [](int a, int b) {
+    if (a == 4999 || b == 4999) throw std::logic_error("bad reading");
+    return a < b;
+  };
+  std::vector<int> ids = shuffled_ids(100000);
+  EXPECT_THROW(s21::parallel::sort(pool, ids.begin(), ids.end(),
+                                   throwing_less),
+               std::logic_error);
+}
+
+namespace {
+struct Reading {
+  int sensor;
+  double value;
+};
+
+std::string temp_path(const char *name) {
+  std::string path = testing::TempDir() + name;
+  std::remove(path.c_str());
+  return path;
+}
+}  // namespace
+
+TEST(MmapVectorTest, DataSurvivesReopen) {
+  const std::string path = temp_path("s21_mmap_reopen.bin");
+  {
+    s21::mmap_vector<Reading> readings(path);
+    EXPECT_TRUE(readings.is_open());
+    EXPECT_TRUE(readings.empty());
+    for (int i = 0; i < 10000; ++i) readings.push_back({i, i * 0.5});
+    readings.emplace_back(Reading{-1, 1.5});
+    EXPECT_EQ(readings.size(), 10001U);
+    EXPECT_GE(readings.capacity(), readings.size());
+  }
+  {
+    s21::mmap_vector<Reading> readings(
+        path, s21::mmap_vector<Reading>::open_mode::open_existing);
+    ASSERT_EQ(readings.size(), 10001U);
+    EXPECT_EQ(readings[7000].sensor, 7000);
+    EXPECT_DOUBLE_EQ(readings.at(7000).value, 3500.0);
+    EXPECT_EQ(readings.back().sensor, -1);
+    readings.pop_back();
+    readings.shrink_to_fit();
+    EXPECT_EQ(readings.capacity(), 10000U);
+  }
+  s21::mmap_vector<Reading> readings(path);
+  EXPECT_EQ(readings.size(), 10000U);
+  EXPECT_EQ(readings.capacity(), 10000U);
+  long sum = 0;
+  for (auto it = readings.begin(); it != readings.end(); ++it)
+    sum += it->sensor;
+  EXPECT_EQ(sum, 9999L * 10000 / 2);
+
+  // create обрезает существующий файл
+  readings.open(path, s21::mmap_vector<Reading>::open_mode::create);
+  EXPECT_EQ(readings.size(), 0U);
+  readings.close();
+  EXPECT_FALSE(readings.is_open());
+  std::remove(path.c_str());
+}
+
+TEST(MmapVectorTest, GrowthResizeAndFlush) {
+  const std::string path = temp_path("s21_mmap_growth.bin");
+  s21::mmap_vector<int> ids(path, s21::mmap_vector<int>::open_mode::create,
+                            s21::mmap_vector<int>::flush_policy::on_grow);
+  ids.resize(5, 7);
+  EXPECT_EQ(ids.size(), 5U);
+  EXPECT_EQ(ids[4], 7);
+  ids.resize(2);
+  ids.resize(300000);
+  EXPECT_EQ(ids[1], 7);
+  EXPECT_EQ(ids[2], 0);
+  EXPECT_EQ(ids[299999], 0);
+  // элемент самого отображения как аргумент при росте
+  ids.shrink_to_fit();
+  ids.push_back(ids[0]);
+  EXPECT_EQ(ids.back(), 7);
+  ids.reserve(1000000);
+  EXPECT_EQ(ids.capacity(), 1000000U);
+  ids.flush();
+  ids.flush(true);
+  ids.clear();
+  EXPECT_TRUE(ids.empty());
+  EXPECT_THROW(ids.at(0), std::out_of_range);
+  EXPECT_THROW(ids.front(), std::out_of_range);
+
+  s21::mmap_vector<int> moved(std::move(ids));
+  EXPECT_FALSE(ids.is_open());
+  EXPECT_THROW(ids.push_back(1), std::logic_error);
+  EXPECT_EQ(ids.size(), 0U);
+  moved.push_back(42);
+  ids = std::move(moved);
+  EXPECT_EQ(ids.front(), 42);
+  std::remove(path.c_str());
+}
+
+TEST(MmapVectorTest, HeaderIsValidated) {
+  const std::string path = temp_path("s21_mmap_header.bin");
+  using open_mode = s21::mmap_vector<int>::open_mode;
+  EXPECT_THROW(s21::mmap_vector<int>(path, open_mode::open_existing),
+               std::system_error);
+  {
+    s21::mmap_vector<int> ids(path);
+    ids.push_back(1);
+  }
+  EXPECT_THROW(s21::mmap_vector<double>{path}, std::invalid_argument);
+  EXPECT_EQ(s21::mmap_vector<int>(path).size(), 1U);
+
+  {
+    std::ofstream garbage(path, std::ios::binary | std::ios::trunc);
+    garbage << std::string(100, 'x');
+  }
+  EXPECT_THROW(s21::mmap_vector<int>{path}, std::invalid_argument);
+  {
+    std::ofstream garbage(path, std::ios::binary | std::ios::trunc);
+    garbage << "short";
+  }
+  EXPECT_THROW(s21::mmap_vector<int>{path}, std::invalid_argument);
+  std::remove(path.c_str());
+}
+
+TEST(SoaVectorTest, RowsAndColumns) {
+  s21::soa_vector<float, float, int> particles;
+  EXPECT_TRUE(particles.empty());
+  for (int i = 0; i < 1000; ++i)
+    particles.push_back(static_cast<float>(i), 0.5f, i);
+  particles.emplace_back(-1.0f, 2.0f, -1);
+  ASSERT_EQ(particles.size(), 1001U);
+
+  auto [x, v, id] = particles[10];
+  EXPECT_FLOAT_EQ(x, 10.0f);
+  EXPECT_FLOAT_EQ(v, 0.5f);
+  id = 77;
+  EXPECT_EQ(particles.column<2>()[10], 77);
+  EXPECT_EQ(std::get<2>(particles.back()), -1);
+  EXPECT_EQ(std::get<0>(particles.at(3)), 3.0f);
+  EXPECT_THROW(particles.at(1001), std::out_of_range);
+
+  // столбцы независимы, выровнены и отдаются как есть алгоритмам
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(particles.data<0>()) % 64U, 0U);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(particles.data<2>()) % 64U, 0U);
+  auto xs = particles.column<0>();
+  auto vs = particles.column<1>();
+  auto ids = particles.column<2>();
+  for (size_t i = 0; i < xs.size(); ++i) xs[i] += vs[i] * 2.0f;
+  EXPECT_FLOAT_EQ(std::get<0>(particles[999]), 1000.0f);
+  EXPECT_EQ(*s21::simd::max_element(ids), 999);
+
+  int rows = 0;
+  for (auto [px, pv, pid] : particles) {
+    static_cast<void>(pv);
+    if (pid >= 0 && px > 0.0f) ++rows;
+  }
+  EXPECT_EQ(rows, 1000);
+  const auto &view = particles;
+  EXPECT_EQ(view.cend() - view.cbegin(), 1001);
+  EXPECT_EQ(std::get<1>(*(view.begin() + 1000)), 2.0f);
+}
+
+TEST(SoaVectorTest, EraseResizeAndCopy) {
+  s21::soa_vector<std::string, int> orders = {
+      {"bid", 10}, {"ask", 11}, {"bid", 12}, {"ask", 13}, {"bid", 14}};
+  auto it = orders.erase(orders.begin() + 1, orders.begin() + 3);
+  EXPECT_EQ(it.index(), 1U);
+  ASSERT_EQ(orders.size(), 3U);
+  EXPECT_EQ(std::get<1>(orders[1]), 13);
+  orders.erase(orders.begin());
+  EXPECT_EQ(std::get<0>(orders.front()), "ask");
+
+  s21::soa_vector<std::string, int> copy = orders;
+  std::get<0>(copy[0]) = "changed";
+  EXPECT_EQ(std::get<0>(orders[0]), "ask");
+  copy.resize(5);
+  EXPECT_EQ(std::get<0>(copy[4]), "");
+  EXPECT_EQ(std::get<1>(copy[4]), 0);
+  copy.resize(1);
+  EXPECT_EQ(copy.size(), 1U);
+  copy.shrink_to_fit();
+  EXPECT_EQ(copy.capacity(), 1U);
+
+  // аргумент из собственного столбца при росте
+  copy.push_back(std::get<0>(copy[0]), std::get<1>(copy[0]));
+  EXPECT_EQ(std::get<0>(copy[1]), "changed");
+
+  orders = copy;
+  EXPECT_EQ(orders.size(), 2U);
+  s21::soa_vector<std::string, int> moved(std::move(orders));
+  EXPECT_TRUE(orders.empty());
+  EXPECT_EQ(moved.size(), 2U);
+  moved.pop_back();
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_THROW(moved.front(), std::out_of_range);
+
+  s21::soa_vector<double> sized(4);
+  EXPECT_EQ(sized.column<0>()[3], 0.0);
+  EXPECT_THROW(sized.erase(sized.begin() + 2, sized.begin() + 1),
+               std::out_of_range);
+
+  // столбцы освобождаются, если конструирование значений бросает
+  struct FailingDefault {
+    FailingDefault() { throw std::runtime_error("no default"); }
+  };
+  EXPECT_THROW((s21::soa_vector<std::string, FailingDefault>(4)),
+               std::runtime_error);
+}
+
+TEST(VectorBoolTest, PackedStorageAndProxies) {
+  s21::vector<bool> visited(1000);
+  EXPECT_EQ(visited.size(), 1000U);
+  EXPECT_EQ(visited.word_count(), 16U);
+  EXPECT_EQ(visited.count(), 0U);
+  visited[3] = true;
+  visited[64] = visited[3];
+  visited.at(999).flip();
+  EXPECT_TRUE(visited[3]);
+  EXPECT_TRUE(visited[64]);
+  EXPECT_TRUE(visited.back());
+  EXPECT_FALSE(visited.front());
+  EXPECT_EQ(visited.count(), 3U);
+  EXPECT_THROW(visited.at(1000), std::out_of_range);
+
+  std::vector<bool> expected(1000);
+  expected[3] = expected[64] = expected[999] = true;
+  EXPECT_TRUE(std::equal(visited.cbegin(), visited.cend(), expected.begin()));
+  for (auto flag : visited) flag = !flag;
+  EXPECT_EQ(visited.count(), 997U);
+  EXPECT_EQ(std::count(visited.begin(), visited.end(), true), 997);
+
+  s21::vector<bool> flags = {true, false, true};
+  flags.push_back(true);
+  flags.pop_back();
+  flags.insert(flags.cbegin() + 1, true);
+  EXPECT_EQ(flags, s21::vector<bool>({true, true, false, true}));
+  flags.erase(flags.begin());
+  EXPECT_EQ(flags, s21::vector<bool>({true, false, true}));
+}
+
+TEST(VectorBoolTest, InsertEraseAcrossWords) {
+  std::vector<bool> expected;
+  s21::vector<bool> flags;
+  for (size_t i = 0; i < 300; ++i) {
+    bool value = (i * 7919U) % 3U == 0U;
+    size_t pos = (i * 31U) % (flags.size() + 1);
+    expected.insert(expected.begin() + pos, value);
+    flags.insert(flags.cbegin() + pos, value);
+  }
+  ASSERT_EQ(flags.size(), expected.size());
+  EXPECT_TRUE(std::equal(flags.cbegin(), flags.cend(), expected.begin()));
+  for (size_t i = 0; i < 150; ++i) {
+    size_t pos = (i * 17U) % flags.size();
+    expected.erase(expected.begin() + pos);
+    flags.erase(flags.begin() + pos);
+  }
+  EXPECT_TRUE(std::equal(flags.cbegin(), flags.cend(), expected.begin()));
+  EXPECT_EQ(flags.count(),
+            static_cast<size_t>(
+                std::count(expected.begin(), expected.end(), true)));
+
+  flags.resize(500, true);
+  expected.resize(500, true);
+  flags.resize(420);
+  expected.resize(420);
+  EXPECT_TRUE(std::equal(flags.cbegin(), flags.cend(), expected.begin()));
+  flags.shrink_to_fit();
+  EXPECT_EQ(flags.capacity(), 448U);
+}
+
+TEST(VectorBoolTest, WordParallelOperations) {
+  s21::vector<bool> a(200), b(200);
+  for (size_t i = 0; i < 200; i += 3) a[i] = true;
+  for (size_t i = 0; i < 200; i += 5) b[i] = true;
+
+  EXPECT_EQ((a & b).count(), 14U);
+  EXPECT_EQ((a | b).count(), 67U + 40U - 14U);
+  EXPECT_EQ((a ^ b).count(), 67U + 40U - 28U);
+
+  std::vector<size_t> positions;
+  for (size_t i = b.find_first(); i != b.npos; i = b.find_next(i))
+    positions.push_back(i);
+  ASSERT_EQ(positions.size(), 40U);
+  EXPECT_EQ(positions[1], 5U);
+  EXPECT_EQ(positions.back(), 195U);
+  EXPECT_EQ(b.find_next(195), b.npos);
+
+  a.flip();
+  EXPECT_EQ(a.count(), 133U);
+  a.flip(1);
+  EXPECT_FALSE(a[1]);
+  EXPECT_EQ(s21::vector<bool>(70).find_first(), s21::vector<bool>::npos);
+
+  s21::vector<bool> shorter(100);
+  EXPECT_THROW(a &= shorter, std::invalid_argument);
+  EXPECT_THROW(a.flip(200), std::out_of_range);
+
+  s21::vector<bool> copy = a;
+  EXPECT_EQ(copy, a);
+  copy ^= a;
+  EXPECT_EQ(copy.count(), 0U);
+  s21::vector<bool> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 200U);
+}
+
+TEST(VectorBoolTest, AssignmentAcrossResources) {
+  TrackingResource source_resource;
+  TrackingResource target_resource;
+  {
+    using pmr_bits =
+        s21::vector<bool, std::pmr::polymorphic_allocator<bool>>;
+    pmr_bits source(300, false, &source_resource);
+    for (size_t i = 0; i < 300; i += 7) source[i] = true;
+    pmr_bits target(10, true, &target_resource);
+
+    target = source;
+    EXPECT_EQ(target.get_allocator().resource(), &target_resource);
+    EXPECT_EQ(target, source);
+    EXPECT_EQ(target.count(), 43U);
+
+    pmr_bits moved(&target_resource);
+    moved.push_back(true);
+    moved = std::move(source);
+    EXPECT_EQ(moved.get_allocator().resource(), &target_resource);
+    EXPECT_EQ(moved.size(), 300U);
+    EXPECT_TRUE(moved[294]);
+    EXPECT_FALSE(moved[295]);
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(source_resource.live(), 0U);
+  }
+  EXPECT_EQ(source_resource.foreign_frees + target_resource.foreign_frees, 0);
+  EXPECT_EQ(source_resource.live() + target_resource.live(), 0U);
+}
+
+TEST(SegmentedVectorTest, ElementsNeverMove) {
+  s21::segmented_vector<int> ids;
+  EXPECT_EQ(s21::segmented_vector<int>::first_segment, 64U);
+  ids.push_back(0);
+  int *first = &ids[0];
+  std::vector<const int *> addresses;
+  for (int i = 1; i < 100000; ++i) {
+    ids.push_back(i);
+    if (i % 997 == 0) addresses.push_back(&ids[i]);
+  }
+  EXPECT_EQ(first, &ids.front());
+  for (size_t i = 0; i < addresses.size(); ++i)
+    EXPECT_EQ(*addresses[i], static_cast<int>((i + 1) * 997));
+  EXPECT_EQ(ids.size(), 100000U);
+  EXPECT_GE(ids.capacity(), ids.size());
+  EXPECT_LT(ids.capacity(), 2 * ids.size() + 64);
+
+  // аргумент из самого контейнера: при росте ничего не переносится
+  for (int i = 0; i < 1000; ++i) ids.push_back(ids.back());
+  EXPECT_EQ(ids[100999], 99999);
+
+  long sum = 0;
+  size_t segments = 0;
+  ids.for_each_segment([&](const int *b, const int *e) {
+    ++segments;
+    for (; b != e; ++b) sum += *b;
+  });
+  EXPECT_EQ(sum, 99999L * 100000 / 2 + 1000L * 99999);
+  EXPECT_EQ(segments, 11U);
+  EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+  EXPECT_EQ(std::lower_bound(ids.cbegin(), ids.cend(), 5000) - ids.cbegin(),
+            5000);
+}
+
+TEST(SegmentedVectorTest, ResizeCopyAndErase) {
+  s21::segmented_vector<std::string> names = {"a", "b", "c"};
+  names.emplace_back(5, 'x');
+  EXPECT_EQ(names.back(), "xxxxx");
+  EXPECT_EQ(names.at(1), "b");
+  EXPECT_THROW(names.at(4), std::out_of_range);
+
+  names.resize(300);
+  EXPECT_EQ(names[299], "");
+  auto it = names.begin() + 2;
+  names.resize(40);
+  EXPECT_EQ(*it, "c");
+  names.shrink_to_fit();
+  EXPECT_EQ(names.capacity(), 56U);
+  EXPECT_EQ(*it, "c");
+
+  s21::segmented_vector<std::string> copy = names;
+  copy[0] = "changed";
+  EXPECT_EQ(names[0], "a");
+  names = copy;
+  EXPECT_EQ(names.front(), "changed");
+  s21::segmented_vector<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 40U);
+  moved.pop_back();
+  EXPECT_EQ(moved.size(), 39U);
+  moved.clear();
+  EXPECT_THROW(moved.front(), std::out_of_range);
+  moved.swap(names);
+  EXPECT_EQ(moved.size(), 40U);
+  EXPECT_TRUE(names.empty());
+
+  s21::segmented_vector<double> sized(10);
+  EXPECT_EQ(sized[9], 0.0);
+}
+
+TEST(SegmentedVectorTest, AssignmentAcrossResources) {
+  TrackingResource source_resource;
+  TrackingResource target_resource;
+  {
+    using string_allocator =
+        std::pmr::polymorphic_allocator<std::pmr::string>;
+    using pmr_segmented =
+        s21::segmented_vector<std::pmr::string, string_allocator>;
+    pmr_segmented source(&source_resource);
+    for (int i = 0; i < 100; ++i)
+      source.push_back(std::pmr::string(40, char('a' + i % 26)));
+    pmr_segmented target(&target_resource);
+    target.push_back(std::pmr::string("old"));
+
+    target = source;
+    EXPECT_EQ(target.get_allocator().resource(), &target_resource);
+    EXPECT_EQ(target.size(), 100U);
+    EXPECT_EQ(target[27], std::pmr::string(40, 'b'));
+
+    pmr_segmented moved(&target_resource);
+    moved = std::move(source);
+    EXPECT_EQ(moved.get_allocator().resource(), &target_resource);
+    EXPECT_EQ(moved[99], std::pmr::string(40, 'v'));
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(source_resource.live(), 0U);
+  }
+  EXPECT_EQ(source_resource.foreign_frees + target_resource.foreign_frees, 0);
+  EXPECT_EQ(source_resource.live() + target_resource.live(), 0U);
+}
+
+TEST(ConcurrentVectorTest, ProducersAppendWithoutLoss) {
+  s21::concurrent_vector<long> results;
+  const int producers = 8;
+  const long per_producer = 20000;
+  std::atomic<bool> done{false};
+  std::atomic<long> seen{0};
+
+  // читатель проверяет только опубликованные элементы
+  std::thread reader([&] {
+    while (!done.load()) {
+      size_t n = results.size();
+      for (size_t i = 0; i < n; i += 101)
+        if (results.is_published(i) && results.at(i) >= 0) seen.fetch_add(1);
+    }
+  });
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&results, p, per_producer] {
+      for (long i = 0; i < per_producer; ++i) {
+        auto it = results.push_back(p * per_producer + i);
+        if (*it != p * per_producer + i) std::abort();
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  done.store(true);
+  reader.join();
+
+  ASSERT_EQ(results.size(), static_cast<size_t>(producers * per_producer));
+  std::vector<long> values(results.cbegin(), results.cend());
+  std::sort(values.begin(), values.end());
+  for (size_t i = 0; i < values.size(); ++i)
+    ASSERT_EQ(values[i], static_cast<long>(i));
+  EXPECT_GE(results.capacity(), results.size());
+}
+
+TEST(ConcurrentVectorTest, GrowByAndStableReferences) {
+  s21::concurrent_vector<std::string> lines;
+  EXPECT_TRUE(lines.empty());
+  EXPECT_FALSE(lines.is_published(0));
+  EXPECT_THROW(lines.at(0), std::out_of_range);
+
+  lines.emplace_back(3, 'a');
+  const std::string *first = &lines[0];
+  std::vector<std::thread> threads;
+  for (int p = 0; p < 4; ++p) {
+    threads.emplace_back([&lines, p] {
+      for (int batch = 0; batch < 50; ++batch) {
+        auto it = lines.grow_by(10, std::to_string(p));
+        for (int i = 0; i < 10; ++i)
+          if (it[i] != std::to_string(p)) std::abort();
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(first, &lines[0]);
+  EXPECT_EQ(lines.size(), 2001U);
+  EXPECT_EQ(std::count(lines.begin(), lines.end(), "2"), 500);
+
+  auto empty = lines.grow_by(2);
+  EXPECT_EQ(*empty, "");
+  EXPECT_EQ(empty.index(), 2001U);
+  lines.push_back(lines[0]);
+  EXPECT_EQ(lines.at(2003), "aaa");
+
+  s21::concurrent_vector<std::string> moved(std::move(lines));
+  EXPECT_TRUE(lines.empty());
+  EXPECT_EQ(moved.size(), 2004U);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  moved.reserve(100);
+  EXPECT_GE(moved.capacity(), 100U);
+  moved.push_back("again");
+  EXPECT_EQ(moved[0], "again");
+}
+
+TEST(ConcurrentVectorTest, ClaimPastMaxSizeLeavesSizeUnchanged) {
+  s21::concurrent_vector<int> values;
+  values.grow_by(3, 7);
+  EXPECT_THROW(values.grow_by(values.max_size()), std::length_error);
+  EXPECT_EQ(values.size(), 3U);
+  values.push_back(8);
+  EXPECT_EQ(values.size(), 4U);
+  EXPECT_EQ(values.at(3), 8);
+}
+
+TEST(ConcurrentVectorTest, MoveAssignmentAcrossResources) {
+  TrackingResource source_resource;
+  TrackingResource target_resource;
+  {
+    using string_allocator =
+        std::pmr::polymorphic_allocator<std::pmr::string>;
+    using pmr_concurrent =
+        s21::concurrent_vector<std::pmr::string, string_allocator>;
+    pmr_concurrent source(&source_resource);
+    for (int i = 0; i < 100; ++i)
+      source.push_back(std::pmr::string(40, char('a' + i % 26)));
+    pmr_concurrent target(&target_resource);
+    target.push_back(std::pmr::string("old"));
+
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().resource(), &target_resource);
+    EXPECT_EQ(target.size(), 100U);
+    EXPECT_EQ(target[99], std::pmr::string(40, 'v'));
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(source_resource.live(), 0U);
+  }
+  EXPECT_EQ(source_resource.foreign_frees + target_resource.foreign_frees, 0);
+  EXPECT_EQ(source_resource.live() + target_resource.live(), 0U);
+}
+
+TEST(GapBufferTest, EditsMatchVector) {
+  s21::gap_buffer<char32_t> text(U"hello world", U"hello world" + 11);
+  std::vector<char32_t> expected(text.begin(), text.end());
+  EXPECT_EQ(text.cursor(), 11U);
+
+  // печать, backspace и delete в случайных местах
+  unsigned seed = 12345;
+  for (int step = 0; step < 5000; ++step) {
+    seed = seed * 1103515245U + 12345U;
+    size_t pos = (seed >> 8) % (expected.size() + 1);
+    char32_t ch = U'a' + (seed >> 20) % 26;
+    switch ((seed >> 4) % 4) {
+      case 0:
+      case 1:
+        text.insert(text.begin() + pos, ch);
+        expected.insert(expected.begin() + pos, ch);
+        EXPECT_EQ(text.cursor(), pos + 1);
+        break;
+      case 2:
+        text.move_cursor(pos);
+        text.erase_before_cursor(2);
+        expected.erase(expected.begin() + (pos > 2 ? pos - 2 : 0),
+                       expected.begin() + pos);
+        break;
+      default:
+        if (pos < expected.size()) {
+          text.erase(text.begin() + pos);
+          expected.erase(expected.begin() + pos);
+        }
+    }
+    ASSERT_EQ(text.size(), expected.size());
+  }
+  EXPECT_TRUE(std::equal(text.begin(), text.end(), expected.begin()));
+
+  size_t pieces = 0, total = 0;
+  text.move_cursor(text.size() / 2);
+  text.for_each_segment([&](const char32_t *b, const char32_t *e) {
+    ++pieces;
+    total += e - b;
+  });
+  EXPECT_EQ(pieces, 2U);
+  EXPECT_EQ(total, expected.size());
+  EXPECT_THROW(text.move_cursor(text.size() + 1), std::out_of_range);
+  EXPECT_THROW(text.at(text.size()), std::out_of_range);
+}
+
+TEST(GapBufferTest, OwningElements) {
+  s21::gap_buffer<std::string> lines = {"one", "two", "three"};
+  auto it = lines.begin() + 1;
+  lines.insert(lines.begin(), 3, "zero");
+  lines.insert(lines.begin() + 3, lines[4]);
+  EXPECT_EQ(lines.cursor(), 4U);
+  EXPECT_EQ(*it, "zero");
+  std::vector<std::string> pasted = {"p", "q"};
+  lines.insert(lines.begin() + 1, pasted.begin(), pasted.end());
+  lines.emplace_back(2, 'x');
+  lines.push_back("end");
+  EXPECT_EQ(lines.front(), "zero");
+  EXPECT_EQ(lines.back(), "end");
+  std::vector<std::string> all(lines.begin(), lines.end());
+  EXPECT_EQ(all, (std::vector<std::string>{"zero", "p", "q", "zero", "zero",
+                                           "two", "one", "two", "three",
+                                           "xx", "end"}));
+
+  lines.erase(lines.begin() + 1, lines.begin() + 5);
+  lines.pop_back();
+  EXPECT_EQ(lines.size(), 6U);
+  EXPECT_EQ(lines[1], "two");
+
+  s21::gap_buffer<std::string> copy = lines;
+  copy.move_cursor(0);
+  copy[5] = "changed";
+  EXPECT_EQ(lines[5], "xx");
+  lines = copy;
+  EXPECT_EQ(lines.back(), "changed");
+  lines.shrink_to_fit();
+  EXPECT_EQ(lines.capacity(), 6U);
+  s21::gap_buffer<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  moved.clear();
+  EXPECT_THROW(moved.front(), std::out_of_range);
+  moved.swap(lines);
+  EXPECT_EQ(moved.size(), 6U);
+
+  s21::gap_buffer<int> sized(4);
+  EXPECT_EQ(sized[3], 0);
+}
+
+TEST(GapBufferTest, AssignmentAcrossResources) {
+  TrackingResource source_resource;
+  TrackingResource target_resource;
+  {
+    using string_allocator =
+        std::pmr::polymorphic_allocator<std::pmr::string>;
+    using pmr_gap_buffer = s21::gap_buffer<std::pmr::string, string_allocator>;
+    pmr_gap_buffer source(&source_resource);
+    for (int i = 0; i < 50; ++i)
+      source.push_back(std::pmr::string(40, char('a' + i % 26)));
+    source.move_cursor(10);
+    pmr_gap_buffer target(&target_resource);
+    target.push_back(std::pmr::string("old"));
+
+    target = source;
+    EXPECT_EQ(target.get_allocator().resource(), &target_resource);
+    EXPECT_EQ(target.size(), 50U);
+    EXPECT_EQ(target[27], std::pmr::string(40, 'b'));
+
+    pmr_gap_buffer moved(&target_resource);
+    moved = std::move(source);
+    EXPECT_EQ(moved.get_allocator().resource(), &target_resource);
+    EXPECT_EQ(moved[49], std::pmr::string(40, 'x'));
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(source_resource.live(), 0U);
+  }
+  EXPECT_EQ(source_resource.foreign_frees + target_resource.foreign_frees, 0);
+  EXPECT_EQ(source_resource.live() + target_resource.live(), 0U);
+}
+
+namespace {
+// Проверка инвариантов AVL через публичный интерфейс: глубина не больше
+// 1.45 log2 от числа чанков плюс запас.
+template <typename Rope>
+bool rope_is_shallow(const Rope &r) {
+  size_t chunks = 0;
+  r.for_each_segment([&chunks](const auto *, const auto *) { ++chunks; });
+  size_t log = 0;
+  while ((size_t{1} << log) < chunks) ++log;
+  return r.depth() <= 3 * log / 2 + 2;
+}
+}  // namespace
+
+TEST(RopeTest, EditsMatchVector) {
+  s21::rope<int> seq;
+  std::vector<int> expected;
+  for (int i = 0; i < 50000; ++i) {
+    seq.push_back(i);
+    expected.push_back(i);
+  }
+  EXPECT_EQ(s21::rope<int>::chunk_capacity, 1024U);
+  EXPECT_TRUE(rope_is_shallow(seq));
+
+  unsigned seed = 777;
+  for (int step = 0; step < 2000; ++step) {
+    seed = seed * 1103515245U + 12345U;
+    size_t pos = (seed >> 8) % (expected.size() + 1);
+    size_t count = (seed >> 20) % 300;
+    switch ((seed >> 4) % 3) {
+      case 0:
+        seq.insert(seq.begin() + pos, step);
+        expected.insert(expected.begin() + pos, step);
+        break;
+      case 1: {
+        std::vector<int> block(count, -step);
+        seq.insert(seq.begin() + pos, block.begin(), block.end());
+        expected.insert(expected.begin() + pos, block.begin(), block.end());
+        break;
+      }
+      default:
+        count = std::min(count, expected.size() - pos);
+        seq.erase(seq.begin() + pos, seq.begin() + pos + count);
+        expected.erase(expected.begin() + pos,
+                       expected.begin() + pos + count);
+    }
+    ASSERT_EQ(seq.size(), expected.size());
+  }
+  EXPECT_TRUE(std::equal(seq.begin(), seq.end(), expected.begin()));
+  EXPECT_TRUE(rope_is_shallow(seq));
+  EXPECT_EQ(seq.at(1234), expected[1234]);
+  EXPECT_EQ(seq.back(), expected.back());
+  EXPECT_THROW(seq.at(seq.size()), std::out_of_range);
+
+  size_t total = 0;
+  seq.for_each_segment([&total](const int *b, const int *e) {
+    EXPECT_LE(static_cast<size_t>(e - b), s21::rope<int>::chunk_capacity);
+    total += e - b;
+  });
+  EXPECT_EQ(total, expected.size());
+}
+
+TEST(RopeTest, SharingAndCopyOnWrite) {
+  std::string text(100000, 'a');
+  for (size_t i = 0; i < text.size(); ++i) text[i] = 'a' + i % 26;
+  s21::rope<char> doc(text.begin(), text.end());
+  EXPECT_EQ(doc.front(), 'a');
+
+  s21::rope<char> part = doc.substr(5000, 20000);
+  EXPECT_EQ(part.size(), 20000U);
+  EXPECT_TRUE(std::equal(part.begin(), part.end(), text.begin() + 5000));
+  EXPECT_EQ(doc.substr(99990).size(), 10U);
+  EXPECT_THROW(doc.substr(100001), std::out_of_range);
+
+  // копия делит узлы, запись клонирует только путь
+  s21::rope<char> copy = doc;
+  copy.set(50000, '#');
+  copy.push_back('!');
+  EXPECT_EQ(copy[50000], '#');
+  EXPECT_EQ(doc[50000], text[50000]);
+  EXPECT_EQ(doc.size(), 100000U);
+  EXPECT_EQ(copy.back(), '!');
+  copy.pop_back();
+  copy.set(50000, text[50000]);
+  EXPECT_TRUE(copy == doc);
+
+  s21::rope<char> joined = part + doc + part;
+  EXPECT_EQ(joined.size(), 140000U);
+  EXPECT_EQ(joined[20000 + 100000 + 7], text[5007]);
+  EXPECT_TRUE(rope_is_shallow(joined));
+  joined.insert(joined.begin() + 3, doc);
+  EXPECT_EQ(joined.size(), 240000U);
+  EXPECT_EQ(joined.substr(3, 100000), doc);
+  EXPECT_TRUE(rope_is_shallow(joined));
+
+  s21::rope<std::string> words = {"one", "two"};
+  words.emplace_back(3, 'x');
+  words.insert(words.begin() + 1, 2, "mid");
+  EXPECT_EQ(std::vector<std::string>(words.begin(), words.end()),
+            (std::vector<std::string>{"one", "mid", "mid", "two", "xxx"}));
+  s21::rope<std::string> moved(std::move(words));
+  EXPECT_TRUE(words.empty());
+  moved.erase(moved.begin());
+  EXPECT_EQ(moved.front(), "mid");
+  moved.clear();
+  EXPECT_THROW(moved.back(), std::out_of_range);
+  EXPECT_EQ(moved.depth(), 0U);
+}
+
+TEST(RopeTest, AssignmentAcrossResources) {
+  TrackingResource source_resource;
+  TrackingResource target_resource;
+  {
+    using string_allocator =
+        std::pmr::polymorphic_allocator<std::pmr::string>;
+    using pmr_rope = s21::rope<std::pmr::string, string_allocator>;
+    pmr_rope source(3000, "a fairly long string value", &source_resource);
+    source.set(2999, "last");
+    pmr_rope target({"old"}, &target_resource);
+
+    target = source;
+    EXPECT_EQ(target.get_allocator().resource(), &target_resource);
+    EXPECT_TRUE(target == source);
+    EXPECT_EQ(target.back(), "last");
+
+    pmr_rope moved(&target_resource);
+    moved.push_back("old");
+    moved = std::move(source);
+    EXPECT_EQ(moved.get_allocator().resource(), &target_resource);
+    EXPECT_EQ(moved.size(), 3000U);
+    EXPECT_EQ(moved.back(), "last");
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(source_resource.live(), 0U);
+
+    // клоны при копировании при записи остаются в ресурсе верёвки
+    pmr_rope shared(&target_resource);
+    shared = target;
+    std::pmr::memory_resource *previous =
+        std::pmr::set_default_resource(std::pmr::null_memory_resource());
+    shared.set(1500, "changed");
+    shared.push_back("tail");
+    std::pmr::set_default_resource(previous);
+    EXPECT_EQ(shared[1500], "changed");
+    EXPECT_EQ(target[1500], "a fairly long string value");
+  }
+  EXPECT_EQ(source_resource.foreign_frees + target_resource.foreign_frees, 0);
+  EXPECT_EQ(source_resource.live() + target_resource.live(), 0U);
+}
+
+namespace {
+// Отсортированный список документов: шаги 1..64, изредка большие скачки.
+std::vector<std::uint64_t> make_postings(size_t count) {
+  std::vector<std::uint64_t> ids;
+  std::uint64_t id = 1000000007;
+  unsigned seed = 42;
+  for (size_t i = 0; i < count; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    id += 1 + (seed >> 16) % 64;
+    if (i % 5000 == 4999) id += std::uint64_t{1} << 40;
+    ids.push_back(id);
+  }
+  return ids;
+}
+
+template <typename Codec>
+void check_packed(const std::vector<std::uint64_t> &values) {
+  s21::packed_vector<Codec> packed(values.begin(), values.end());
+  ASSERT_EQ(packed.size(), values.size());
+  for (size_t i = 0; i < values.size(); i += 37)
+    ASSERT_EQ(packed[i], values[i]) << i;
+  EXPECT_EQ(packed.back(), values.back());
+  EXPECT_TRUE(std::equal(packed.begin(), packed.end(), values.begin()));
+
+  size_t offset = 0;
+  packed.for_each_segment([&](const std::uint64_t *b, const std::uint64_t *e) {
+    EXPECT_TRUE(std::equal(b, e, values.begin() + offset));
+    offset += e - b;
+  });
+  EXPECT_EQ(offset, values.size());
+}
+}  // namespace
+
+TEST(PackedVectorTest, CodecsRoundTrip) {
+  std::vector<std::uint64_t> postings = make_postings(100000);
+  check_packed<s21::codec::bitpack>(postings);
+  check_packed<s21::codec::delta>(postings);
+  check_packed<s21::codec::varint>(postings);
+
+  // несортированные и широкие значения: разности по модулю 2^64
+  std::vector<std::uint64_t> noisy;
+  std::uint64_t x = 88172645463325252ULL;
+  for (int i = 0; i < 1000; ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    noisy.push_back(i % 3 == 0 ? x : x >> (i % 64));
+  }
+  noisy.push_back(0);
+  noisy.push_back(~std::uint64_t{0});
+  check_packed<s21::codec::bitpack>(noisy);
+  check_packed<s21::codec::delta>(noisy);
+  check_packed<s21::codec::varint>(noisy);
+
+  std::vector<std::uint64_t> zeros(300, 0);
+  check_packed<s21::codec::bitpack>(zeros);
+  check_packed<s21::codec::delta>(zeros);
+}
+
+TEST(PackedVectorTest, AppendShrinkAndSize) {
+  std::vector<std::uint64_t> postings = make_postings(1 << 18);
+  s21::packed_vector<> packed;
+  for (std::uint64_t id : postings) packed.push_back(id);
+  packed.shrink_to_fit();
+  // шаги до 64 — около 7 бит на значение вместо 64
+  EXPECT_LT(packed.memory_usage() * 6, postings.size() * 8);
+
+  for (int i = 0; i < 200; ++i) {
+    packed.pop_back();
+    postings.pop_back();
+  }
+  EXPECT_EQ(packed.size(), postings.size());
+  EXPECT_EQ(packed.back(), postings.back());
+  packed.push_back(postings.back() + 5);
+  EXPECT_EQ(packed.at(postings.size()), postings.back() + 5);
+  EXPECT_THROW(packed.at(packed.size()), std::out_of_range);
+
+  s21::packed_vector<> copy = packed;
+  copy.push_back(1);
+  EXPECT_EQ(copy.size(), packed.size() + 1);
+  s21::packed_vector<> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.back(), 1U);
+  moved.clear();
+  EXPECT_THROW(moved.front(), std::out_of_range);
+  moved.swap(packed);
+  EXPECT_EQ(moved.front(), postings.front());
+
+  s21::packed_vector<s21::codec::varint> small = {5, 3, 8};
+  EXPECT_EQ(small[1], 3U);
+  std::uint64_t block[s21::packed_vector<>::block_size];
+  EXPECT_EQ(small.decode_block(0, block), 3U);
+  EXPECT_EQ(block[2], 8U);
+
+  // значение не ссылается на буфер временного итератора
+  static_assert(std::is_same_v<decltype(*small.begin()), std::uint64_t>);
+  const std::uint64_t &third = *std::next(small.begin(), 2);
+  EXPECT_EQ(third, 8U);
+}
+
+TEST(AlignedStorageTest, VectorAndArrayAlignment) {
+  auto offset = [](const void *p, size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment;
+  };
+  s21::aligned_vector<float> samples;
+  for (int i = 0; i < 1000; ++i) {
+    samples.push_back(static_cast<float>(i));
+    ASSERT_EQ(offset(samples.data(), 64), 0U);
+  }
+  EXPECT_EQ(samples[999], 999.0f);
+  s21::vector<char, s21::aligned_allocator<char, 256>> bytes(3);
+  EXPECT_EQ(offset(bytes.data(), 256), 0U);
+  s21::aligned_vector<bool> flags(100);
+  flags[70] = true;
+  EXPECT_EQ(offset(flags.words(), 64), 0U);
+  EXPECT_EQ(flags.count(), 1U);
+
+  s21::array<float, 5, 64> lanes = {1, 2, 3};
+  EXPECT_EQ(alignof(decltype(lanes)), 64U);
+  EXPECT_EQ(offset(lanes.data(), 64), 0U);
+  EXPECT_EQ(lanes[2], 3.0f);
+  s21::array<double, 2, 1> natural;
+  EXPECT_EQ(alignof(decltype(natural)), alignof(double));
+}
+
+TEST(AlignedStorageTest, HugePageVector) {
+  using huge = s21::huge_page_allocator<std::uint64_t>;
+  s21::huge_page_vector<std::uint64_t> table;
+  for (std::uint64_t i = 0; i < 300000; ++i) table.push_back(i * 3);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(table.data()) %
+                huge::huge_page_size,
+            0U);
+  EXPECT_EQ(table[299999], 899997U);
+
+  // малые буферы не тратят 2 МБ
+  s21::huge_page_vector<int> small = {1, 2, 3};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(small.data()) % 64, 0U);
+  s21::huge_page_vector<int> moved(std::move(small));
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_TRUE(huge() == s21::huge_page_allocator<char>());
+}
+
+namespace {
+int span_sum(s21::span<const int> values) {
+  int total = 0;
+  for (int x : values) total += x;
+  return total;
+}
+}  // namespace
+
+TEST(SpanTest, ViewsContainersWithoutCopy) {
+  s21::vector<int> our_vector = {1, 2, 3, 4, 5};
+  s21::array<int, 3> our_array = {10, 20, 30};
+  int raw[4] = {7, 7, 7, 7};
+  s21::small_vector<int, 4> inline_values = {2, 4};
+  s21::soa_vector<float, int> rows;
+  rows.push_back({1.5f, 6});
+  EXPECT_EQ(span_sum(our_vector), 15);
+  EXPECT_EQ(span_sum(our_array), 60);
+  EXPECT_EQ(span_sum(raw), 28);
+  EXPECT_EQ(span_sum(inline_values), 6);
+  EXPECT_EQ(span_sum(rows.column<1>()), 6);
+
+  s21::span whole(our_vector);
+  EXPECT_EQ(whole.data(), our_vector.data());
+  whole[0] = 100;
+  EXPECT_EQ(our_vector[0], 100);
+  s21::span fixed(our_array);
+  static_assert(decltype(fixed)::extent == 3);
+  static_assert(sizeof(fixed) == sizeof(int *));
+  s21::span<int, 4> from_raw = raw;
+  EXPECT_EQ(from_raw.size_bytes(), sizeof(raw));
+  EXPECT_EQ(s21::as_bytes(fixed).size(), 3 * sizeof(int));
+  EXPECT_THROW(whole.at(5), std::out_of_range);
+  EXPECT_THROW(s21::span<int>().front(), std::out_of_range);
+
+  int *start = our_vector.data();
+  s21::span<int> empty(start, 0);
+  s21::span<int> pair(start, start + 2);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(pair.size(), 2U);
+}
+
+TEST(SpanTest, SlicesFeedAlgorithms) {
+  s21::vector<int> our_vector = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+  s21::span<int> all(our_vector);
+  EXPECT_EQ(all.first(3).back(), 7);
+  EXPECT_EQ(all.last(2).front(), 1);
+  s21::span<int, 4> middle = all.subspan<3, 4>();
+  EXPECT_EQ(middle[0], 6);
+  EXPECT_EQ(middle.last<1>()[0], 3);
+  EXPECT_EQ(all.subspan(7).size(), 3U);
+  EXPECT_EQ(*all.rbegin(), 0);
+
+  // сортируется только середина, прямо в исходном векторе
+  s21::parallel::sort(all.subspan(3, 4));
+  s21::vector<int> expected = {9, 8, 7, 3, 4, 5, 6, 2, 1, 0};
+  EXPECT_TRUE(std::equal(our_vector.begin(), our_vector.end(),
+                         expected.begin()));
+  s21::parallel::for_each(all.first(2), [](int &x) { x = 0; });
+  EXPECT_EQ(our_vector[1], 0);
+  EXPECT_EQ(s21::simd::count(all.last(3), 0), 1U);
+  s21::simd::fill(all.last(4), 1);
+  EXPECT_EQ(*s21::simd::max_element(all.first(3)), 7);
+  EXPECT_EQ(s21::simd::find(all.subspan(2), 3) - our_vector.data(), 3);
+  EXPECT_EQ(s21::parallel::reduce(all, 0), 0 + 0 + 7 + 3 + 4 + 5 + 4);
+}
+
+TEST(SharedVectorTest, CopiesShareUntilWritten) {
+  AllocationStats stats;
+  {
+    CountingAllocator<std::string> alloc(&stats);
+    s21::shared_vector<std::string, CountingAllocator<std::string>> config(
+        {"alpha", "beta", "gamma"}, alloc);
+    const int before = stats.allocations;
+    std::vector<s21::shared_vector<std::string, CountingAllocator<std::string>>>
+        workers(64, config);
+    EXPECT_EQ(stats.allocations, before);
+    EXPECT_EQ(config.use_count(), 65);
+    EXPECT_EQ(workers[7].data(), config.data());
+
+    workers[7].set(1, "delta");
+    EXPECT_EQ(workers[7][1], "delta");
+    EXPECT_EQ(config[1], "beta");
+    EXPECT_NE(workers[7].data(), config.data());
+    EXPECT_TRUE(workers[7].unique());
+    workers[7].push_back("epsilon");
+    const std::string *own = workers[7].data();
+    workers[7].set(0, "omega");
+    EXPECT_EQ(workers[7].data(), own);
+    EXPECT_EQ(workers[7].size(), 4U);
+    EXPECT_EQ(config.size(), 3U);
+    EXPECT_TRUE(workers[0] == config);
+    EXPECT_TRUE(workers[7] != config);
+    EXPECT_THROW(config.set(3, "x"), std::out_of_range);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+
+  s21::vector<int> loaded = {1, 2, 3};
+  const int *buffer = loaded.data();
+  s21::shared_vector<int> adopted(std::move(loaded));
+  EXPECT_EQ(adopted.data(), buffer);
+  s21::span<const int> view(adopted);
+  EXPECT_EQ(view.size(), 3U);
+  EXPECT_THROW(s21::shared_vector<int>().front(), std::out_of_range);
+}
+
+TEST(SharedVectorTest, SlicesAndThreads) {
+  s21::shared_vector<int> numbers;
+  for (int i = 0; i < 10; ++i) numbers.push_back(i);
+  s21::shared_vector<int> middle = numbers.slice(3, 4);
+  EXPECT_EQ(middle.data(), numbers.data() + 3);
+  EXPECT_EQ(middle.front(), 3);
+  EXPECT_EQ(middle.back(), 6);
+  EXPECT_THROW(numbers.slice(11), std::out_of_range);
+
+  // срез общего буфера укорачивается без копии
+  middle.pop_back();
+  middle.erase(middle.begin());
+  EXPECT_EQ(middle.data(), numbers.data() + 4);
+  EXPECT_EQ(middle.size(), 2U);
+  middle.insert(middle.begin() + 1, 42);
+  EXPECT_NE(middle.data(), numbers.data() + 4);
+  std::vector<int> expected = {4, 42, 5};
+  EXPECT_TRUE(std::equal(middle.begin(), middle.end(), expected.begin()));
+  EXPECT_EQ(numbers[5], 5);
+
+  middle.insert(middle.end(), numbers.begin(), numbers.begin() + 2);
+  middle.erase(middle.begin() + 1, middle.begin() + 3);
+  expected = {4, 0, 1};
+  EXPECT_TRUE(std::equal(middle.begin(), middle.end(), expected.begin()));
+
+  std::atomic<long> total{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([copy = numbers, &total, t]() mutable {
+      long sum = 0;
+      for (int x : copy) sum += x;
+      copy.set(0, t);
+      total += sum + copy[0];
+    });
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(total, 4 * 45 + 0 + 1 + 2 + 3);
+  EXPECT_EQ(numbers[0], 0);
+  EXPECT_TRUE(numbers.unique());
+}
+
+TEST(SharedVectorTest, AssignmentAcrossArenasCopiesIntoTarget) {
+  using arena_vector =
+      s21::shared_vector<std::string,
+                         std::pmr::polymorphic_allocator<std::string>>;
+  s21::monotonic_arena source_arena;
+  s21::monotonic_arena target_arena;
+  arena_vector source({"a", "b", "c"}, &source_arena);
+  arena_vector target(&target_arena);
+
+  target = source;
+  EXPECT_EQ(target.get_allocator().resource(), &target_arena);
+  EXPECT_NE(target.data(), source.data());
+  EXPECT_TRUE(target == source);
+  EXPECT_TRUE(source.unique());
+
+  arena_vector same_arena(&source_arena);
+  same_arena = source;
+  EXPECT_EQ(same_arena.data(), source.data());
+
+  target = std::move(same_arena);
+  EXPECT_EQ(target.get_allocator().resource(), &target_arena);
+  EXPECT_EQ(target.size(), 3U);
+  EXPECT_TRUE(same_arena.empty());
+  EXPECT_EQ(source[2], "c");
+  source.set(0, "z");
+  EXPECT_EQ(target[0], "a");
+}
+
+TEST(VectorEmplaceTest, AllocatesOnlyOnGrowth) {
+  AllocationStats stats;
+  {
+    Record::reset();
+    s21::vector<Record, CountingAllocator<Record>> our_vector{
+        CountingAllocator<Record>(&stats)};
+    our_vector.reserve(64);
+    EXPECT_EQ(stats.allocations, 1);
+    for (int i = 0; i < 32; ++i) our_vector.emplace_back("e", 2);
+    for (int i = 0; i < 32; ++i) our_vector.push_back(Record("p", 2));
+    EXPECT_EQ(stats.allocations, 1);
+    EXPECT_EQ(Record::copies, 0);
+
+    // без reserve — ровно по одному выделению на каждое новое значение
+    // capacity()
+    s21::vector<Record, CountingAllocator<Record>> grown{
+        CountingAllocator<Record>(&stats)};
+    int growths = 0;
+    for (int i = 0; i < 1000; ++i) {
+      size_t capacity = grown.capacity();
+      if (i % 2 == 0)
+        grown.emplace_back("e", 1);
+      else
+        grown.push_back(Record("p", 1));
+      if (grown.capacity() != capacity) ++growths;
+    }
+    EXPECT_EQ(stats.allocations, 1 + growths);
+    EXPECT_EQ(Record::copies, 0);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+}
+
 int main(int argc, char *argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();